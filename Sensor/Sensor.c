@@ -1,20 +1,28 @@
 /**
  * Sensor.c - KMZ60 Speed and Direction Detection for TM4C1294NCPDT
- * 
+ *
  * CRITICAL FIX: Port P on TM4C1294 uses per-pin interrupts!
  * - P0 has INT_GPIOP0
  * - P1 has INT_GPIOP1
- * 
+ *
  * Based on the signal diagram:
- * - S1 connected to Port P0 (comparator output)
- * - S2 connected to Port P1 (comparator output)
+ * - S1 connected to pin A (comparator output), e.g. Port P0
+ * - S2 connected to pin B (comparator output), e.g. Port P1
  * - Signals are 90° phase-shifted (quadrature)
- * 
+ *
  * Forward (Rechtslauf):  11 -> 01 -> 00 -> 10 -> 11
  * Backward (Linkslauf):  11 -> 10 -> 00 -> 01 -> 11
+ *
+ * Every channel keeps its state in one SensorChannel block. All edge
+ * interrupts go to one handler, which reads the shared timebase once and
+ * then serves each channel whose pins are flagged.
  */
 
 #include "Sensor.h"
+#include "filter.h"
+#include "tracker.h"
+#include "calib.h"
+#include "poles.h"
 #include <stdint.h>
 #include <stdio.h>
 #include <math.h>
@@ -24,87 +32,113 @@
 #include "inc/hw_gpio.h"
 #include "inc/hw_types.h"
 #include "driverlib/sysctl.h"
+#include "profile/trace.h"
+#include "profile/costmodel.h"
 #include "driverlib/gpio.h"
 #include "driverlib/interrupt.h"
 #include "driverlib/timer.h"
 
-/* ============== Pin Definitions ============== */
-#define S1_PORT         GPIO_PORTP_BASE
-#define S1_PIN          GPIO_PIN_0
-#define S2_PORT         GPIO_PORTP_BASE
-#define S2_PIN          GPIO_PIN_1
-
-/* Timer for measuring time between edges */
+/* Shared timebase: free-running, counts down */
 #define EDGE_TIMER_BASE TIMER2_BASE
 
-/* 
- * CRITICAL: TM4C1294 Port P uses PER-PIN interrupts!
- * These values come from hw_ints.h - use the actual defines
- */
-#ifndef INT_GPIOP0
-#define INT_GPIOP0      92   /* Actual value from TM4C1294 hw_ints.h */
-#endif
-#ifndef INT_GPIOP1
-#define INT_GPIOP1      93
-#endif
-
-/* Wheel parameters */
-#define WHEEL_RADIUS_M      0.005f      /* 0.5cm radius */
-#define WHEEL_CIRCUMFERENCE (2.0f * M_PI * WHEEL_RADIUS_M)
-#define TIMER_FREQ          120000000.0f   /* 120 MHz system clock as float */
-
-/* 
- * Edges per rotation - using BOTH edges on S1 AND S2
- * With quadrature: 4 edges per full rotation (2 on S1 + 2 on S2)
- * If magnet has multiple poles, multiply accordingly
- */
-#define EDGES_PER_ROTATION  4.0f
+/* Timeout: if no edge for this long, motor is stopped (0.5 s) */
+#define STOPPED_TIMEOUT_US      500000UL
 
-/* Timeout: if no edge for this many timer ticks, motor is stopped */
-/* At 120MHz, 60000000 ticks = 0.5 second */
-#define STOPPED_TIMEOUT     60000000UL
+/* Minimum period to filter noise (10 µs) */
+#define MIN_PERIOD_US           10UL
 
-/* Minimum period to filter noise (10µs at 120MHz = 1200 ticks) */
-#define MIN_PERIOD          1200UL
-
-/* Minimum update interval for speed calculation (100ms = 12M ticks at 120MHz) */
+/* Minimum update interval for speed calculation (100 ms) */
 /* This ensures consistent measurement windows for stable readings */
-/* Using 100ms to match display update rate for responsive updates */
-#define MIN_UPDATE_INTERVAL 12000000UL
-
-/* ============== Volatile Variables (shared with ISR) ============== */
-volatile static uint32_t last_edge_time = 0;
-volatile static uint32_t edge_period = 0;
-volatile static uint8_t  new_edge_detected = 0;
-volatile static uint8_t  last_state = 0;        /* Combined state: (S1<<1)|S2 */
-volatile static int32_t  direction_counter = 0; /* Accumulated direction votes */
-volatile static uint32_t edge_count = 0;        /* Total edges for distance */
-volatile static uint32_t interrupt_count = 0;   /* Debug counter */
-
-/* ============== Non-Volatile State ============== */
-static RotationDirection current_direction = DIR_STOPPED;
-static float current_speed_kmh = 0.0f;
-static float current_rpm = 0.0f;
-static float accumulated_distance = 0.0f;
-static uint32_t last_edge_count = 0;
-static uint32_t last_display_edge_count = 0;
-static uint32_t last_display_time = 0;
-
-/* Moving average filter for speed and RPM smoothing
- * Using smaller filter since we now have 300ms measurement windows */
-#define SPEED_FILTER_SIZE 3
-#define RPM_FILTER_SIZE 3
-static float speed_buffer[SPEED_FILTER_SIZE] = {0};
-static uint8_t speed_filter_index = 0;
-static uint8_t speed_filter_count = 0;
-
-static float rpm_buffer[RPM_FILTER_SIZE] = {0};
-static uint8_t rpm_filter_index = 0;
-static uint8_t rpm_filter_count = 0;
+#define MIN_UPDATE_INTERVAL_US  100000UL
+
+/* The above in timer ticks, and the timer frequency as float, set by
+ * Sensor_Init() from the system clock (at 120 MHz: 60M, 1200, 12M).
+ * The edge handler checks the period is above the minimum and below the
+ * timeout as one unsigned compare, period - acceptMin < acceptSpan. */
+static float timerFreq;
+static uint32_t stoppedTimeout;
+static uint32_t minUpdateInterval;
+static uint32_t acceptMin;
+static uint32_t acceptSpan;
+
+/* Accepted edge periods for the tracker, drained by Sensor_Process().
+ * At the top rate (100k RPM, 6.7k edges/s) 64 entries cover 9 ms. */
+#define SENSOR_EDGE_RING    64
 
 /* Direction hysteresis - need multiple consistent readings */
 #define DIRECTION_THRESHOLD 5
 
+/* Default filter chain on the window rate: the 3-sample moving average */
+static const FilterStageConfig DEFAULT_FILTER[] = {
+    { FILTER_AVERAGE, 3, 0.0f }
+};
+
+typedef struct {
+    SensorChannelConfig config;
+    uint8_t pins;                       // pinA | pinB
+    uint8_t revEdges;                   // edgesPerRev, as set by Sensor_SetEncoder()
+
+    /* Scale factors, worked out by ApplyEncoder(): edge rate
+     * (edges/s) to RPM and km/h, speed and RPM both scaled from the one
+     * rate, and edges to meters. Rates above maxRate (200 km/h) are
+     * glitches. */
+    float rateToRpm;
+    float rateToKmh;
+    float edgesToMeters;
+    float maxRate;
+
+    /* Shared with the ISR */
+    volatile uint32_t lastEdgeTime;
+    volatile uint32_t acceptedEdgeTime; // last edge that passed the checks
+    volatile uint8_t lastState;         // combined state: (S1<<1)|S2
+    volatile int32_t directionCounter;  // accumulated direction votes
+    volatile uint32_t edgeCount;        // total edges for distance
+    volatile uint32_t interruptCount;   // debug counter
+    volatile uint32_t edgeRing[SENSOR_EDGE_RING];
+    volatile uint32_t ringHead;         // written by the ISR
+    uint32_t ringTail;
+    uint32_t ringOverflows;
+
+    /* RPM threshold fast path: revolution period from the last revEdges
+     * edge periods, compared in timer ticks in the ISR */
+    uint32_t revPeriods[TRACKER_MAX_EDGES_PER_REV];
+    uint32_t revSum;
+    uint8_t revIndex;
+    uint8_t revCount;
+    uint32_t thresholdOnTicks;          // revolution ticks at threshold
+    uint32_t thresholdOffTicks;         // revolution ticks at threshold - hysteresis
+    uint32_t thresholdRpm;              // as set, to rescale on a geometry change
+    uint32_t thresholdOffRpm;
+    volatile uint8_t thresholdAbove;
+    SensorThresholdHook thresholdHook;
+
+    /* Sensor_Process() */
+    RotationDirection direction;
+    float speedKmh;
+    float rpm;
+    float distance;
+    float distanceBase;                 // meters at distanceEdgeBase
+    uint32_t distanceEdgeBase;          // edgeCount at the last reset or geometry change
+    uint32_t processEdgeCount;          // edgeCount at the last tick
+    uint32_t windowEdgeCount;           // measurement window start
+    uint32_t windowTime;
+    FilterChain filter;
+    float rate;                         // filtered window rate, edges/s
+    Tracker tracker;                    // per-edge, run alongside the window
+    PoleTable poles;                    // single-edge rates, pole spacing learnt
+    RotationDirection polesDirection;   // the table was learnt turning this way
+    SensorEstimator estimator;
+    SensorSnapshot snapshot;
+} SensorChannel;
+
+static SensorChannel channels[SENSOR_MAX_CHANNELS];
+static uint8_t channelCount;
+
+/* Edges-per-revolution calibration, one channel at a time; fed from the
+ * edge ring, so the ISR does no extra work */
+static Calib calib;
+static uint8_t calibChannel = SENSOR_NONE;
+
 /* ============== Direction Lookup Table ============== */
 /*
  * Quadrature state transitions:
@@ -113,10 +147,10 @@ static uint8_t rpm_filter_count = 0;
  *   State 1 = 01 (S2 high)
  *   State 2 = 10 (S1 high)
  *   State 3 = 11 (both high)
- * 
+ *
  * Forward sequence:  3 -> 1 -> 0 -> 2 -> 3  (11->01->00->10->11)
  * Backward sequence: 3 -> 2 -> 0 -> 1 -> 3  (11->10->00->01->11)
- * 
+ *
  * Table[old_state][new_state] = direction (+1, -1, or 0 for invalid/same)
  */
 static const int8_t DIRECTION_TABLE[4][4] = {
@@ -127,365 +161,626 @@ static const int8_t DIRECTION_TABLE[4][4] = {
     /* from 11 */  { 0, -1, +1,  0 }
 };
 
+static uint8_t ReadState(const SensorChannel *ch)
+{
+    uint32_t levels = GPIOPinRead(ch->config.port, ch->pins);
+    uint8_t s1 = (levels & ch->config.pinA) ? 1 : 0;
+    uint8_t s2 = (levels & ch->config.pinB) ? 1 : 0;
+
+    return (s1 << 1) | s2;
+}
+
 /* ============== Common Edge Handler ============== */
-static void HandleEdge(void)
+static void HandleEdge(SensorChannel *ch, uint32_t current_time)
 {
-    uint32_t current_time;
     uint8_t current_state;
-    uint8_t s1, s2;
     int8_t dir;
-    
-    /* Read timer IMMEDIATELY for accurate timing */
-    current_time = TimerValueGet(EDGE_TIMER_BASE, TIMER_A);
-    
+
     /* Read both pin states */
-    s1 = GPIOPinRead(S1_PORT, S1_PIN) ? 1 : 0;
-    s2 = GPIOPinRead(S2_PORT, S2_PIN) ? 1 : 0;
-    current_state = (s1 << 1) | s2;
-    
+    current_state = ReadState(ch);
+
     /* Decode direction from state transition */
-    dir = DIRECTION_TABLE[last_state][current_state];
-    
+    COST_CHARGE(COST_TABLE_LOOKUP);
+    dir = DIRECTION_TABLE[ch->lastState][current_state];
+
     /* Only process valid transitions (skip glitches where state didn't change) */
-    if (current_state != last_state) {
-        uint32_t period;
-        
-        /* Calculate period (timer counts DOWN on TM4C) */
-        if (last_edge_time >= current_time) {
-            period = last_edge_time - current_time;
-        } else {
-            /* Timer wrapped around */
-            period = (last_edge_time) + (0xFFFFFFFFUL - current_time) + 1;
-        }
-        
+    if (current_state != ch->lastState) {
+        /* Calculate period (timer counts DOWN; wraps modulo 2^32) */
+        uint32_t period = ch->lastEdgeTime - current_time;
+
         /* Sanity check: ignore very short periods (noise/bounce) */
-        if (period > MIN_PERIOD && period < STOPPED_TIMEOUT) {
-            edge_period = period;
-            new_edge_detected = 1;
-            edge_count++;
-            
+        if (period - acceptMin < acceptSpan) {
+            ch->edgeCount++;
+            ch->acceptedEdgeTime = current_time;
+            ch->edgeRing[ch->ringHead % SENSOR_EDGE_RING] = period;
+            ch->ringHead++;
+
+            /* Threshold fast path: running sum over one revolution */
+            if (ch->thresholdHook) {
+                ch->revSum += period - ch->revPeriods[ch->revIndex];
+                ch->revPeriods[ch->revIndex] = period;
+                ch->revIndex = (ch->revIndex + 1) % ch->revEdges;
+                if (ch->revCount < ch->revEdges) {
+                    ch->revCount++;
+                } else if (!ch->thresholdAbove && ch->revSum <= ch->thresholdOnTicks) {
+                    ch->thresholdAbove = 1;
+                    ch->thresholdHook((uint8_t)(ch - channels), 1);
+                } else if (ch->thresholdAbove && ch->revSum >= ch->thresholdOffTicks) {
+                    ch->thresholdAbove = 0;
+                    ch->thresholdHook((uint8_t)(ch - channels), 0);
+                }
+            }
+
             /* Accumulate direction votes for hysteresis */
             if (dir > 0) {
-                direction_counter++;
-                if (direction_counter > 100) direction_counter = 100; /* Clamp */
+                ch->directionCounter++;
+                if (ch->directionCounter > 100) ch->directionCounter = 100; /* Clamp */
             } else if (dir < 0) {
-                direction_counter--;
-                if (direction_counter < -100) direction_counter = -100;
+                ch->directionCounter--;
+                if (ch->directionCounter < -100) ch->directionCounter = -100;
             }
         }
-        
-        last_edge_time = current_time;
-        last_state = current_state;
+
+        ch->lastEdgeTime = current_time;
+        ch->lastState = current_state;
     }
-    
-    interrupt_count++;
+
+    ch->interruptCount++;
 }
 
-/* ============== GPIO Port P Pin 0 ISR (S1) ============== */
-void GPIOP0_IRQHandler(void)
+/* ============== GPIO Edge ISR (all channels) ============== */
+void SensorGpioIntHandler(void)
 {
-    /* Clear the interrupt */
-    GPIOIntClear(S1_PORT, S1_PIN);
-    
-    /* Process the edge */
-    HandleEdge();
+    /* Read timer IMMEDIATELY for accurate timing, once for every channel */
+    uint32_t current_time = TimerValueGet(EDGE_TIMER_BASE, TIMER_A);
+    uint8_t i;
+
+    for (i = 0; i < channelCount; i++) {
+        SensorChannel *ch = &channels[i];
+        uint32_t flagged = GPIOIntStatus(ch->config.port, true) & ch->pins;
+
+        if (flagged) {
+            /* Clear the interrupt */
+            GPIOIntClear(ch->config.port, flagged);
+
+            /* Process the edge */
+            TRACE_BEGIN_EVENT(TRACE_SENSOR_EDGE);
+            HandleEdge(ch, current_time);
+            TRACE_END_EVENT(TRACE_SENSOR_EDGE, i);
+        }
+    }
+}
+
+/* ============== Encoder Geometry ============== */
+static bool EncoderValid(uint8_t edges_per_rev, float circumference_m)
+{
+    return edges_per_rev >= 1 && edges_per_rev <= TRACKER_MAX_EDGES_PER_REV &&
+           circumference_m > 0.0f;
 }
 
-/* ============== GPIO Port P Pin 1 ISR (S2) ============== */
-void GPIOP1_IRQHandler(void)
+/* Threshold revolution ticks and the revolution sum restarted; with
+ * interrupts masked once the channel is live */
+static void ResetThreshold(SensorChannel *ch)
 {
-    /* Clear the interrupt */
-    GPIOIntClear(S2_PORT, S2_PIN);
-    
-    /* Process the edge */
-    HandleEdge();
+    /* ticks per revolution = 60 s * timer frequency / rpm */
+    if (ch->thresholdRpm) {
+        ch->thresholdOnTicks = (uint32_t)(60.0f * timerFreq / (float)ch->thresholdRpm);
+        ch->thresholdOffTicks = (uint32_t)(60.0f * timerFreq / (float)ch->thresholdOffRpm);
+    }
+    for (int i = 0; i < TRACKER_MAX_EDGES_PER_REV; i++) {
+        ch->revPeriods[i] = 0;
+    }
+    ch->revSum = 0;
+    ch->revIndex = 0;
+    ch->revCount = 0;
+    ch->thresholdAbove = 0;
+}
+
+/* Every factor the hot paths need from config.edgesPerRev and
+ * config.circumferenceM, so they multiply instead of divide */
+static void ApplyEncoder(SensorChannel *ch)
+{
+    float edges = (float)ch->config.edgesPerRev;
+
+    ch->revEdges = ch->config.edgesPerRev;
+    ch->rateToRpm = 60.0f / edges;
+    ch->edgesToMeters = ch->config.circumferenceM / edges;
+    ch->rateToKmh = ch->edgesToMeters * 3.6f;
+    ch->maxRate = 200.0f / ch->rateToKmh;
 }
 
 /* ============== Initialization ============== */
-void Sensor_Init(void)
+void Sensor_Init(uint32_t timerHz)
 {
-    /* Enable GPIO Port P */
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOP);
-    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOP)) {}
-    
-    /* Configure P0 (S1) and P1 (S2) as inputs */
-    GPIOPinTypeGPIOInput(S1_PORT, S1_PIN | S2_PIN);
-    
-    /* Configure with weak pull-up (comparator outputs might be open-drain) */
-    GPIOPadConfigSet(S1_PORT, S1_PIN | S2_PIN, 
-                     GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
-    
-    /* Configure interrupts on BOTH edges for both pins */
-    GPIOIntTypeSet(S1_PORT, S1_PIN, GPIO_BOTH_EDGES);
-    GPIOIntTypeSet(S2_PORT, S2_PIN, GPIO_BOTH_EDGES);
-    
-    /* Clear any pending interrupts */
-    GPIOIntClear(S1_PORT, S1_PIN | S2_PIN);
-    
-    /* Enable GPIO interrupts for both pins */
-    GPIOIntEnable(S1_PORT, S1_PIN);
-    GPIOIntEnable(S2_PORT, S2_PIN);
-    
-    /* Register ISRs with NVIC - CRITICAL for TM4C1294! */
-    IntRegister(INT_GPIOP0, GPIOP0_IRQHandler);
-    IntRegister(INT_GPIOP1, GPIOP1_IRQHandler);
-    
-    /* Set interrupt priorities to HIGHEST (0x00 = highest, 0xE0 = lowest) */
-    /* CRITICAL: Sensor timing is most important - must not be delayed */
-    IntPrioritySet(INT_GPIOP0, 0x00);
-    IntPrioritySet(INT_GPIOP1, 0x00);
-    
-    /* Enable interrupts in NVIC */
-    IntEnable(INT_GPIOP0);
-    IntEnable(INT_GPIOP1);
-    
+    /* Timebase constants in ticks, once */
+    timerFreq = (float)timerHz;
+    stoppedTimeout = (uint32_t)((uint64_t)timerHz * STOPPED_TIMEOUT_US / 1000000UL);
+    minUpdateInterval = (uint32_t)((uint64_t)timerHz * MIN_UPDATE_INTERVAL_US / 1000000UL);
+    acceptMin = (uint32_t)((uint64_t)timerHz * MIN_PERIOD_US / 1000000UL) + 1;
+    acceptSpan = stoppedTimeout - acceptMin;
+
     /* Enable Timer2 as free-running counter for time measurement */
     SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER2);
     while(!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER2)) {}
-    
+
     /* Configure as 32-bit periodic timer (counts down) */
     TimerConfigure(EDGE_TIMER_BASE, TIMER_CFG_PERIODIC);
     TimerLoadSet(EDGE_TIMER_BASE, TIMER_A, 0xFFFFFFFF);
     TimerEnable(EDGE_TIMER_BASE, TIMER_A);
-    
+
+    channelCount = 0;
+}
+
+uint8_t Sensor_AddChannel(const SensorChannelConfig *config)
+{
+    SensorChannel *ch;
+    uint8_t id;
+    uint32_t now;
+
+    if (channelCount == SENSOR_MAX_CHANNELS ||
+        !EncoderValid(config->edgesPerRev, config->circumferenceM))
+        return SENSOR_NONE;
+    id = channelCount;
+    ch = &channels[id];
+
+    ch->config = *config;
+    ch->pins = config->pinA | config->pinB;
+    ApplyEncoder(ch);
+
+    /* Enable the GPIO port */
+    SysCtlPeripheralEnable(config->periph);
+    while(!SysCtlPeripheralReady(config->periph)) {}
+
+    /* Configure S1 and S2 as inputs */
+    GPIOPinTypeGPIOInput(config->port, ch->pins);
+
+    /* Configure with weak pull-up (comparator outputs might be open-drain) */
+    GPIOPadConfigSet(config->port, ch->pins,
+                     GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
+
+    /* Configure interrupts on BOTH edges for both pins */
+    GPIOIntTypeSet(config->port, ch->pins, GPIO_BOTH_EDGES);
+
+    /* Clear any pending interrupts */
+    GPIOIntClear(config->port, ch->pins);
+
     /* Read initial state */
-    uint8_t s1 = GPIOPinRead(S1_PORT, S1_PIN) ? 1 : 0;
-    uint8_t s2 = GPIOPinRead(S2_PORT, S2_PIN) ? 1 : 0;
-    last_state = (s1 << 1) | s2;
-    last_edge_time = TimerValueGet(EDGE_TIMER_BASE, TIMER_A);
-    
+    now = TimerValueGet(EDGE_TIMER_BASE, TIMER_A);
+    ch->lastState = ReadState(ch);
+    ch->lastEdgeTime = now;
+    ch->acceptedEdgeTime = now;
+
     /* Initialize variables */
-    edge_period = 0;
-    new_edge_detected = 0;
-    direction_counter = 0;
-    edge_count = 0;
-    last_edge_count = 0;
-    interrupt_count = 0;
-    current_speed_kmh = 0.0f;
-    accumulated_distance = 0.0f;
-    current_direction = DIR_STOPPED;
-    
+    ch->directionCounter = 0;
+    ch->edgeCount = 0;
+    ch->interruptCount = 0;
+    ch->ringHead = 0;
+    ch->ringTail = 0;
+    ch->ringOverflows = 0;
+    ch->thresholdHook = 0;
+    ch->thresholdRpm = 0;
+    ch->direction = DIR_STOPPED;
+    ch->speedKmh = 0.0f;
+    ch->rpm = 0.0f;
+    ch->distance = 0.0f;
+    ch->distanceBase = 0.0f;
+    ch->distanceEdgeBase = 0;
+    ch->processEdgeCount = 0;
+
     /* Initialize time-based calculation references */
-    last_display_edge_count = 0;
-    last_display_time = TimerValueGet(EDGE_TIMER_BASE, TIMER_A);
-    
-    /* Clear speed and RPM filters */
-    for (int i = 0; i < SPEED_FILTER_SIZE; i++) {
-        speed_buffer[i] = 0.0f;
+    ch->windowEdgeCount = 0;
+    ch->windowTime = now;
+    ch->snapshot.rpm = 0.0f;
+    ch->snapshot.speedKmh = 0.0f;
+    ch->snapshot.distanceM = 0.0f;
+    ch->snapshot.direction = DIR_STOPPED;
+    ch->snapshot.accelRpmPerSec = 0.0f;
+    ch->snapshot.windowRpm = 0.0f;
+    ch->snapshot.rpmStdDev = 0.0f;
+    ch->snapshot.time = ~now;
+    ch->snapshot.edgeTime = ~now;
+    ch->snapshot.updates = 0;
+
+    /* Default rate filter */
+    Filter_Configure(&ch->filter, DEFAULT_FILTER,
+                     sizeof(DEFAULT_FILTER) / sizeof(DEFAULT_FILTER[0]));
+    ch->rate = 0.0f;
+
+    /* Default tracker */
+    TrackerConfig tracker_config = { SENSOR_TRACKER_PROCESS_NOISE,
+                                     SENSOR_TRACKER_MEASUREMENT_NOISE };
+    Tracker_Init(&ch->tracker, &tracker_config, timerFreq, ch->revEdges);
+    Poles_Init(&ch->poles, timerFreq, ch->revEdges);
+    ch->polesDirection = DIR_STOPPED;
+    ch->estimator = SENSOR_ESTIMATOR_WINDOW;
+
+    /* In the table before the first edge can reach the handler */
+    channelCount++;
+
+    /* Enable GPIO interrupts for both pins */
+    GPIOIntEnable(config->port, ch->pins);
+
+    /* Register the ISR with NVIC - CRITICAL for TM4C1294! */
+    /* Set interrupt priorities to HIGHEST (0x00 = highest, 0xE0 = lowest) */
+    /* CRITICAL: Sensor timing is most important - must not be delayed */
+    IntRegister(config->irqA, SensorGpioIntHandler);
+    IntPrioritySet(config->irqA, 0x00);
+    IntEnable(config->irqA);
+    if (config->irqB != config->irqA) {
+        IntRegister(config->irqB, SensorGpioIntHandler);
+        IntPrioritySet(config->irqB, 0x00);
+        IntEnable(config->irqB);
     }
-    speed_filter_index = 0;
-    speed_filter_count = 0;
 
-    for (int i = 0; i < RPM_FILTER_SIZE; i++) {
-        rpm_buffer[i] = 0.0f;
+    return id;
+}
+
+uint32_t Sensor_Now(void)
+{
+    return ~TimerValueGet(EDGE_TIMER_BASE, TIMER_A);
+}
+
+/* ============== Processing Tick (sensor task) ============== */
+/* Edges dropped from the ring: the consumers of consecutive edges start over */
+static void ResyncEdges(SensorChannel *ch, bool calibrating)
+{
+    Tracker_Reset(&ch->tracker);
+    Poles_Resync(&ch->poles);
+    if (calibrating) {
+        Calib_Start(&calib);
     }
-    rpm_filter_index = 0;
-    rpm_filter_count = 0;
-    
-    //printf("Sensor_Init complete\n");
-   // printf("  S1 on P0, S2 on P1\n");
-   // printf("  Initial state: S1=%d, S2=%d (combined=%d)\n", s1, s2, last_state);
-   // printf("  Using per-pin interrupts: INT_GPIOP0=%d, INT_GPIOP1=%d\n", 
-        //   INT_GPIOP0, INT_GPIOP1);
-   // printf("  Timer frequency: 120 MHz\n");
-   // printf("  Edges per rotation: %.1f\n", EDGES_PER_ROTATION);
-   // printf("  Wheel circumference: %.4f m\n", WHEEL_CIRCUMFERENCE);
 }
 
-/* ============== Get Speed (call from main loop) ============== */
-float Sensor_GetSpeed(void)
+static void ProcessChannel(SensorChannel *ch, uint32_t current_time)
 {
-    static uint32_t call_count = 0;
-    static uint32_t last_int_count = 0;
-    uint32_t int_copy;
     uint32_t edge_copy;
     int32_t dir_copy;
-    uint32_t current_time;
-    
-    /* Get current timer value for time-based calculation */
-    current_time = TimerValueGet(EDGE_TIMER_BASE, TIMER_A);
-    
+    uint32_t head_copy;
+    uint32_t last_edge_copy;
+    float tracker_rate;
+    float edge_rate;
+    bool calibrating = (ch - channels) == calibChannel && calib.state == CALIB_RECORDING;
+
     /* Atomic read of volatile variables */
     IntMasterDisable();
-    int_copy = interrupt_count;
-    edge_copy = edge_count;
-    dir_copy = direction_counter;
+    edge_copy = ch->edgeCount;
+    dir_copy = ch->directionCounter;
+    head_copy = ch->ringHead;
+    last_edge_copy = ch->acceptedEdgeTime;
     IntMasterEnable();
-    
-    /* Debug output every ~500 calls */
-    call_count++;
-    if (call_count >= 500) {
-        uint8_t s1 = GPIOPinRead(S1_PORT, S1_PIN) ? 1 : 0;
-        uint8_t s2 = GPIOPinRead(S2_PORT, S2_PIN) ? 1 : 0;
-       // printf("[DBG] Int:%lu Edges:%lu DirCnt:%ld S1=%d S2=%d\n",
-       //        (unsigned long)int_copy, 
-       //       (unsigned long)edge_copy,
-       //        (long)dir_copy,
-       //       s1, s2);
-        last_int_count = int_copy;
-        call_count = 0;
+
+    /* Tracker and pole table: every edge since the last tick, in order.
+     * Too far behind, the ring has wrapped: restart the track on the
+     * edges left, and find the pole position again. The ISR keeps
+     * writing while this drains, so leave it one free slot, and drop
+     * the rest of the backlog if it still catches up with the tail. */
+    if (head_copy - ch->ringTail > SENSOR_EDGE_RING - 1) {
+        ch->ringOverflows += head_copy - ch->ringTail - (SENSOR_EDGE_RING - 1);
+        ch->ringTail = head_copy - (SENSOR_EDGE_RING - 1);
+        ResyncEdges(ch, calibrating);
+    }
+    while (ch->ringTail != head_copy) {
+        /* Both volatile, so the slot is read before the head is checked */
+        uint32_t period = ch->edgeRing[ch->ringTail % SENSOR_EDGE_RING];
+        if (ch->ringHead - ch->ringTail >= SENSOR_EDGE_RING) {
+            /* Overwritten while being read */
+            ch->ringOverflows += head_copy - ch->ringTail;
+            ch->ringTail = head_copy;
+            ResyncEdges(ch, calibrating);
+            break;
+        }
+        Tracker_Edge(&ch->tracker, period);
+        Poles_Edge(&ch->poles, period);
+        if (calibrating) {
+            Calib_Edge(&calib, period);
+        }
+        ch->ringTail++;
     }
-    
+    /* Timer counts DOWN; wraps are modulo 2^32 like the counter. An edge
+     * after current_time was read counts as just now. */
+    uint32_t since_edge = last_edge_copy - current_time;
+    if ((int32_t)since_edge < 0) {
+        since_edge = 0;
+    }
+    tracker_rate = Tracker_Rate(&ch->tracker, since_edge);
+    edge_rate = Poles_Rate(&ch->poles, since_edge);
+
     /*
-     * NEW APPROACH: Calculate speed from edge count over time interval
+     * Speed from edge count over time interval
      * This is more reliable than single-edge period measurement
-     * 
-     * Speed = (edges_delta / EDGES_PER_ROTATION) * WHEEL_CIRCUMFERENCE / time_delta
+     *
+     * Speed = (edges_delta / edgesPerRev) * circumference / time_delta
      */
-    
-    /* Calculate edges since last display update */
-    uint32_t edges_delta = edge_copy - last_display_edge_count;
-    
-    /* Calculate time since last display (timer counts DOWN) */
-    uint32_t time_delta;
-    if (last_display_time >= current_time) {
-        time_delta = last_display_time - current_time;
-    } else {
-        time_delta = last_display_time + (0xFFFFFFFFUL - current_time) + 1;
-    }
-    
-    /* Only update if enough time has passed for accurate measurement (at least 100ms) */
-    if (time_delta >= MIN_UPDATE_INTERVAL && edges_delta > 0) {
-        /* Calculate time in seconds */
-        float time_seconds = (float)time_delta / TIMER_FREQ;
-
-        /* Calculate rotations */
-        float rotations = (float)edges_delta / EDGES_PER_ROTATION;
-
-        /* Calculate RPM: (rotations / time) * 60 */
-        float rpm = (rotations / time_seconds) * 60.0f;
-
-        /* Debug: Print calculation details occasionally */
-        static uint32_t calc_count = 0;
-        calc_count++;
-        /*
-        if (calc_count % 5 == 0) {
-            printf("[CALC] Edges=%lu TimeMs=%.1f RPM=%.1f\n",
-                   (unsigned long)edges_delta,
-                   time_seconds * 1000.0f,
-                   rpm);
-        }
-        */
-        /* Calculate speed: rotations * circumference / time = m/s */
-        float velocity_mps = (rotations * WHEEL_CIRCUMFERENCE) / time_seconds;
-
-        /* Convert to km/h */
-        float velocity_kmh = velocity_mps * 3.6f;
-        
-        /* Sanity check for speed */
-        if (velocity_kmh > 200.0f) {
-            velocity_kmh = current_speed_kmh; /* Keep previous value */
-        } else if (velocity_kmh < 0.0f) {
-            velocity_kmh = 0.0f;
-        }
 
-        /* Sanity check for RPM - allow values above 20k up to display max */
-        if (rpm > 99999.0f) {
-            rpm = 99999.0f; /* Clamp to display maximum (5 digits) */
-        } else if (rpm < 0.0f) {
-            rpm = 0.0f;
-        }
+    /* Calculate edges since the window opened */
+    uint32_t edges_delta = edge_copy - ch->windowEdgeCount;
 
-        /* Apply moving average filter to speed */
-        speed_buffer[speed_filter_index] = velocity_kmh;
-        speed_filter_index = (speed_filter_index + 1) % SPEED_FILTER_SIZE;
-        if (speed_filter_count < SPEED_FILTER_SIZE) {
-            speed_filter_count++;
-        }
+    /* Calculate time since the window opened (timer counts DOWN) */
+    uint32_t time_delta = ch->windowTime - current_time;
 
-        /* Calculate average speed */
-        float speed_sum = 0.0f;
-        for (int i = 0; i < speed_filter_count; i++) {
-            speed_sum += speed_buffer[i];
+    /* Direction with hysteresis, as soon as edges arrive */
+    if (edge_copy != ch->processEdgeCount) {
+        RotationDirection previous = ch->direction;
+        if (dir_copy > DIRECTION_THRESHOLD) {
+            ch->direction = DIR_FORWARD;
+        } else if (dir_copy < -DIRECTION_THRESHOLD) {
+            ch->direction = DIR_REVERSE;
         }
-        current_speed_kmh = speed_sum / (float)speed_filter_count;
+        /* Otherwise keep current direction (hysteresis) */
+        ch->processEdgeCount = edge_copy;
 
-        /* Apply moving average filter to RPM */
-        rpm_buffer[rpm_filter_index] = rpm;
-        rpm_filter_index = (rpm_filter_index + 1) % RPM_FILTER_SIZE;
-        if (rpm_filter_count < RPM_FILTER_SIZE) {
-            rpm_filter_count++;
+        /* Reversed, the pole pattern runs backwards */
+        if (calibrating && previous != DIR_STOPPED && ch->direction != previous) {
+            Calib_Start(&calib);
         }
-
-        /* Calculate average RPM - this is the smoothed value shown in display */
-        float rpm_sum = 0.0f;
-        for (int i = 0; i < rpm_filter_count; i++) {
-            rpm_sum += rpm_buffer[i];
+        if (ch->direction != DIR_STOPPED && ch->direction != ch->polesDirection) {
+            Poles_Reset(&ch->poles);
+            ch->polesDirection = ch->direction;
         }
-        current_rpm = rpm_sum / (float)rpm_filter_count;
-        
-        /* Update direction with hysteresis */
-        if (dir_copy > DIRECTION_THRESHOLD) {
-            current_direction = DIR_FORWARD;
-        } else if (dir_copy < -DIRECTION_THRESHOLD) {
-            current_direction = DIR_REVERSE;
+    }
+
+    /* Only update if enough time has passed for accurate measurement (at least 100ms) */
+    if (time_delta >= minUpdateInterval && edges_delta > 0) {
+        /* One divide, by the window length, then multiplies: the filter
+         * charges its own */
+        COST_CHARGE(COST_FLOAT_DIV + 6 * COST_FLOAT_OP);
+
+        /* Edge rate over the window, edges per second */
+        float rate = (float)edges_delta * timerFreq / (float)time_delta;
+
+        /* Sanity check: a glitch keeps the previous reading */
+        if (rate <= ch->maxRate) {
+            ch->rate = Filter_Apply(&ch->filter, rate);
         }
-        /* Otherwise keep current direction (hysteresis) */
-        
-        /* Update distance */
-        accumulated_distance += rotations * WHEEL_CIRCUMFERENCE;
-        
+
         /* Reset counters for next interval */
-        last_display_edge_count = edge_copy;
-        last_display_time = current_time;
-        
-    } else if (time_delta > STOPPED_TIMEOUT) {
-        /* No edges for too long - motor stopped */
-        current_speed_kmh = 0.0f;
-        current_rpm = 0.0f;
-        current_direction = DIR_STOPPED;
+        ch->windowEdgeCount = edge_copy;
+        ch->windowTime = current_time;
 
-        /* Clear speed and RPM filters */
-        for (int i = 0; i < SPEED_FILTER_SIZE; i++) {
-            speed_buffer[i] = 0.0f;
+    } else if (time_delta > stoppedTimeout) {
+        /* No edges for too long - motor stopped */
+        if (ch->thresholdAbove && ch->thresholdHook) {
+            IntMasterDisable();
+            ch->revCount = 0;
+            ch->revSum = 0;
+            for (int i = 0; i < ch->revEdges; i++) {
+                ch->revPeriods[i] = 0;
+            }
+            ch->thresholdAbove = 0;
+            IntMasterEnable();
+            ch->thresholdHook((uint8_t)(ch - channels), 0);
         }
-        speed_filter_count = 0;
-
-        for (int i = 0; i < RPM_FILTER_SIZE; i++) {
-            rpm_buffer[i] = 0.0f;
+        ch->rate = 0.0f;
+        tracker_rate = 0.0f;
+        edge_rate = 0.0f;
+        ch->direction = DIR_STOPPED;
+
+        /* Start the filter, the track and any recording afresh; the first
+         * edge after the stop is rejected, so the pole position is lost */
+        Filter_Reset(&ch->filter);
+        Tracker_Reset(&ch->tracker);
+        Poles_Resync(&ch->poles);
+        if (calibrating) {
+            Calib_Start(&calib);
         }
-        rpm_filter_count = 0;
 
         /* Reset reference point */
-        last_display_edge_count = edge_copy;
-        last_display_time = current_time;
+        ch->windowEdgeCount = edge_copy;
+        ch->windowTime = current_time;
+    }
+
+    /* Speed and RPM from the selected estimator's rate */
+    float rate;
+    switch (ch->estimator) {
+    case SENSOR_ESTIMATOR_TRACKER:
+        rate = tracker_rate;
+        break;
+    case SENSOR_ESTIMATOR_EDGE:
+        rate = edge_rate;
+        break;
+    default:
+        rate = ch->rate;
+        break;
+    }
+    COST_CHARGE(3 * COST_FLOAT_OP);
+    ch->speedKmh = rate * ch->rateToKmh;
+    ch->rpm = rate * ch->rateToRpm;
+    if (ch->rpm > 99999.0f) {
+        ch->rpm = 99999.0f; /* Clamp to display maximum (5 digits) */
+    }
+
+    /* Distance from the edge count itself: exact at any tick rate */
+    COST_CHARGE(3 * COST_FLOAT_OP);
+    ch->distance = ch->distanceBase
+                 + (float)(edge_copy - ch->distanceEdgeBase) * ch->edgesToMeters;
+
+    /* Calibration analysis, one step per tick once recorded */
+    if ((ch - channels) == calibChannel) {
+        Calib_Step(&calib);
     }
-    
-    return current_speed_kmh;
+
+    /* Publish for the display */
+    ch->snapshot.rpm = ch->rpm;
+    ch->snapshot.speedKmh = ch->speedKmh;
+    ch->snapshot.distanceM = ch->distance;
+    ch->snapshot.direction = ch->direction;
+    ch->snapshot.accelRpmPerSec = Tracker_Accel(&ch->tracker) * ch->rateToRpm;
+    ch->snapshot.windowRpm = ch->rate * ch->rateToRpm;
+    ch->snapshot.rpmStdDev = Tracker_RateStdDev(&ch->tracker) * ch->rateToRpm;
+    ch->snapshot.time = ~current_time;
+    ch->snapshot.edgeTime = ~last_edge_copy;
+    ch->snapshot.updates++;
+}
+
+void Sensor_Process(void)
+{
+    /* One timebase reading for every channel */
+    uint32_t current_time = TimerValueGet(EDGE_TIMER_BASE, TIMER_A);
+    uint8_t i;
+
+    for (i = 0; i < channelCount; i++) {
+        ProcessChannel(&channels[i], current_time);
+    }
+}
+
+/* ============== Encoder Geometry ============== */
+bool Sensor_SetEncoder(uint8_t channel, uint8_t edgesPerRev, float circumferenceM)
+{
+    SensorChannel *ch;
+    bool above;
+
+    if (channel >= channelCount || !EncoderValid(edgesPerRev, circumferenceM))
+        return false;
+    ch = &channels[channel];
+
+    /* Distance so far in the old geometry, the rest in the new */
+    ch->distanceBase = ch->distance;
+    ch->distanceEdgeBase = ch->processEdgeCount;
+
+    /* The ISR's revolution sum depends on revEdges */
+    IntMasterDisable();
+    above = ch->thresholdAbove && ch->thresholdHook;
+    ch->config.edgesPerRev = edgesPerRev;
+    ch->config.circumferenceM = circumferenceM;
+    ApplyEncoder(ch);
+    ResetThreshold(ch);
+    IntMasterEnable();
+    if (above) {
+        ch->thresholdHook(channel, 0);
+    }
+
+    /* Rates in the old edges per revolution are meaningless now */
+    Filter_Reset(&ch->filter);
+    ch->rate = 0.0f;
+    Tracker_Init(&ch->tracker, &ch->tracker.config, timerFreq, ch->revEdges);
+    Poles_Init(&ch->poles, timerFreq, ch->revEdges);
+    return true;
+}
+
+/* ============== Edges-per-Revolution Calibration ============== */
+bool Sensor_StartCalibration(uint8_t channel)
+{
+    if (channel >= channelCount)
+        return false;
+    calibChannel = channel;
+    Calib_Start(&calib);
+    return true;
+}
+
+CalibState Sensor_GetCalibration(uint8_t channel, CalibResult *result)
+{
+    if (channel != calibChannel)
+        return CALIB_IDLE;
+    if (result)
+        *result = calib.result;
+    return calib.state;
+}
+
+void Sensor_CancelCalibration(void)
+{
+    Calib_Cancel(&calib);
+    calibChannel = SENSOR_NONE;
+}
+
+/* ============== Rate Filter ============== */
+bool Sensor_SetFilter(uint8_t channel, const FilterStageConfig *stages, uint8_t count)
+{
+    if (channel >= channelCount)
+        return false;
+    return Filter_Configure(&channels[channel].filter, stages, count);
+}
+
+/* ============== Estimator ============== */
+void Sensor_SetEstimator(uint8_t channel, SensorEstimator which)
+{
+    if (channel < channelCount)
+        channels[channel].estimator = which;
+}
+
+void Sensor_SetTracker(uint8_t channel, const TrackerConfig *config)
+{
+    if (channel < channelCount)
+        Tracker_Init(&channels[channel].tracker, config, timerFreq, channels[channel].revEdges);
+}
+
+/* ============== Get Snapshot ============== */
+void Sensor_GetSnapshot(uint8_t channel, SensorSnapshot *snap)
+{
+    if (channel < channelCount)
+        *snap = channels[channel].snapshot;
+}
+
+/* ============== Get Speed ============== */
+float Sensor_GetSpeed(uint8_t channel)
+{
+    return channel < channelCount ? channels[channel].speedKmh : 0.0f;
+}
+
+/* ============== RPM Threshold Hook ============== */
+void Sensor_SetRPMThresholdHook(uint8_t channel, uint32_t rpm, uint32_t hysteresis_rpm,
+                                SensorThresholdHook hook)
+{
+    uint32_t off_rpm = (hysteresis_rpm < rpm) ? rpm - hysteresis_rpm : 1;
+    SensorChannel *ch;
+
+    if (channel >= channelCount)
+        return;
+    ch = &channels[channel];
+
+    IntMasterDisable();
+    ch->thresholdRpm = rpm;
+    ch->thresholdOffRpm = off_rpm;
+    ResetThreshold(ch);
+    ch->thresholdHook = hook;
+    IntMasterEnable();
 }
 
 /* ============== Get Direction ============== */
-RotationDirection Sensor_GetDirection(void)
+RotationDirection Sensor_GetDirection(uint8_t channel)
 {
-    return current_direction;
+    return channel < channelCount ? channels[channel].direction : DIR_STOPPED;
 }
 
 /* ============== Get Distance ============== */
-float Sensor_GetDistance(void)
+float Sensor_GetDistance(uint8_t channel)
 {
-    return accumulated_distance;
+    return channel < channelCount ? channels[channel].distance : 0.0f;
 }
 
 /* ============== Reset Distance ============== */
-void Sensor_ResetDistance(void)
+void Sensor_ResetDistance(uint8_t channel)
 {
-    accumulated_distance = 0.0f;
+    SensorChannel *ch;
+
+    if (channel >= channelCount)
+        return;
+    ch = &channels[channel];
+    ch->distanceEdgeBase = ch->edgeCount;
+    ch->distanceBase = 0.0f;
+    ch->distance = 0.0f;
+    ch->snapshot.distanceM = 0.0f;
 }
 
 /* ============== Debug: Get Raw Interrupt Count ============== */
-uint32_t Sensor_GetInterruptCount(void)
+uint32_t Sensor_GetInterruptCount(uint8_t channel)
 {
-    return interrupt_count;
+    return channel < channelCount ? channels[channel].interruptCount : 0;
 }
 
 /* ============== Debug: Get Edge Count ============== */
-uint32_t Sensor_GetEdgeCount(void)
+uint32_t Sensor_GetEdgeCount(uint8_t channel)
+{
+    return channel < channelCount ? channels[channel].edgeCount : 0;
+}
+
+/* ============== Debug: Get Edge Ring Overflows ============== */
+uint32_t Sensor_GetEdgeOverflows(uint8_t channel)
 {
-    return edge_count;
+    return channel < channelCount ? channels[channel].ringOverflows : 0;
 }
 
 /* ============== Get RPM ============== */
-float Sensor_GetRPM(void)
+float Sensor_GetRPM(uint8_t channel)
 {
-    return current_rpm;
+    return channel < channelCount ? channels[channel].rpm : 0.0f;
 }
\ No newline at end of file
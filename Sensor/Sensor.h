@@ -1,14 +1,24 @@
 /**
  * Sensor.h - KMZ60 Quadrature Encoder Interface
- * 
- * For TM4C1294NCPDT with KMZ60 magnetic sensor
- * S1 on Port P0, S2 on Port P1
+ *
+ * For TM4C1294NCPDT with KMZ60 magnetic sensors
+ * Up to SENSOR_MAX_CHANNELS encoders (drive motor, wheels), each a
+ * quadrature pair S1/S2 on one GPIO port, all timestamped by one shared
+ * timebase (Timer2 at the system clock) so their readings line up
  */
 
 #ifndef SENSOR_H
 #define SENSOR_H
 
 #include <stdint.h>
+#include <stdbool.h>
+#include "filter.h"
+#include "tracker.h"
+#include "calib.h"
+#include "poles.h"
+
+#define SENSOR_MAX_CHANNELS 3
+#define SENSOR_NONE         0xFF    /* Sensor_AddChannel() table full or bad config */
 
 /* Direction enumeration */
 typedef enum {
@@ -17,52 +27,196 @@ typedef enum {
     DIR_REVERSE = -1
 } RotationDirection;
 
+/* Rate of Sensor_Process() calls the estimator is written for. The
+ * measurement window itself stays 100 ms; the tick only bounds how late
+ * a window closes and how stale the snapshot can be. */
+#define SENSOR_PROCESS_HZ   1000
+
+/* Source of the published speed and RPM */
+typedef enum {
+    SENSOR_ESTIMATOR_WINDOW,    /* edges per 100 ms window, rate filter chain */
+    SENSOR_ESTIMATOR_TRACKER,   /* per-edge Kalman tracker (Sensor/tracker.h) */
+    SENSOR_ESTIMATOR_EDGE       /* last edge period, pole spacing learnt (Sensor/poles.h) */
+} SensorEstimator;
+
+/* Default tracker tuning, in edges per second (tools/estimator_bench.c):
+ * a high gain, so a step is followed in a few edges without overshoot */
+#define SENSOR_TRACKER_PROCESS_NOISE        1e9f
+#define SENSOR_TRACKER_MEASUREMENT_NOISE    3e-4f
+
+/* One encoder */
+typedef struct {
+    const char *name;
+    uint32_t periph;            /* GPIO port clock (SYSCTL_PERIPH_GPIOx) */
+    uint32_t port;
+    uint8_t pinA;               /* S1 */
+    uint8_t pinB;               /* S2 */
+    uint32_t irqA;              /* NVIC line of pinA; equal to irqB unless */
+    uint32_t irqB;              /* the port has per-pin interrupts (port P) */
+    uint8_t edgesPerRev;        /* both edges of S1 and S2: 4 per pole pair */
+    float circumferenceM;       /* wheel or roller driven by the encoder */
+} SensorChannelConfig;
+
+/* Latest estimates of one channel, published by Sensor_Process() */
+typedef struct {
+    float rpm;
+    float speedKmh;
+    float distanceM;
+    RotationDirection direction;
+    float accelRpmPerSec;       /* tracker, whichever estimator is selected */
+    float rpmStdDev;            /* tracker: standard deviation of its RPM */
+    float windowRpm;            /* window and filter chain, whichever estimator is
+                                 * selected: no overshoot, for alarm thresholds */
+    uint32_t time;              /* timebase at this Sensor_Process() call */
+    uint32_t edgeTime;          /* timebase at the last accepted edge */
+    uint32_t updates;           /* Sensor_Process() calls so far */
+} SensorSnapshot;
+
+/**
+ * Start the shared timebase (Timer2, free running at the system clock,
+ * timerHz as returned by SysCtlClockFreqSet()). Call once, before the
+ * first Sensor_AddChannel().
+ */
+void Sensor_Init(uint32_t timerHz);
+
+/**
+ * Configure an encoder's pins and interrupts at the highest priority.
+ * Returns the channel id passed to the other calls, or SENSOR_NONE.
+ */
+uint8_t Sensor_AddChannel(const SensorChannelConfig *config);
+
+/**
+ * Change a channel's encoder geometry at run time, for the magnet count
+ * and wheel of this installation: edges per revolution
+ * (1..TRACKER_MAX_EDGES_PER_REV) and circumference in meters. The scale
+ * factors are worked out here, so Sensor_Process() only multiplies.
+ * Restarts the estimators and the threshold hook; the distance so far is
+ * kept. Returns false, keeping the old geometry, if either is out of
+ * range. Main loop context.
+ */
+bool Sensor_SetEncoder(uint8_t channel, uint8_t edgesPerRev, float circumferenceM);
+
+/**
+ * Timebase ticks, counting up; the clock of SensorSnapshot.time
+ */
+uint32_t Sensor_Now(void);
+
+/**
+ * Update speed, RPM, filters, direction and distance of every channel
+ * from the edges counted so far, then publish the snapshots, all at one
+ * timebase reading
+ * Call from one periodic task at SENSOR_PROCESS_HZ, independent of
+ * the display refresh
+ */
+void Sensor_Process(void);
+
+/**
+ * Replace the filter chain (Sensor/filter.h) applied to each window's
+ * edge rate; speed and RPM are scaled from its output. Default: a
+ * 3-sample moving average. Resets the filter; returns false, keeping the
+ * old chain, if a stage is invalid. Main loop context.
+ */
+bool Sensor_SetFilter(uint8_t channel, const FilterStageConfig *stages, uint8_t count);
+
 /**
- * Initialize the KMZ60 sensor using S1/S2 comparator outputs
- * Sets up GPIO, Timer, and per-pin interrupts for Port P
+ * Choose the estimator behind speed and RPM. All of them always run; the
+ * default is SENSOR_ESTIMATOR_WINDOW. Main loop context.
  */
-void Sensor_Init(void);
+void Sensor_SetEstimator(uint8_t channel, SensorEstimator estimator);
 
 /**
- * Get current speed in km/h
- * IMPORTANT: Call this FIRST - it calculates both speed and RPM internally
- * Call this regularly from main loop to update calculations
+ * Retune the tracker (rates in edges per second) and reset it. Main loop
+ * context.
+ */
+void Sensor_SetTracker(uint8_t channel, const TrackerConfig *config);
+
+/**
+ * Work out a channel's edges per revolution from its pole pattern
+ * (Sensor/calib.h): record CALIB_EDGES consecutive edges at a steady or
+ * slowly changing speed, then analyse them a step per Sensor_Process()
+ * call. Measurement carries on as usual. One channel at a time: starting
+ * another cancels the first. A stop, a reversal or edges lost to the
+ * ring restart the recording. Main loop context.
+ */
+bool Sensor_StartCalibration(uint8_t channel);
+
+/**
+ * Calibration state of the channel (CALIB_IDLE unless it is the one
+ * being calibrated) and, once CALIB_DONE, the proposal to pass to
+ * Sensor_SetEncoder()
+ */
+CalibState Sensor_GetCalibration(uint8_t channel, CalibResult *result);
+
+/**
+ * Stop calibrating, whichever channel it was
+ */
+void Sensor_CancelCalibration(void);
+
+/**
+ * Copy the snapshot left by the last Sensor_Process() call
+ * Main loop context (same as Sensor_Process())
+ */
+void Sensor_GetSnapshot(uint8_t channel, SensorSnapshot *snap);
+
+/**
+ * Get current speed in km/h as of the last Sensor_Process() call
  * Returns 0 if motor is stopped
  */
-float Sensor_GetSpeed(void);
+float Sensor_GetSpeed(uint8_t channel);
 
 /**
- * Get current speed in RPM
- * IMPORTANT: Call Sensor_GetSpeed() FIRST before calling this
- * Returns the RPM value calculated by the last Sensor_GetSpeed() call
+ * Get current speed in RPM as of the last Sensor_Process() call
  * Returns 0 if motor is stopped
  */
-float Sensor_GetRPM(void);
+float Sensor_GetRPM(uint8_t channel);
 
 /**
  * Get accumulated distance in meters
  */
-float Sensor_GetDistance(void);
+float Sensor_GetDistance(uint8_t channel);
 
 /**
  * Reset accumulated distance to zero
  */
-void Sensor_ResetDistance(void);
+void Sensor_ResetDistance(uint8_t channel);
 
 /**
  * Get current rotation direction
  * Returns DIR_FORWARD, DIR_REVERSE, or DIR_STOPPED
  */
-RotationDirection Sensor_GetDirection(void);
+RotationDirection Sensor_GetDirection(uint8_t channel);
+
+/**
+ * RPM threshold crossing callback, invoked from the edge ISR
+ * above: 1 when the rate rose past the threshold, 0 when it fell back
+ * Must be very short (e.g. post a fast-lane render job).
+ */
+typedef void (*SensorThresholdHook)(uint8_t channel, uint8_t above);
+
+/**
+ * Register a threshold-crossing hook evaluated on every accepted edge
+ * The rate is taken over the last full revolution of edges, so pole
+ * spacing errors cancel. Fires again (above = 0) once the rate drops
+ * below rpm - hysteresis_rpm, or when the motor is detected stopped.
+ * Pass hook = 0 to disable.
+ */
+void Sensor_SetRPMThresholdHook(uint8_t channel, uint32_t rpm, uint32_t hysteresis_rpm,
+                                SensorThresholdHook hook);
 
 /**
  * Debug: Get total interrupt count
  */
-uint32_t Sensor_GetInterruptCount(void);
+uint32_t Sensor_GetInterruptCount(uint8_t channel);
 
 /**
  * Debug: Get total edge count
  */
-uint32_t Sensor_GetEdgeCount(void);
+uint32_t Sensor_GetEdgeCount(uint8_t channel);
+
+/**
+ * Debug: edges the tracker missed because Sensor_Process() fell
+ * SENSOR_EDGE_RING or more edges behind
+ */
+uint32_t Sensor_GetEdgeOverflows(uint8_t channel);
 
 #endif /* SENSOR_H */
\ No newline at end of file
@@ -0,0 +1,122 @@
+/**
+ * calib.c - Edges-per-revolution calibration from the edge periods
+ */
+
+#include "calib.h"
+#include "profile/costmodel.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+void Calib_Start(Calib *c)
+{
+    c->state = CALIB_RECORDING;
+    c->count = 0;
+    c->patternLength = 0;
+    c->lag = 0;
+    c->energy = 0.0f;
+    c->result.edgesPerRev = 0;
+    c->result.correlation = 0.0f;
+    c->result.spread = 0.0f;
+}
+
+void Calib_Cancel(Calib *c)
+{
+    c->state = CALIB_IDLE;
+}
+
+void Calib_Edge(Calib *c, uint32_t period)
+{
+    if (c->state != CALIB_RECORDING)
+        return;
+    c->samples[c->count++] = (float)period;
+    if (c->count == CALIB_EDGES)
+        c->state = CALIB_ANALYSING;
+}
+
+// Each period over the moving average of the 2 * CALIB_TREND_EDGES + 1
+// around it, less 1, written in place from the start of the buffer:
+// the pole pattern with the speed taken out
+static void detrend(Calib *c)
+{
+    const uint16_t w = CALIB_TREND_EDGES;
+    const float span = (float)(2 * w + 1);
+    float sum = 0.0f, energy = 0.0f;
+    uint16_t i;
+
+    for (i = 0; i <= 2 * w; i++)
+        sum += c->samples[i];
+    for (i = w; i + w < CALIB_EDGES; i++) {
+        float oldest = c->samples[i - w];
+        float r = c->samples[i] * span / sum - 1.0f;
+
+        c->samples[i - w] = r;
+        energy += r * r;
+        if (i + w + 1 < CALIB_EDGES)
+            sum += c->samples[i + w + 1] - oldest;
+    }
+    COST_CHARGE(CALIB_EDGES * (COST_FLOAT_DIV + 6 * COST_FLOAT_OP));
+
+    c->patternLength = CALIB_EDGES - 2 * w;
+    c->energy = energy;
+}
+
+// Normalised autocorrelation of the pattern at one shift: 1 when every
+// sample repeats `lag` edges later
+static float correlate(const Calib *c, uint8_t lag)
+{
+    uint16_t n = c->patternLength - lag;
+    float sum = 0.0f;
+    uint16_t i;
+
+    for (i = 0; i < n; i++)
+        sum += c->samples[i] * c->samples[i + lag];
+    COST_CHARGE(n * (2 * COST_FLOAT_OP + COST_LOOP_ITER) + COST_FLOAT_DIV);
+
+    return (sum / n) / (c->energy / c->patternLength);
+}
+
+// The shortest shift that repeats nearly as well as the best one
+static void propose(Calib *c)
+{
+    float best = 0.0f;
+    uint8_t lag;
+
+    for (lag = 1; lag <= CALIB_MAX_LAG; lag++) {
+        if (c->correlation[lag] > best)
+            best = c->correlation[lag];
+    }
+    if (best < CALIB_MIN_CORRELATION) {
+        c->state = CALIB_FAILED;
+        return;
+    }
+    for (lag = 1; c->correlation[lag] < CALIB_HARMONIC_RATIO * best; lag++) {}
+
+    c->result.edgesPerRev = lag;
+    c->result.correlation = c->correlation[lag];
+    c->result.spread = sqrtf(c->energy / c->patternLength);
+    c->state = CALIB_DONE;
+}
+
+CalibState Calib_Step(Calib *c)
+{
+    if (c->state != CALIB_ANALYSING)
+        return c->state;
+
+    if (c->lag == 0) {
+        detrend(c);
+        // A pattern of zeros (a clock-perfect trace) repeats trivially
+        if (c->energy <= 0.0f) {
+            c->state = CALIB_FAILED;
+            return c->state;
+        }
+    } else {
+        c->correlation[c->lag] = correlate(c, c->lag);
+        if (c->lag == CALIB_MAX_LAG) {
+            propose(c);
+            return c->state;
+        }
+    }
+    c->lag++;
+    return c->state;
+}
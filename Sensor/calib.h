@@ -0,0 +1,85 @@
+/**
+ * calib.h - Edges-per-revolution calibration from the edge periods
+ *
+ * No two magnet poles are spaced alike, so the edge periods of a
+ * spinning rotor repeat with the revolution: the edge after the pole
+ * that is a little wide is long every time round. Calibration records
+ * CALIB_EDGES consecutive edge periods, divides each by the moving
+ * average around it (the speed may drift meanwhile), and correlates the
+ * remaining pattern with itself shifted by 1..CALIB_MAX_LAG edges. The
+ * shortest shift at which the pattern repeats (correlation within
+ * CALIB_HARMONIC_RATIO of the best) is the proposed edges per
+ * revolution. Two, three... revolutions correlate as well; the shortest
+ * is taken.
+ *
+ * The pattern is only as unique as the poles are. Perfectly spaced
+ * poles leave nothing to correlate (CALIB_FAILED); near-identical pole
+ * pairs repeat every pole pair, so the proposal is then one pole pair
+ * (4 edges), not the revolution. Check a proposal against a known
+ * speed before relying on it.
+ *
+ * Recording takes one sample per edge; the analysis runs in steps, one
+ * shift per Calib_Step() call, so neither holds up the caller.
+ */
+
+#ifndef CALIB_H
+#define CALIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tracker.h"
+
+#define CALIB_EDGES             256     /* recorded periods */
+#define CALIB_MAX_LAG           TRACKER_MAX_EDGES_PER_REV
+#define CALIB_TREND_EDGES       CALIB_MAX_LAG       /* moving average half width */
+#define CALIB_MIN_CORRELATION   0.5f    /* weaker patterns are noise */
+#define CALIB_HARMONIC_RATIO    0.85f   /* shorter shift that still repeats */
+
+typedef enum {
+    CALIB_IDLE,
+    CALIB_RECORDING,
+    CALIB_ANALYSING,
+    CALIB_DONE,
+    CALIB_FAILED                // no repeating pattern above CALIB_MIN_CORRELATION
+} CalibState;
+
+typedef struct {
+    uint8_t edgesPerRev;        // proposal, 0 unless CALIB_DONE
+    float correlation;          // of the pattern at that shift, 1 = exact repeat
+    float spread;               // rms pole spacing error, fraction of a period
+} CalibResult;
+
+typedef struct {
+    CalibState state;
+    float samples[CALIB_EDGES]; // periods, then the detrended pattern
+    uint16_t count;
+    uint16_t patternLength;     // samples left after detrending
+    uint8_t lag;                // next shift to correlate
+    float energy;               // sum of squares of the pattern
+    float correlation[CALIB_MAX_LAG + 1];
+    CalibResult result;
+} Calib;
+
+/**
+ * Start (or restart) recording
+ */
+void Calib_Start(Calib *c);
+
+/**
+ * Stop; the state returns to CALIB_IDLE
+ */
+void Calib_Cancel(Calib *c);
+
+/**
+ * One accepted edge period, in timer ticks. Consecutive edges only: on
+ * a gap (missed edges, a stop) call Calib_Start() again.
+ */
+void Calib_Edge(Calib *c, uint32_t period);
+
+/**
+ * One step of the analysis once recording is complete: detrending, then
+ * one shift per call. Returns the state after the step.
+ */
+CalibState Calib_Step(Calib *c);
+
+#endif /* CALIB_H */
@@ -0,0 +1,146 @@
+/**
+ * filter.c - Configurable filter chain for one measured quantity
+ */
+
+#include "filter.h"
+#include "profile/costmodel.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// ============================================
+// Stages
+// ============================================
+
+// Running median: swap the outgoing sample for the new one in the
+// sorted copy, shifting the values in between
+static float median(FilterStage *s, float sample)
+{
+    uint8_t length = s->config.length;
+    uint8_t i;
+
+    if (s->count < length) {
+        i = s->count++;
+    } else {
+        float old = s->window[s->index];
+        for (i = 0; i + 1 < length && s->sorted[i] != old; i++) {}
+        // Close the gap towards the end, then insert from there
+        for (; i + 1 < length; i++)
+            s->sorted[i] = s->sorted[i + 1];
+    }
+    for (; i > 0 && s->sorted[i - 1] > sample; i--)
+        s->sorted[i] = s->sorted[i - 1];
+    s->sorted[i] = sample;
+    COST_CHARGE(length * (COST_LOOP_ITER + COST_FLOAT_OP));
+
+    s->window[s->index] = sample;
+    s->index = (s->index + 1) % length;
+    return s->sorted[s->count / 2];
+}
+
+static float average(FilterStage *s, float sample)
+{
+    uint8_t length = s->config.length;
+
+    if (s->count < length)
+        s->count++;
+    else
+        s->value -= s->window[s->index];
+    s->value += sample;
+    s->window[s->index] = sample;
+    s->index = (s->index + 1) % length;
+
+    // Rounding in the running sum would random-walk for ever: re-add the
+    // window from scratch once per lap, one add per sample on average
+    if (s->index == 0) {
+        float sum = 0.0f;
+        uint8_t i;
+        for (i = 0; i < length; i++)
+            sum += s->window[i];
+        s->value = sum;
+    }
+    COST_CHARGE(COST_FLOAT_DIV + 3 * COST_FLOAT_OP);
+    return s->value / (float)s->count;
+}
+
+static float ema(FilterStage *s, float sample)
+{
+    COST_CHARGE(3 * COST_FLOAT_OP);
+    if (s->count == 0) {
+        s->count = 1;
+        s->value = sample;
+    } else {
+        s->value += s->config.alpha * (sample - s->value);
+    }
+    return s->value;
+}
+
+// ============================================
+// Chain
+// ============================================
+
+bool Filter_Configure(FilterChain *chain, const FilterStageConfig *stages, uint8_t count)
+{
+    uint8_t i;
+
+    if (count > FILTER_MAX_STAGES)
+        return false;
+    for (i = 0; i < count; i++) {
+        const FilterStageConfig *c = &stages[i];
+        switch (c->kind) {
+        case FILTER_MEDIAN:
+            // An even window has no middle sample
+            if (c->length % 2 == 0 || c->length > FILTER_MAX_LENGTH)
+                return false;
+            break;
+        case FILTER_AVERAGE:
+            if (c->length == 0 || c->length > FILTER_MAX_LENGTH)
+                return false;
+            break;
+        case FILTER_EMA:
+            if (!(c->alpha > 0.0f && c->alpha <= 1.0f))
+                return false;
+            break;
+        default:
+            return false;
+        }
+    }
+
+    for (i = 0; i < count; i++)
+        chain->stage[i].config = stages[i];
+    chain->stages = count;
+    Filter_Reset(chain);
+    return true;
+}
+
+void Filter_Reset(FilterChain *chain)
+{
+    uint8_t i;
+
+    for (i = 0; i < chain->stages; i++) {
+        FilterStage *s = &chain->stage[i];
+        s->index = 0;
+        s->count = 0;
+        s->value = 0.0f;
+    }
+}
+
+float Filter_Apply(FilterChain *chain, float sample)
+{
+    uint8_t i;
+
+    for (i = 0; i < chain->stages; i++) {
+        FilterStage *s = &chain->stage[i];
+        switch (s->config.kind) {
+        case FILTER_MEDIAN:
+            sample = median(s, sample);
+            break;
+        case FILTER_AVERAGE:
+            sample = average(s, sample);
+            break;
+        case FILTER_EMA:
+            sample = ema(s, sample);
+            break;
+        }
+    }
+    return sample;
+}
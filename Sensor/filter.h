@@ -0,0 +1,72 @@
+/**
+ * filter.h - Configurable filter chain for one measured quantity
+ *
+ * A chain is up to FILTER_MAX_STAGES stages applied in order, each fed
+ * with the output of the one before:
+ *
+ *   MEDIAN   median of the last `length` samples: drops single outliers
+ *            (a missed or doubled edge) without smearing steps. Odd
+ *            lengths only; O(length) per sample, meant for 3 or 5.
+ *   AVERAGE  moving average of the last `length` samples, kept as a
+ *            running sum: O(1) per sample whatever the length
+ *   EMA      exponential moving average, y += alpha * (x - y)
+ *
+ * Until a window has filled, MEDIAN and AVERAGE work over the samples
+ * they have. The chain holds no units; the sensor filters its base edge
+ * rate once and scales the result to RPM and km/h.
+ */
+
+#ifndef FILTER_H
+#define FILTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FILTER_MAX_STAGES       3
+#define FILTER_MAX_LENGTH       16      /* MEDIAN and AVERAGE window */
+
+typedef enum {
+    FILTER_MEDIAN,
+    FILTER_AVERAGE,
+    FILTER_EMA
+} FilterKind;
+
+/* One stage as configured */
+typedef struct {
+    FilterKind kind;
+    uint8_t length;             // MEDIAN, AVERAGE: samples
+    float alpha;                // EMA: weight of the new sample, 0 < alpha <= 1
+} FilterStageConfig;
+
+typedef struct {
+    FilterStageConfig config;
+    float window[FILTER_MAX_LENGTH];    // last samples, oldest at `index` once full
+    float sorted[FILTER_MAX_LENGTH];    // MEDIAN: the same samples in order
+    uint8_t index;
+    uint8_t count;
+    float value;                // AVERAGE: running sum, EMA: output
+} FilterStage;
+
+typedef struct {
+    FilterStage stage[FILTER_MAX_STAGES];
+    uint8_t stages;
+} FilterChain;
+
+/**
+ * Replace the chain's stages with `count` configured ones and reset it.
+ * Returns false, leaving the chain unchanged, if a stage is invalid.
+ * count = 0 makes the chain pass samples through.
+ */
+bool Filter_Configure(FilterChain *chain, const FilterStageConfig *stages, uint8_t count);
+
+/**
+ * Forget all samples, keeping the configuration
+ */
+void Filter_Reset(FilterChain *chain);
+
+/**
+ * Feed one sample through every stage; returns the chain's output
+ */
+float Filter_Apply(FilterChain *chain, float sample);
+
+#endif /* FILTER_H */
@@ -0,0 +1,183 @@
+/**
+ * poles.c - Learnt pole spacing, for a speed from every single edge
+ */
+
+#include "poles.h"
+#include "profile/costmodel.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+void Poles_Init(PoleTable *p, float timerHz, uint8_t edgesPerRev)
+{
+    if (edgesPerRev == 0)
+        edgesPerRev = 1;
+    if (edgesPerRev > POLES_MAX_EDGES)
+        edgesPerRev = POLES_MAX_EDGES;
+    p->scale = (float)edgesPerRev * timerHz;
+    p->edgesPerRev = edgesPerRev;
+    Poles_Reset(p);
+}
+
+void Poles_Reset(PoleTable *p)
+{
+    uint8_t i;
+
+    for (i = 0; i < p->edgesPerRev; i++) {
+        p->share[i] = 0.0f;
+        p->weight[i] = 0.0f;
+    }
+    p->revolutions = 0;
+    Poles_Resync(p);
+    p->resync = false;
+    p->rate = 0.0f;
+}
+
+void Poles_Resync(PoleTable *p)
+{
+    uint8_t i;
+
+    for (i = 0; i < p->edgesPerRev; i++)
+        p->periods[i] = 0;
+    p->revTicks = 0;
+    p->lastRevTicks = 0;
+    p->position = 0;
+    p->count = 0;
+    p->resync = true;
+}
+
+bool Poles_Settled(const PoleTable *p)
+{
+    return p->revolutions >= POLES_SETTLE_REVS && p->count >= p->edgesPerRev;
+}
+
+// The revolution just completed, recorded from an unknown position:
+// find the rotation of the table it matches best and carry on from it
+static void align(PoleTable *p)
+{
+    uint32_t rotated[POLES_MAX_EDGES];
+    uint8_t n = p->edgesPerRev;
+    float inv = 1.0f / (float)p->revTicks;
+    float best = 0.0f;
+    uint8_t r, bestR = 0, i;
+
+    for (r = 0; r < n; r++) {
+        float error = 0.0f;
+        for (i = 0; i < n; i++) {
+            float d = (float)p->periods[i] * inv - p->share[(i + r) % n];
+            error += d * d;
+        }
+        if (r == 0 || error < best) {
+            best = error;
+            bestR = r;
+        }
+    }
+    COST_CHARGE(COST_FLOAT_DIV + n * n * (4 * COST_FLOAT_OP + COST_LOOP_ITER));
+
+    for (i = 0; i < n; i++)
+        rotated[(i + bestR) % n] = p->periods[i];
+    for (i = 0; i < n; i++)
+        p->periods[i] = rotated[i];
+    p->position = bestR;
+}
+
+// Fold the last revolution's shares in, at steady speed only
+static void learn(PoleTable *p)
+{
+    uint8_t n = p->edgesPerRev;
+    uint32_t change = p->revTicks > p->lastRevTicks ? p->revTicks - p->lastRevTicks
+                                                    : p->lastRevTicks - p->revTicks;
+    float inv, alpha, sum = 0.0f, norm;
+    uint8_t i;
+
+    if (p->lastRevTicks == 0 || change > p->revTicks / POLES_STEADY_RATIO)
+        return;
+
+    // Average the first revolutions, then follow slowly
+    inv = 1.0f / (float)p->revTicks;
+    alpha = p->revolutions < POLES_SETTLE_REVS ? 1.0f / (float)(p->revolutions + 1)
+                                               : POLES_LEARN_RATE;
+    for (i = 0; i < n; i++) {
+        p->share[i] += alpha * ((float)p->periods[i] * inv - p->share[i]);
+        sum += p->share[i];
+    }
+    // Shares sum to 1 but for rounding
+    norm = p->scale / sum;
+    for (i = 0; i < n; i++)
+        p->weight[i] = p->share[i] * norm;
+    if (p->revolutions < POLES_SETTLE_REVS)
+        p->revolutions++;
+    COST_CHARGE(3 * COST_FLOAT_DIV + n * (5 * COST_FLOAT_OP + 2 * COST_LOOP_ITER));
+}
+
+void Poles_Edge(PoleTable *p, uint32_t period)
+{
+    uint8_t n = p->edgesPerRev;
+    uint8_t position = p->position;
+
+    // Running sum over the last revolution
+    p->revTicks += period - p->periods[position];
+    p->periods[position] = period;
+    p->position = (position + 1) % n;
+
+    if (p->count < n) {
+        p->count++;
+        if (p->count < n) {
+            // Position unknown or the revolution incomplete: this edge
+            // as if the poles were evenly spaced
+            COST_CHARGE(COST_FLOAT_DIV + 2 * COST_FLOAT_OP);
+            p->rate = p->scale / ((float)n * (float)period);
+            return;
+        }
+        if (p->resync) {
+            // A table still being learnt is not worth aligning to
+            if (p->revolutions >= POLES_SETTLE_REVS) {
+                align(p);
+                position = (p->position + n - 1) % n;
+            } else {
+                p->revolutions = 0;
+            }
+            p->resync = false;
+        }
+    }
+
+    // Revolution complete
+    if (p->position == 0) {
+        learn(p);
+        p->lastRevTicks = p->revTicks;
+    }
+
+    // One divide
+    COST_CHARGE(COST_FLOAT_DIV + COST_FLOAT_OP);
+    if (p->revolutions >= POLES_SETTLE_REVS)
+        p->rate = p->weight[position] / (float)period;
+    else
+        p->rate = p->scale / (float)p->revTicks;
+}
+
+float Poles_Rate(const PoleTable *p, uint32_t sinceEdge)
+{
+    float rate = p->rate;
+    float bound;
+
+    if (p->count == 0)
+        return 0.0f;
+
+    // Overdue next edge: the rate is at most its share (or, before the
+    // table is in, the revolution ending now) over the time waited
+    if (Poles_Settled(p)) {
+        float next = p->weight[p->position];
+        if ((float)sinceEdge * rate <= next)
+            return rate;
+        bound = next / (float)sinceEdge;
+    } else if (p->count >= p->edgesPerRev) {
+        if (sinceEdge <= p->periods[p->position])
+            return rate;
+        bound = p->scale / (float)(p->revTicks - p->periods[p->position] + sinceEdge);
+    } else {
+        if ((float)sinceEdge * rate * (float)p->edgesPerRev <= p->scale)
+            return rate;
+        bound = p->scale / ((float)p->edgesPerRev * (float)sinceEdge);
+    }
+    COST_CHARGE(COST_FLOAT_DIV + 2 * COST_FLOAT_OP);
+    return rate < bound ? rate : bound;
+}
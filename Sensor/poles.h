@@ -0,0 +1,91 @@
+/**
+ * poles.h - Learnt pole spacing, for a speed from every single edge
+ *
+ * The poles of a magnet ring are not evenly spaced, so the period of a
+ * single edge ripples with the revolution: the edge after a wide pole
+ * gap comes late every time round. The table learns each edge
+ * position's share of a revolution from the edge periods themselves, a
+ * revolution at a time, and divides it back out:
+ *
+ *   rate = edgesPerRev x share[position] / (period x tick)
+ *
+ * so every edge gives an accurate rate, not only a full revolution.
+ * Shares are learnt at steady speed only (revolution to revolution
+ * within POLES_STEADY_RATIO), as a ramp would teach them the ramp; the
+ * first revolutions are averaged, then the table follows slowly at
+ * POLES_LEARN_RATE. Until POLES_SETTLE_REVS revolutions are in, the rate
+ * is that of the last revolution.
+ *
+ * Positions count accepted edges, so a lost edge (ring overflow, a stop,
+ * where the first edge after it is rejected) breaks the count. After
+ * Poles_Resync() the next full revolution is matched against the table
+ * at every rotation and the count carries on from the best one; the
+ * learnt table is kept. A reversal runs the pattern backwards: relearn
+ * with Poles_Reset().
+ *
+ * Rates are edges per second.
+ */
+
+#ifndef POLES_H
+#define POLES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tracker.h"
+
+#define POLES_MAX_EDGES         TRACKER_MAX_EDGES_PER_REV
+#define POLES_LEARN_RATE        0.05f   /* weight of a revolution once settled */
+#define POLES_SETTLE_REVS       8
+#define POLES_STEADY_RATIO      200     /* revolution change below 1/200 */
+
+typedef struct {
+    float scale;                // edgesPerRev x timer frequency
+    uint8_t edgesPerRev;
+
+    // Last revolution of periods by edge position, in timer ticks
+    uint32_t periods[POLES_MAX_EDGES];
+    uint32_t revTicks;
+    uint32_t lastRevTicks;      // at the previous wrap, for the steady check
+    uint8_t position;           // of the next edge
+    uint8_t count;              // periods since the start or a resync
+    bool resync;                // align the next revolution to the table
+
+    float share[POLES_MAX_EDGES];   // learnt fraction of a revolution
+    float weight[POLES_MAX_EDGES];  // scale x share / sum of shares
+    uint16_t revolutions;       // learnt, up to POLES_SETTLE_REVS
+    float rate;                 // at the last edge
+} PoleTable;
+
+/**
+ * Set the timer frequency and edges per revolution
+ * (<= POLES_MAX_EDGES), and forget the table
+ */
+void Poles_Init(PoleTable *p, float timerHz, uint8_t edgesPerRev);
+
+/**
+ * Forget the table and start learning again
+ */
+void Poles_Reset(PoleTable *p);
+
+/**
+ * Edges were lost: keep the table, find the position again
+ */
+void Poles_Resync(PoleTable *p);
+
+/**
+ * One accepted edge, `period` timer ticks after the previous one
+ */
+void Poles_Edge(PoleTable *p, uint32_t period);
+
+/**
+ * Rate at the last edge, lowered once the next edge is overdue
+ * (`sinceEdge` ticks after it); 0 until the first full revolution
+ */
+float Poles_Rate(const PoleTable *p, uint32_t sinceEdge);
+
+/**
+ * True once the table compensates single edges
+ */
+bool Poles_Settled(const PoleTable *p);
+
+#endif /* POLES_H */
@@ -0,0 +1,123 @@
+/**
+ * tracker.c - Per-edge Kalman tracker for edge rate and acceleration
+ */
+
+#include "tracker.h"
+#include "profile/costmodel.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+void Tracker_Init(Tracker *t, const TrackerConfig *config, float timerHz, uint8_t edgesPerRev)
+{
+    if (edgesPerRev == 0)
+        edgesPerRev = 1;
+    if (edgesPerRev > TRACKER_MAX_EDGES_PER_REV)
+        edgesPerRev = TRACKER_MAX_EDGES_PER_REV;
+    t->config = *config;
+    t->tickSeconds = 1.0f / timerHz;
+    t->revScale = (float)edgesPerRev * timerHz;
+    t->edgesPerRev = edgesPerRev;
+    Tracker_Reset(t);
+}
+
+void Tracker_Reset(Tracker *t)
+{
+    uint8_t i;
+
+    for (i = 0; i < t->edgesPerRev; i++)
+        t->periods[i] = 0;
+    t->revTicks = 0;
+    t->index = 0;
+    t->count = 0;
+    t->rate = 0.0f;
+    t->accel = 0.0f;
+    t->p00 = 0.0f;
+    t->p01 = 0.0f;
+    t->p11 = 0.0f;
+    t->started = false;
+}
+
+// Kalman step: advance dt seconds, fold in the measured rate z
+static void update(Tracker *t, float dt, float z)
+{
+    float q = t->config.processNoise;
+    float sigma = t->config.measurementNoise * z;
+    float r = sigma * sigma;
+    float inv, k0, k1, y;
+
+    if (!t->started) {
+        // First rate as measured, acceleration unknown: as if a second
+        // of process noise had built up
+        t->rate = z;
+        t->accel = 0.0f;
+        t->p00 = r;
+        t->p01 = 0.0f;
+        t->p11 = q;
+        t->started = true;
+        return;
+    }
+
+    // Predict (constant acceleration, jerk as noise)
+    t->rate += t->accel * dt;
+    t->p00 += dt * (2.0f * t->p01 + dt * t->p11) + q * dt * dt * dt * (1.0f / 3.0f);
+    t->p01 += dt * t->p11 + q * dt * dt * 0.5f;
+    t->p11 += q * dt;
+
+    // Update
+    inv = 1.0f / (t->p00 + r);
+    k0 = t->p00 * inv;
+    k1 = t->p01 * inv;
+    y = z - t->rate;
+    t->rate += k0 * y;
+    t->accel += k1 * y;
+    t->p11 -= k1 * t->p01;
+    t->p01 -= k0 * t->p01;
+    t->p00 -= k0 * t->p00;
+}
+
+void Tracker_Edge(Tracker *t, uint32_t period)
+{
+    // Running sum over the last revolution
+    t->revTicks += period - t->periods[t->index];
+    t->periods[t->index] = period;
+    t->index = (t->index + 1) % t->edgesPerRev;
+    if (t->count < t->edgesPerRev) {
+        t->count++;
+        if (t->count < t->edgesPerRev)
+            return;
+    }
+
+    // Two divides, about 30 multiply-adds
+    COST_CHARGE(2 * COST_FLOAT_DIV + 29 * COST_FLOAT_OP);
+    update(t, (float)period * t->tickSeconds, t->revScale / (float)t->revTicks);
+}
+
+float Tracker_Rate(const Tracker *t, uint32_t sinceEdge)
+{
+    float rate = t->rate;
+
+    if (!t->started)
+        return 0.0f;
+
+    // Overdue edge (later than the same edge a revolution ago): the
+    // revolution ending now would be slower than it, at least
+    if (sinceEdge > t->periods[t->index]) {
+        uint32_t rev = t->revTicks - t->periods[t->index] + sinceEdge;
+        float bound = t->revScale / (float)rev;
+        COST_CHARGE(COST_FLOAT_DIV + COST_FLOAT_OP);
+        if (rate > bound)
+            rate = bound;
+    }
+    return rate > 0.0f ? rate : 0.0f;
+}
+
+float Tracker_Accel(const Tracker *t)
+{
+    return t->started ? t->accel : 0.0f;
+}
+
+float Tracker_RateStdDev(const Tracker *t)
+{
+    return t->started ? sqrtf(t->p00) : 0.0f;
+}
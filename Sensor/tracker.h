@@ -0,0 +1,86 @@
+/**
+ * tracker.h - Per-edge Kalman tracker for edge rate and acceleration
+ *
+ * Fed every accepted edge period. Each edge yields a rate measurement
+ * over the last full revolution (edgesPerRev periods), so pole spacing
+ * errors cancel, taken one edge period after the previous measurement.
+ * A two-state Kalman filter, rate r and acceleration a, with white-noise
+ * jerk of spectral density `processNoise`, folds the measurements in:
+ * a ramp is followed once a is learnt, and at steady speed the gain
+ * settles low enough to average the noise out.
+ *
+ * The estimate is of the last revolution's rate, so it trails a ramp by
+ * half a revolution (4 ms at 7500 RPM); extrapolating with a would
+ * remove that but overshoots badly after a step. A motor slowing to a
+ * stop sends no edges: once the next edge is later than the same edge a
+ * revolution ago, the reading is capped at the rate of a revolution
+ * ending now.
+ *
+ * Measurement noise is relative, `measurementNoise` x the measured rate,
+ * as timing errors scale with speed. Raise `processNoise` to follow fast
+ * changes, lower it for a steadier reading.
+ *
+ * Rates are edges per second, acceleration edges per second squared.
+ */
+
+#ifndef TRACKER_H
+#define TRACKER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TRACKER_MAX_EDGES_PER_REV   32
+
+typedef struct {
+    float processNoise;         // jerk spectral density, (edges/s^3)^2 / Hz
+    float measurementNoise;     // std dev of a revolution rate / the rate
+} TrackerConfig;
+
+typedef struct {
+    TrackerConfig config;
+    float tickSeconds;          // 1 / timer frequency
+    float revScale;             // edgesPerRev x timer frequency: rate = revScale / revTicks
+    uint8_t edgesPerRev;
+
+    // Last revolution of periods, in timer ticks
+    uint32_t periods[TRACKER_MAX_EDGES_PER_REV];
+    uint32_t revTicks;
+    uint8_t index;
+    uint8_t count;
+
+    float rate;
+    float accel;
+    float p00, p01, p11;        // covariance of (rate, accel)
+    bool started;
+} Tracker;
+
+/**
+ * Set the tuning, timer frequency and edges per revolution
+ * (<= TRACKER_MAX_EDGES_PER_REV), and reset
+ */
+void Tracker_Init(Tracker *t, const TrackerConfig *config, float timerHz, uint8_t edgesPerRev);
+
+/**
+ * Forget the state; the track restarts after the next full revolution
+ */
+void Tracker_Reset(Tracker *t);
+
+/**
+ * One accepted edge, `period` timer ticks after the previous one
+ */
+void Tracker_Edge(Tracker *t, uint32_t period);
+
+/**
+ * Estimated rate `sinceEdge` timer ticks after the last edge, 0 until
+ * the first full revolution
+ */
+float Tracker_Rate(const Tracker *t, uint32_t sinceEdge);
+
+/**
+ * Acceleration and the rate's standard deviation (both 0 until the
+ * first full revolution)
+ */
+float Tracker_Accel(const Tracker *t);
+float Tracker_RateStdDev(const Tracker *t);
+
+#endif /* TRACKER_H */
@@ -0,0 +1,1191 @@
+/* Generated by tools/img2rle.py from display/assets/manifest.txt - do not edit.
+ * 1bpp equivalent: 55576 bytes, span encoding: 15934 bytes */
+
+#include "assets_rle.h"
+
+/* digits16x24.pbm glyph 0, 16x24 px, 57 span bytes */
+static const uint8_t fontDigits16x24_spans0[57] = {
+      5,   6,   9,   8,   7,   3,   4,   3,   6,   2,   6,   2,   5,   2,   8,   2,
+      4,   2,   8,   2,   4,   2,   8,   2,   4,   2,   8,   2,   4,   2,   8,   2,
+      4,   2,   8,   2,   4,   2,   8,   2,   4,   2,   8,   2,   5,   2,   6,   2,
+      6,   3,   4,   3,   7,   8,   9,   6, 133,
+};
+
+/* digits16x24.pbm glyph 1, 16x24 px, 39 span bytes */
+static const uint8_t fontDigits16x24_spans1[39] = {
+      8,   2,  13,   3,  12,   4,  11,   5,  10,   2,   1,   3,   9,   2,   2,   3,
+      8,   2,   3,   3,  13,   3,  13,   3,  13,   3,  13,   3,  13,   3,  13,   3,
+     13,   3,   8,  12,   4,  12, 130,
+};
+
+/* digits16x24.pbm glyph 2, 16x24 px, 37 span bytes */
+static const uint8_t fontDigits16x24_spans2[37] = {
+      5,   6,   9,   8,   7,   3,   4,   3,   6,   2,   6,   2,  14,   2,  13,   3,
+     12,   3,  12,   3,  12,   3,  12,   3,  12,   3,  12,   3,  12,   3,  12,   3,
+     13,  11,   5,  11, 131,
+};
+
+/* digits16x24.pbm glyph 3, 16x24 px, 39 span bytes */
+static const uint8_t fontDigits16x24_spans3[39] = {
+      5,   6,   9,   8,   7,   3,   4,   3,   6,   2,   6,   2,  14,   2,  13,   3,
+     10,   5,  11,   5,  14,   3,  14,   2,  14,   2,   6,   2,   6,   2,   6,   3,
+      4,   3,   7,   8,   9,   6, 149,
+};
+
+/* digits16x24.pbm glyph 4, 16x24 px, 43 span bytes */
+static const uint8_t fontDigits16x24_spans4[43] = {
+     10,   3,  12,   4,  11,   5,  10,   2,   1,   3,   9,   2,   2,   3,   8,   2,
+      3,   3,   7,   2,   4,   3,   6,   2,   5,   3,   5,   2,   6,   3,   5,  12,
+      4,  12,  12,   3,  13,   3,  13,   3,  13,   3, 147,
+};
+
+/* digits16x24.pbm glyph 5, 16x24 px, 39 span bytes */
+static const uint8_t fontDigits16x24_spans5[39] = {
+      2,  11,   5,  11,   5,   2,  14,   2,  14,   2,   1,   6,   7,  10,   6,   3,
+      5,   3,  14,   3,  13,   3,  13,   3,  13,   3,   4,   2,   6,   3,   6,   3,
+      3,   4,   7,   8,   9,   6, 149,
+};
+
+/* digits16x24.pbm glyph 6, 16x24 px, 47 span bytes */
+static const uint8_t fontDigits16x24_spans6[47] = {
+      5,   6,   9,   8,   7,   3,   4,   3,   6,   2,  13,   2,  14,   2,   1,   6,
+      7,  10,   6,   3,   5,   3,   5,   2,   7,   3,   4,   2,   7,   3,   4,   2,
+      7,   3,   4,   3,   5,   3,   6,   3,   3,   4,   7,   8,   9,   6, 149,
+};
+
+/* digits16x24.pbm glyph 7, 16x24 px, 31 span bytes */
+static const uint8_t fontDigits16x24_spans7[31] = {
+      2,  11,   5,  11,  13,   3,  12,   3,  12,   3,  12,   3,  12,   3,  13,   2,
+     13,   2,  13,   3,  13,   2,  13,   3,  13,   3,  13,   2,  14,   2, 155,
+};
+
+/* digits16x24.pbm glyph 8, 16x24 px, 47 span bytes */
+static const uint8_t fontDigits16x24_spans8[47] = {
+      5,   6,   9,   8,   7,   3,   4,   3,   6,   2,   6,   2,   6,   2,   6,   2,
+      6,   3,   4,   3,   7,   8,   9,   6,   9,   8,   7,   3,   4,   3,   6,   2,
+      6,   2,   6,   2,   6,   2,   6,   3,   4,   3,   7,   8,   9,   6, 149,
+};
+
+/* digits16x24.pbm glyph 9, 16x24 px, 45 span bytes */
+static const uint8_t fontDigits16x24_spans9[45] = {
+      5,   6,   9,   8,   7,   3,   4,   3,   5,   3,   6,   3,   4,   2,   7,   3,
+      4,   2,   7,   3,   4,   3,   5,   4,   5,  11,   6,   6,   1,   3,  13,   3,
+     13,   3,  13,   2,   6,   3,   4,   3,   7,   8,   9,   6, 149,
+};
+
+const RleImage fontDigits16x24[10] = {
+    { 16, 24, 57, fontDigits16x24_spans0 },
+    { 16, 24, 39, fontDigits16x24_spans1 },
+    { 16, 24, 37, fontDigits16x24_spans2 },
+    { 16, 24, 39, fontDigits16x24_spans3 },
+    { 16, 24, 43, fontDigits16x24_spans4 },
+    { 16, 24, 39, fontDigits16x24_spans5 },
+    { 16, 24, 47, fontDigits16x24_spans6 },
+    { 16, 24, 31, fontDigits16x24_spans7 },
+    { 16, 24, 47, fontDigits16x24_spans8 },
+    { 16, 24, 45, fontDigits16x24_spans9 }
+};
+
+/* digits32x50.pbm glyph 0, 32x50 px, 169 span bytes */
+static const uint8_t fontDigits32x50_spans0[169] = {
+     72,  15,  16,  17,  14,  19,  14,  17,   1,   2,   9,   2,   2,  15,   1,   4,
+      7,   4,  16,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,
+      5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,
+      5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,
+      5,   6,  15,   6,   5,   6,  15,   6,   5,   5,  18,   4,   5,   3,  22,   2,
+      5,   1,  25,   1,  37,   1,  31,   3,  22,   2,   5,   5,  18,   4,   5,   6,
+     15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,
+     15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,
+     15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,
+     15,   6,   5,   6,  15,   6,   6,   4,  17,   4,   8,   2,   2,  15,   2,   2,
+     12,  17,  14,  19,  14,  17,  16,   7,  81,
+};
+
+/* digits32x50.pbm glyph 1, 32x50 px, 75 span bytes */
+static const uint8_t fontDigits32x50_spans1[75] = {
+    185,   2,  29,   4,  27,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     28,   4,  30,   2,  31,   1,  94,   2,  28,   4,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  27,   4,  29,   2, 197,
+};
+
+/* digits32x50.pbm glyph 2, 32x50 px, 107 span bytes */
+static const uint8_t fontDigits32x50_spans2[107] = {
+     72,  15,  16,  17,  14,  19,  14,  17,   1,   2,  13,  15,   1,   4,  27,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  28,   4,  10,  16,   4,   2,
+      9,  19,   3,   1,   7,  23,   7,   1,   2,  21,   8,   3,   2,  17,  10,   5,
+     27,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  27,   4,  29,   2,
+      2,  15,  16,  17,  14,  19,  14,  17,  16,  15,  73,
+};
+
+/* digits32x50.pbm glyph 3, 32x50 px, 105 span bytes */
+static const uint8_t fontDigits32x50_spans3[105] = {
+     72,  15,  16,  17,  14,  19,  14,  17,   1,   2,  13,  15,   1,   4,  27,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  28,   4,  10,  16,   4,   2,
+      9,  19,   3,   1,   7,  23,  10,  21,  13,  17,   3,   2,  28,   4,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  27,   4,  12,  15,   2,   2,
+     12,  17,  14,  19,  14,  17,  16,  15,  73,
+};
+
+/* digits32x50.pbm glyph 4, 32x50 px, 121 span bytes */
+static const uint8_t fontDigits32x50_spans4[121] = {
+    185,   2,   9,   2,  18,   4,   7,   4,  16,   6,   5,   6,  15,   6,   5,   6,
+     15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,
+     15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,
+     15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   5,
+     18,   4,   5,   3,   2,  16,   4,   2,   5,   1,   3,  19,   3,   1,   7,  23,
+     10,  21,  13,  17,   3,   2,  28,   4,  26,   6,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  27,   4,  29,   2, 197,
+};
+
+/* digits32x50.pbm glyph 5, 32x50 px, 103 span bytes */
+static const uint8_t fontDigits32x50_spans5[103] = {
+     72,  15,  16,  17,  14,  19,  14,  17,  12,   2,   2,  15,  12,   4,  27,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   5,  27,   3,   2,  16,  11,   1,
+      3,  19,  11,  23,  10,  21,  13,  17,   3,   2,  28,   4,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  27,   4,  12,  15,   2,   2,  12,  17,
+     14,  19,  14,  17,  16,  15,  73,
+};
+
+/* digits32x50.pbm glyph 6, 32x50 px, 141 span bytes */
+static const uint8_t fontDigits32x50_spans6[141] = {
+     72,  15,  16,  17,  14,  19,  14,  17,  12,   2,   2,  15,  12,   4,  27,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   5,  27,   3,   2,  16,  11,   1,
+      3,  19,  11,  23,   7,   1,   2,  21,   8,   3,   2,  17,   3,   2,   5,   5,
+     18,   4,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,
+     15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,
+     15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,
+     15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   6,   4,  17,   4,   8,   2,
+      2,  15,   2,   2,  12,  17,  14,  19,  14,  17,  16,  15,  73,
+};
+
+/* digits32x50.pbm glyph 7, 32x50 px, 85 span bytes */
+static const uint8_t fontDigits32x50_spans7[85] = {
+     72,  15,  16,  17,  14,  19,  14,  17,   1,   2,  13,  15,   1,   4,  27,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  28,   4,  30,   2,  31,   1,
+     94,   2,  28,   4,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     27,   4,  29,   2, 197,
+};
+
+/* digits32x50.pbm glyph 8, 32x50 px, 179 span bytes */
+static const uint8_t fontDigits32x50_spans8[179] = {
+     72,  15,  16,  17,  14,  19,  14,  17,   1,   2,   9,   2,   2,  15,   1,   4,
+      7,   4,  16,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,
+      5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,
+      5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,
+      5,   6,  15,   6,   5,   6,  15,   6,   5,   5,  18,   4,   5,   3,   2,  16,
+      4,   2,   5,   1,   3,  19,   3,   1,   7,  23,   7,   1,   2,  21,   8,   3,
+      2,  17,   3,   2,   5,   5,  18,   4,   5,   6,  15,   6,   5,   6,  15,   6,
+      5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,
+      5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,
+      5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,
+      6,   4,  17,   4,   8,   2,   2,  15,   2,   2,  12,  17,  14,  19,  14,  17,
+     16,  15,  73,
+};
+
+/* digits32x50.pbm glyph 9, 32x50 px, 141 span bytes */
+static const uint8_t fontDigits32x50_spans9[141] = {
+     72,  15,  16,  17,  14,  19,  14,  17,   1,   2,   9,   2,   2,  15,   1,   4,
+      7,   4,  16,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,
+      5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,
+      5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,   5,   6,  15,   6,
+      5,   6,  15,   6,   5,   6,  15,   6,   5,   5,  18,   4,   5,   3,   2,  16,
+      4,   2,   5,   1,   3,  19,   3,   1,   7,  23,  10,  21,  13,  17,   3,   2,
+     28,   4,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,
+     26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  26,   6,  27,   4,
+     12,  15,   2,   2,  12,  17,  14,  19,  14,  17,  16,  15,  73,
+};
+
+const RleImage fontDigits32x50[10] = {
+    { 32, 50, 169, fontDigits32x50_spans0 },
+    { 32, 50, 75, fontDigits32x50_spans1 },
+    { 32, 50, 107, fontDigits32x50_spans2 },
+    { 32, 50, 105, fontDigits32x50_spans3 },
+    { 32, 50, 121, fontDigits32x50_spans4 },
+    { 32, 50, 103, fontDigits32x50_spans5 },
+    { 32, 50, 141, fontDigits32x50_spans6 },
+    { 32, 50, 85, fontDigits32x50_spans7 },
+    { 32, 50, 179, fontDigits32x50_spans8 },
+    { 32, 50, 141, fontDigits32x50_spans9 }
+};
+
+/* gear_d.pbm, 48x60 px, 190 span bytes */
+static const uint8_t imgGearLetterD_spans[190] = {
+     51,  22,  25,  27,  20,  31,  17,  32,  16,  34,  14,  35,  13,  37,  11,  38,
+     10,   8,  17,  14,   9,   8,  19,  12,   9,   8,  21,  11,   8,   8,  22,  11,
+      7,   8,  24,  10,   6,   8,  25,   9,   6,   8,  26,   9,   5,   8,  26,  10,
+      4,   8,  27,   9,   4,   8,  28,   8,   4,   8,  28,   9,   3,   8,  29,   8,
+      3,   8,  29,   8,   3,   8,  30,   8,   2,   8,  30,   8,   2,   8,  30,   8,
+      2,   8,  30,   8,   2,   8,  30,   8,   2,   8,  30,   8,   2,   8,  30,   8,
+      2,   8,  30,   8,   2,   8,  30,   8,   2,   8,  30,   8,   2,   8,  30,   8,
+      2,   8,  30,   8,   2,   8,  29,   9,   2,   8,  29,   8,   3,   8,  29,   8,
+      3,   8,  28,   9,   3,   8,  28,   8,   4,   8,  27,   9,   4,   8,  26,   9,
+      5,   8,  25,  10,   5,   8,  24,  10,   6,   8,  23,  11,   6,   8,  22,  11,
+      7,   8,  21,  11,   8,   8,  19,  12,   9,   8,  15,  15,  10,  37,  11,  36,
+     12,  35,  13,  34,  14,  32,  17,  29,  19,  26,  24,  20,  72, 144,
+};
+
+const RleImage imgGearLetterD = { 48, 60, 190, imgGearLetterD_spans };
+
+/* gear_r.pbm, 48x60 px, 314 span bytes */
+static const uint8_t imgGearLetterR_spans[314] = {
+     47,   1,  47,   1,   4,  22,  21,   1,   3,  25,  19,   1,   2,  28,  17,   1,
+      2,  30,  15,   1,   2,  31,  14,   1,   2,  32,  13,   1,   2,  32,  13,   1,
+      2,  33,  12,   1,   2,   8,  15,  11,  11,   1,   2,   7,  17,  10,  11,   1,
+      2,   7,  18,  10,  10,   1,   2,   7,  19,   9,  10,   1,   2,   7,  20,   8,
+     10,   1,   2,   7,  20,   8,  10,   1,   2,   7,  21,   8,   9,   1,   2,   7,
+     21,   8,   9,   1,   2,   7,  21,   8,   9,   1,   2,   7,  21,   8,   9,   1,
+      2,   7,  20,   8,  10,   1,   2,   7,  20,   8,  10,   1,   2,   7,  19,   9,
+     10,   1,   2,   7,  19,   9,  10,   1,   2,   7,  18,   9,  11,   1,   2,   8,
+     15,  11,  11,   1,   2,   9,  11,  13,  12,   1,   2,  33,  12,   1,   2,  32,
+     13,   1,   2,  31,  14,   1,   2,  30,  15,   1,   2,  30,  15,   1,   2,  31,
+     14,   1,   2,  31,  14,   1,   2,  21,   1,  10,  13,   1,   2,   7,  16,   9,
+     13,   1,   2,   7,  17,   9,  12,   1,   2,   7,  17,  10,  11,   1,   2,   7,
+     18,   9,  11,   1,   2,   7,  19,   9,  10,   1,   2,   7,  19,   9,  10,   1,
+      2,   7,  20,   9,   9,   1,   2,   7,  20,   9,   9,   1,   2,   7,  21,   9,
+      8,   1,   2,   7,  21,  10,   7,   1,   2,   7,  22,   9,   7,   1,   2,   7,
+     23,   9,   6,   1,   2,   7,  23,   9,   6,   1,   2,   7,  24,   9,   5,   1,
+      2,   7,  24,  10,   4,   1,   2,   7,  25,   9,   4,   1,   2,   7,  25,  10,
+      3,   1,   2,   7,  26,   9,   3,   1,   2,   7,  27,   8,   3,   1,   2,   7,
+     27,   8,   3,   1,   2,   7,  28,   7,   3,   1,   3,   5,  30,   5,   4,   1,
+      4,   3,  32,   3,   5,   1,  47,   1,  47,   1,
+};
+
+const RleImage imgGearLetterR = { 48, 60, 314, imgGearLetterR_spans };
+
+/* kmh.pbm, 64x24 px, 239 span bytes */
+static const uint8_t imgKmh_spans[239] = {
+     47,   2,  62,   3,  60,   3,  16,   1,  44,   3,   3,   1,  11,   3,  42,   3,
+      3,   3,  10,   3,  42,   3,   3,   3,  10,   3,  42,   2,   4,   3,  10,   3,
+     41,   3,   4,   3,  10,   3,   5,   2,   6,   6,   4,   6,  12,   2,   5,  10,
+      3,   3,   4,   3,   5,   8,   2,   8,  10,   3,   5,  11,   2,   3,   3,   4,
+      4,  20,   9,   3,   5,  11,   2,   3,   2,   4,   4,   4,   4,   6,   4,   3,
+      8,   3,   6,   4,   5,   3,   1,   8,   5,   3,   6,   4,   6,   3,   7,   3,
+      6,   3,   6,   3,   1,   6,   7,   2,   7,   3,   7,   3,   6,   3,   7,   3,
+      7,   2,   1,   6,   7,   2,   7,   3,   7,   3,   6,   3,   7,   3,   7,   8,
+      8,   2,   7,   3,   7,   3,   5,   3,   8,   3,   7,   9,   7,   2,   7,   3,
+      7,   3,   5,   3,   8,   3,   7,  10,   6,   2,   7,   3,   7,   3,   4,   3,
+      9,   3,   7,   6,   1,   4,   5,   2,   7,   3,   7,   3,   4,   3,   9,   3,
+      7,   6,   2,   4,   4,   2,   7,   3,   7,   3,   3,   3,  10,   3,   7,   6,
+      3,   4,   3,   2,   7,   3,   7,   3,   3,   3,  10,   3,   7,   6,   4,   3,
+      3,   2,   7,   3,   8,   2,   2,   3,  11,   3,   7,   3,   1,   1,   7,   1,
+      3,   1,   9,   1,   9,   1,   3,   3,  12,   1,   9,   1,  39,   1,  25,
+};
+
+const RleImage imgKmh = { 64, 24, 239, imgKmh_spans };
+
+/* odo.pbm, 96x36 px, 349 span bytes */
+static const uint8_t imgOdo_spans[349] = {
+    109,   6,  17,  12,  29,   5,  24,  12,  13,  16,  23,  12,  19,  15,  11,  18,
+     19,  15,  16,  18,  10,  19,  17,  18,  13,  20,   9,  20,  15,  20,  11,   8,
+      6,   8,   8,   4,  10,   7,  13,   8,   6,   8,   9,   7,  10,   7,   7,   4,
+     12,   6,  11,   6,  11,   7,   8,   5,  14,   6,   6,   4,  13,   6,   9,   6,
+     13,   6,   7,   5,  16,   5,   6,   4,  14,   5,   9,   5,  15,   6,   6,   5,
+     17,   5,   5,   4,  15,   5,   7,   5,  17,   5,   5,   5,  18,   5,   5,   4,
+     15,   5,   7,   5,  18,   5,   4,   4,  20,   4,   5,   4,  16,   5,   6,   4,
+     19,   5,   4,   4,  20,   5,   4,   4,  16,   5,   5,   5,  20,   4,   3,   5,
+     20,   5,   4,   4,  17,   4,   5,   4,  21,   5,   2,   5,  21,   4,   4,   4,
+     17,   4,   5,   4,  21,   5,   2,   4,  22,   4,   4,   4,  17,   4,   5,   4,
+     22,   4,   2,   4,  22,   4,   4,   4,  17,   4,   5,   4,  22,   4,   2,   4,
+     22,   4,   4,   4,  17,   4,   5,   4,  22,   4,   2,   4,  22,   4,   4,   4,
+     17,   4,   5,   4,  21,   5,   2,   5,  21,   4,   4,   4,  17,   4,   5,   4,
+     21,   5,   2,   5,  20,   5,   4,   4,  17,   4,   5,   4,  21,   5,   3,   4,
+     20,   5,   4,   4,  16,   5,   5,   5,  20,   4,   4,   5,  19,   4,   5,   4,
+     16,   5,   6,   4,  19,   5,   4,   5,  18,   5,   5,   4,  15,   5,   7,   5,
+     18,   5,   5,   5,  16,   6,   5,   4,  15,   5,   7,   6,  16,   5,   6,   6,
+     15,   5,   6,   4,  14,   5,   9,   5,  15,   6,   7,   6,  13,   5,   7,   4,
+     13,   6,   9,   6,  13,   6,   8,   7,  10,   7,   7,   4,  11,   7,  11,   7,
+     10,   6,  10,   9,   4,   9,   8,   4,   9,   8,  13,   8,   5,   9,  11,  20,
+      9,  20,  15,  20,  13,  18,  10,  19,  17,  17,  17,  14,  12,  18,  19,  15,
+     20,  10,  14,  16,  24,  10,  26,   2,  20,  10,  32,   2, 111,
+};
+
+const RleImage imgOdo = { 96, 36, 349, imgOdo_spans };
+
+/* km.pbm, 48x24 px, 165 span bytes */
+static const uint8_t imgKm_spans[165] = {
+     49,   2,  45,   4,  44,   4,  44,   4,  44,   4,  44,   4,   7,   3,   8,   7,
+      6,   7,   6,   4,   6,   4,   6,  10,   4,  10,   4,   4,   4,   6,   5,  12,
+      2,  12,   3,   4,   3,   6,   5,   6,   3,  11,   2,   6,   2,   4,   2,   5,
+      7,   4,   7,   7,   6,   5,   1,   4,   1,   5,   7,   4,   9,   5,   8,   4,
+      1,   9,   8,   4,   9,   4,  10,   3,   1,   8,   9,   3,  10,   4,  10,   3,
+      1,   7,  10,   3,  10,   4,  10,   3,   1,   8,   9,   3,  10,   4,  10,   3,
+      1,   9,   8,   3,  10,   4,  10,   3,   1,   4,   1,   5,   7,   3,  10,   4,
+     10,   3,   1,   4,   2,   6,   5,   3,  10,   4,  10,   3,   1,   4,   3,   6,
+      4,   3,  10,   4,  10,   3,   1,   4,   4,   6,   3,   3,  10,   4,  10,   3,
+      1,   4,   6,   4,   3,   3,  10,   4,  10,   3,   2,   2,   8,   2,   4,   3,
+     11,   2,  11,   3,  49,
+};
+
+const RleImage imgKm = { 48, 24, 165, imgKm_spans };
+
+/* engspd.pbm, 176x36 px, 641 span bytes */
+static const uint8_t imgEngSpd_spans[641] = {
+    177,  20,   4,   3,  14,   4,  14,  11,  31,  10,  10,  16,  11,  10,  18,  21,
+      3,   4,  13,   4,  12,  15,  27,  14,   8,  19,   7,  16,  13,  21,   3,   5,
+     12,   4,  10,  19,  23,  18,   6,  21,   5,  19,  10,  21,   3,   5,  12,   4,
+      9,  21,  21,  20,   5,  22,   4,  20,   9,   4,  20,   6,  11,   4,   8,   7,
+      9,   7,  20,   6,   9,   5,   5,   4,  11,   7,   4,   5,   8,   9,   7,   4,
+     20,   6,  11,   4,   7,   6,  13,   6,  18,   5,  12,   5,   4,   4,  13,   6,
+      3,   4,  12,   7,   6,   4,  20,   7,  10,   4,   6,   6,  15,   6,  17,   4,
+     14,   4,   4,   4,  14,   5,   3,   4,  13,   6,   6,   4,  20,   7,  10,   4,
+      6,   5,  17,   4,  18,   4,  14,   4,   4,   4,  15,   4,   3,   4,  15,   5,
+      5,   4,  20,   8,   9,   4,   5,   5,  19,   2,  19,   4,  14,   4,   4,   4,
+     15,   5,   2,   4,  16,   5,   4,   4,  20,   8,   9,   4,   5,   4,  41,   4,
+     22,   4,  15,   5,   2,   4,  16,   5,   4,   4,  20,   4,   1,   4,   8,   4,
+      4,   5,  41,   4,  22,   4,  16,   4,   2,   4,  17,   5,   3,   4,  20,   4,
+      1,   4,   8,   4,   4,   4,  42,   5,  21,   4,  15,   5,   2,   4,  17,   5,
+      3,   4,  20,   4,   2,   4,   7,   4,   4,   4,  42,   6,  20,   4,  15,   5,
+      2,   4,  18,   4,   3,  19,   5,   4,   2,   5,   6,   4,   3,   5,  43,   7,
+     18,   4,  15,   4,   3,   4,  18,   4,   3,  19,   5,   4,   3,   4,   6,   4,
+      3,   5,  44,   9,  15,   4,  14,   5,   3,   4,  18,   4,   3,  19,   5,   4,
+      3,   5,   5,   4,   3,   4,  46,  12,  11,   4,  12,   7,   3,   4,  18,   4,
+      3,  19,   5,   4,   4,   4,   5,   4,   3,   4,  10,  18,  19,  14,   8,  22,
+      4,   4,  19,   3,   3,   4,  20,   4,   4,   5,   4,   4,   3,   4,  10,  18,
+     21,  14,   6,  21,   5,   4,  19,   3,   3,   4,  20,   4,   5,   4,   4,   4,
+      3,   4,  10,  18,  24,  12,   5,  20,   6,   4,  18,   4,   3,   4,  20,   4,
+      6,   4,   3,   4,   3,   5,   9,  18,  28,   9,   4,  18,   8,   4,  18,   4,
+      3,   4,  20,   4,   6,   4,   3,   4,   3,   5,  22,   5,  31,   7,   3,   4,
+     22,   4,  18,   4,   3,   4,  20,   4,   7,   4,   2,   4,   4,   4,  22,   4,
+     34,   5,   3,   4,  22,   4,  18,   4,   3,   4,  20,   4,   7,   4,   2,   4,
+      4,   4,  22,   4,  35,   4,   3,   4,  22,   4,  18,   4,   3,   4,  20,   4,
+      8,   4,   1,   4,   4,   5,  21,   4,  35,   5,   2,   4,  22,   4,  17,   5,
+      3,   4,  20,   4,   8,   9,   4,   5,  20,   5,  35,   5,   2,   4,  22,   4,
+     16,   5,   4,   4,  20,   4,   9,   8,   5,   5,  18,   5,  16,   4,  16,   5,
+      2,   4,  22,   4,  16,   5,   4,   4,  20,   4,   9,   8,   5,   6,  17,   5,
+     16,   5,  15,   5,   2,   4,  22,   4,  15,   5,   5,   4,  20,   4,  10,   7,
+      6,   6,  15,   5,  17,   5,  15,   4,   3,   4,  22,   4,  14,   6,   5,   4,
+     20,   4,  10,   7,   7,   6,  13,   6,  18,   5,  13,   5,   3,   4,  22,   4,
+     12,   7,   6,   4,  20,   4,  11,   6,   7,   8,   9,   7,  19,   6,  11,   5,
+      4,   4,  22,   5,   9,   8,   7,  21,   3,   4,  11,   6,   8,  22,  21,   8,
+      4,   9,   4,   4,  22,  21,   8,  21,   3,   4,  12,   5,  10,  19,  23,  19,
+      5,   4,  22,  19,  10,  21,   3,   4,  13,   4,  11,  16,  26,  16,   7,   4,
+     22,  17,  12,  21,   3,   3,  14,   4,  13,  12,  30,  12,   9,   4,  23,  12,
+    191,
+};
+
+const RleImage imgEngSpd = { 176, 36, 641, imgEngSpd_spans };
+
+/* rpm.pbm, 64x24 px, 285 span bytes */
+static const uint8_t imgRpm_spans[285] = {
+     65,  15,   6,  15,   5,   4,  14,   3,   2,  16,   5,  16,   4,   4,  13,   4,
+      2,   3,   9,   5,   4,   3,   9,   5,   3,   5,  12,   4,   2,   3,  11,   4,
+      3,   3,  11,   4,   2,   5,  12,   4,   2,   3,  12,   3,   3,   3,  11,   4,
+      2,   5,  11,   5,   2,   3,  12,   4,   2,   3,  12,   3,   2,   6,  10,   5,
+      2,   3,  12,   4,   2,   3,  12,   3,   2,   6,   9,   6,   2,   3,  12,   3,
+      3,   3,  12,   3,   2,   7,   8,   6,   2,   3,  11,   4,   3,   3,  11,   4,
+      2,   3,   1,   3,   8,   6,   2,   3,  10,   5,   3,   3,  10,   4,   3,   3,
+      1,   3,   7,   3,   1,   3,   2,  17,   4,  17,   3,   3,   2,   3,   6,   3,
+      1,   3,   2,  16,   5,  16,   4,   3,   2,   3,   6,   3,   1,   3,   2,  14,
+      7,  14,   6,   3,   2,   3,   5,   3,   2,   3,   2,   3,   4,   4,  10,   3,
+     17,   3,   3,   3,   4,   3,   2,   3,   2,   3,   5,   4,   9,   3,  17,   3,
+      3,   3,   3,   3,   3,   3,   2,   3,   6,   4,   8,   3,  17,   3,   4,   3,
+      2,   3,   3,   3,   2,   3,   7,   3,   8,   3,  17,   3,   4,   3,   2,   3,
+      3,   3,   2,   3,   7,   4,   7,   3,  17,   3,   4,   3,   1,   3,   4,   3,
+      2,   3,   8,   4,   6,   3,  17,   3,   5,   6,   4,   3,   2,   3,   9,   4,
+      5,   3,  17,   3,   5,   6,   4,   3,   2,   3,  10,   4,   4,   3,  17,   3,
+      5,   5,   5,   3,   2,   3,  10,   4,   4,   3,  17,   3,   6,   4,   5,   3,
+      2,   3,  11,   4,   3,   3,  17,   3,   6,   3,   6,   3,   1,
+};
+
+const RleImage imgRpm = { 64, 24, 285, imgRpm_spans };
+
+/* watertemp.pbm, 64x64 px, 215 span bytes */
+static const uint8_t imgWaterTemp_spans[215] = {
+     93,   4,  59,   6,  58,   6,  58,   6,  58,   6,  58,   6,  58,   6,  58,   6,
+     58,   6,  58,  20,  44,  20,  44,  20,  44,  20,  44,   6,  58,   6,  58,   6,
+     58,   6,  58,   6,  58,   6,  58,  19,  45,  20,  44,  20,  44,  20,  44,   6,
+     58,   6,  58,   6,  58,   6,  58,   6,  58,   6,  58,  20,  44,  20,  44,  20,
+     44,  20,  44,   6,  58,   6,  58,   6,  58,   6,  58,   6,  58,   6,  33,   8,
+     16,   8,  13,   7,   9,  13,  13,  10,   9,  13,   7,  14,  10,  11,   8,  15,
+      6,   6,   2,  11,   5,  12,   6,   7,   3,   9,   3,   1,   9,  11,   3,  12,
+      5,   5,   9,   7,  14,   9,   2,  13,   6,   3,  12,   5,  16,   6,   4,  12,
+      7,   1,  15,   2,  27,  12,  52,  12,  53,  10,  55,   8,  58,   4, 116,   2,
+     15,   6,  38,   7,  12,   9,  35,   9,  10,  11,  11,   1,   9,   3,   9,  12,
+      7,  13,   8,   4,   8,   4,   7,   5,   3,   6,   6,   4,   5,   4,   7,   6,
+      7,   6,   4,   5,   5,   6,   4,   4,   7,   4,   5,   6,   9,  13,   8,  11,
+      8,   5,   1,   7,  12,  11,  10,  10,   9,  11,  15,   8,  13,   6,  12,   8,
+     19,   4,  17,   2,  15,   6,  74,
+};
+
+const RleImage imgWaterTemp = { 64, 64, 215, imgWaterTemp_spans };
+
+/* abs.pbm, 80x64 px, 603 span bytes */
+static const uint8_t imgAbs_spans[603] = {
+    193,  14,  63,  20,  41,   2,  14,  25,  15,   2,  22,   3,  12,  28,  12,   3,
+     21,   5,   9,  31,  10,   5,  19,   7,   7,  14,   6,  14,   7,   7,  17,   8,
+      6,  10,  15,  11,   6,   8,  16,   8,   5,   9,  19,  10,   5,   8,  15,   8,
+      5,   8,  23,   9,   5,   8,  14,   7,   5,   8,  26,   8,   5,   7,  13,   7,
+      5,   8,  28,   8,   5,   7,  12,   7,   4,   7,  31,   7,   5,   7,  11,   7,
+      4,   7,  33,   7,   5,   7,  10,   7,   4,   7,  34,   7,   4,   7,   9,   7,
+      4,   7,  36,   6,   5,   7,   8,   7,   4,   6,  38,   6,   4,   7,   8,   6,
+      4,   6,  39,   6,   5,   7,   6,   7,   4,   6,  40,   6,   4,   7,   6,   7,
+      3,   6,  41,   6,   4,   7,   6,   6,   4,   6,  42,   5,   5,   6,   6,   6,
+      4,   5,  43,   6,   4,   6,   5,   7,   3,   6,   7,   4,   7,   8,   8,   7,
+      2,   6,   4,   7,   4,   7,   3,   6,   6,   5,   7,  10,   5,   8,   3,   5,
+      4,   7,   4,   6,   4,   5,   7,   5,   7,   3,   4,   3,   4,   4,   3,   2,
+      3,   6,   4,   6,   4,   6,   4,   5,   7,   2,   1,   3,   6,   3,   5,   3,
+      3,   3,   9,   6,   4,   6,   4,   6,   4,   5,   7,   2,   1,   3,   6,   3,
+      5,   3,   3,   2,  11,   5,   4,   6,   4,   6,   4,   5,   6,   3,   2,   2,
+      6,   3,   5,   3,   3,   3,  10,   5,   4,   6,   4,   6,   4,   5,   6,   2,
+      3,   3,   5,   3,   4,   3,   4,   4,   9,   5,   4,   7,   2,   7,   3,   6,
+      6,   2,   3,   3,   5,   9,   6,   5,   7,   5,   4,   7,   2,   7,   3,   6,
+      5,   3,   3,   3,   5,   9,   7,   6,   5,   5,   4,   7,   2,   7,   3,   6,
+      5,   3,   4,   3,   4,  10,   7,   6,   4,   5,   4,   7,   2,   7,   3,   6,
+      5,   3,   4,   3,   4,   3,   5,   3,   9,   4,   3,   5,   4,   7,   3,   6,
+      4,   5,   5,  10,   4,   3,   5,   4,   9,   3,   3,   5,   4,   7,   3,   6,
+      4,   5,   4,  11,   4,   3,   5,   4,   9,   3,   3,   5,   4,   6,   4,   6,
+      4,   5,   4,   3,   6,   3,   3,   3,   5,   4,   9,   3,   3,   5,   4,   6,
+      4,   6,   4,   5,   3,   3,   7,   3,   3,   3,   5,   3,  10,   3,   2,   6,
+      4,   6,   4,   7,   3,   5,   3,   3,   7,   3,   3,   3,   3,   5,   3,   3,
+      2,   4,   3,   5,   5,   6,   4,   7,   3,   6,   2,   3,   7,   4,   2,  10,
+      3,   9,   4,   5,   4,   7,   4,   7,   4,   5,   2,   2,   9,   2,   4,   6,
+      8,   5,   5,   6,   4,   7,   5,   6,   4,   6,  42,   6,   4,   6,   6,   6,
+      4,   6,  42,   5,   5,   6,   6,   7,   4,   5,  41,   6,   4,   7,   6,   7,
+      4,   6,  39,   7,   4,   7,   7,   7,   3,   7,  38,   6,   4,   7,   8,   7,
+      4,   6,  37,   7,   4,   7,   8,   7,   5,   6,  36,   6,   5,   7,   9,   7,
+      4,   7,  34,   6,   5,   7,  10,   8,   4,   7,  32,   7,   4,   8,  11,   7,
+      4,   8,  30,   7,   5,   7,  12,   8,   4,   8,  28,   7,   5,   8,  13,   7,
+      5,   8,  25,   8,   6,   7,  14,   8,   5,   9,  22,   9,   5,   8,  15,   8,
+      5,  10,  18,  10,   5,   8,  17,   7,   6,  11,  13,  11,   7,   7,  18,   7,
+      7,  33,   8,   7,  19,   5,  10,  30,  10,   5,  21,   3,  12,  27,  13,   3,
+     23,   1,  15,  23,  16,   1,  43,  18,  65,  12, 194,
+};
+
+const RleImage imgAbs = { 80, 64, 603, imgAbs_spans };
+
+/* battery.pbm, 96x64 px, 253 span bytes */
+static const uint8_t imgBattery_spans[253] = {
+    206,  20,  25,  20,  31,  21,  23,  21,  31,  21,  23,  21,  31,  21,  23,  21,
+     31,  21,  23,  21,  31,  21,  23,  21,  31,  21,  23,  21,  21,  85,  10,  87,
+      9,  87,   9,  87,   9,   6,  76,   5,   9,   5,  77,   5,   9,   5,  77,   5,
+      9,   5,  77,   5,   9,   5,  77,   5,   9,   5,  15,   2,  60,   5,   9,   5,
+     15,   2,  60,   5,   9,   5,  15,   2,  60,   5,   9,   5,  15,   2,  60,   5,
+      9,   5,  15,   2,  60,   5,   9,   5,  15,   2,  41,  10,   9,   5,   9,   5,
+     10,  13,  35,  10,   9,   5,   9,   5,  10,  12,  55,   5,   9,   5,  15,   3,
+     59,   5,   9,   5,  15,   2,  60,   5,   9,   5,  15,   2,  60,   5,   9,   5,
+     15,   2,  60,   5,   9,   5,  15,   2,  60,   5,   9,   5,  77,   5,   9,   5,
+     77,   5,   9,   5,  77,   5,   9,   5,  77,   5,   9,   5,  77,   5,   9,   5,
+     77,   5,   9,   5,  77,   5,   9,   5,  77,   5,   9,   5,  77,   5,   9,   5,
+     77,   5,   9,   5,  77,   5,   9,   5,  77,   5,   9,   5,  77,   5,   9,   5,
+     77,   5,   9,   5,  77,   5,   9,   5,  77,   5,   9,   5,  77,   5,   9,   5,
+     77,   5,   9,   5,  77,   5,   9,   5,  77,   5,   9,   5,  77,   5,   9,   5,
+     77,   5,   9,   5,  77,   5,   9,   5,  77,   5,   9,   5,  77,   5,   9,   5,
+     77,   5,   9,  87,   9,  87,   9,  87,  10,  86,  10,  85, 199,
+};
+
+const RleImage imgBattery = { 96, 64, 253, imgBattery_spans };
+
+/* enginecheck.pbm, 88x64 px, 545 span bytes */
+static const uint8_t imgEngineCheck_spans[545] = {
+    199,  32,  55,  34,  54,  34,  55,  32,  69,   6,  83,   4,  84,   4,  84,   4,
+     70,  32,  54,  36,  52,  37,  50,  38,  50,  38,  50,   5,  28,   5,  49,   6,
+     29,   4,  42,  13,  29,   4,  32,   4,   5,  14,  29,   4,  32,   5,   4,  14,
+     29,  12,  24,   5,   4,  14,  29,  14,  22,   5,   4,   5,  38,  15,  21,   5,
+      4,   4,  39,  16,   5,   6,   9,   5,   4,   4,  39,  16,   3,  11,   6,   5,
+      4,   4,  50,   5,   3,  11,   6,   5,   4,   4,  50,   5,   2,  13,   5,   5,
+      4,   4,  50,   5,   2,  13,   5,   5,   4,   4,   9,   3,   3,   1,   3,   1,
+      2,   4,   3,   3,   3,   1,   3,   1,  10,   5,   2,   5,   3,   6,   4,   5,
+      4,   4,   8,   1,   3,   1,   2,   1,   3,   1,   2,   1,   5,   1,   3,   1,
+      2,   1,   2,   1,  11,   5,   2,   5,   4,   5,   4,   5,   4,   4,   8,   1,
+      6,   1,   3,   1,   2,   1,   5,   1,   6,   1,   1,   1,  12,  12,   4,   5,
+      4,   5,   4,   4,   8,   1,   6,   5,   2,   4,   2,   1,   6,   3,  12,  12,
+      4,   5,   4,   5,   4,   4,   8,   1,   6,   1,   3,   1,   2,   1,   5,   1,
+      6,   1,   2,   1,  11,  12,   4,   5,   4,  13,   8,   1,   3,   1,   2,   1,
+      3,   1,   2,   1,   5,   1,   3,   1,   2,   1,   2,   2,  10,  12,   4,   5,
+      4,  13,   9,   3,   3,   1,   3,   1,   2,   4,   3,   3,   3,   1,   3,   1,
+     10,  12,   4,   5,   4,  13,  67,   4,   4,  13,  67,   4,   4,  13,  67,   4,
+      4,   5,   3,   5,  67,   4,   4,   5,   4,   4,   6,   5,   2,   1,   3,   1,
+      3,   3,   3,   1,   2,   1,   3,   1,   2,   4,  26,   4,   4,   5,   4,   4,
+      6,   2,   5,   2,   2,   1,   2,   1,   3,   1,   2,   1,   2,   2,   2,   1,
+      2,   1,  29,   4,   4,   5,   4,   4,   6,   2,   5,   2,   2,   1,   2,   1,
+      6,   1,   2,   2,   2,   1,   2,   1,  29,   4,   4,   5,   4,   4,   6,   5,
+      2,   1,   1,   1,   1,   1,   2,   1,   2,   2,   2,   1,   2,   1,   1,   1,
+      1,   1,   2,   4,  26,   4,   4,   5,   4,   4,   6,   1,   6,   1,   1,   3,
+      2,   1,   3,   2,   1,   1,   2,   1,   1,   3,   2,   1,  29,   4,   4,   5,
+      4,   4,   6,   2,   5,   1,   2,   2,   2,   1,   3,   2,   1,   1,   2,   1,
+      2,   2,   2,   1,  29,   4,   4,   5,   4,   4,   6,   5,   2,   1,   3,   1,
+      3,   4,   2,   1,   2,   1,   3,   1,   2,   4,   9,  12,   4,   5,   4,   5,
+      4,   4,  50,  12,   4,   5,   4,   5,   4,   4,  50,  12,   4,   5,   4,   5,
+      4,   4,  50,  12,   4,   5,   4,   5,   4,  18,  36,  12,   4,   5,   4,   5,
+      4,  19,  35,   5,   2,   5,   4,   5,   4,   5,   4,  21,  33,   5,   2,   5,
+      4,   5,   5,   3,   6,  21,  32,   5,   2,  13,  16,  22,  30,   5,   2,  13,
+     31,   8,  29,   5,   2,  13,  32,   9,  27,   5,   3,  11,  35,   8,  26,   5,
+      4,   9,  37,   9,  24,   5,  52,  36,  53,  35,  55,  32,  57,  30,  59,  28,
+    197,
+};
+
+const RleImage imgEngineCheck = { 88, 64, 545, imgEngineCheck_spans };
+
+/* dashboard.pbm, 800x480 px, 10485 span bytes */
+static const uint8_t imgDashboard_spans[10485] = {
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 150, 255,   0, 255,   0,  71, 219, 255,
+      0, 255,   0,  71, 218, 255,   0, 255,   0,  72, 217,   1,   1, 255,   0, 255,
+      0,  71, 216,   1,   1, 255,   0, 255,   0,  72, 215,   1,   1,   1,   1, 255,
+      0, 255,   0,  71, 214,   3,   1, 255,   0, 255,   0,  72, 214,   4,   1, 255,
+      0, 255,   0,  71, 213,   1,   1, 255,   0, 255,   0,  75, 212,   1,   1,   1,
+      1, 255,   0, 255,   0,  64, 221,   1,   1,   1,   1,   1,   1,   4,   1,   1,
+      1,   1,   1,   1,   1,   1,  50,  11, 239,  11, 255,   0, 215,   1,   1,   1,
+      1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1,  51,  11, 239,  11,
+    255,   0, 214,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,
+      1,   1,  52,  11, 239,  11, 255,   0, 213,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   4,   1,   1,  53,  11, 239,  11, 255,   0, 212,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,  54,  11,
+    239,  11, 255,   0, 211,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   3,  54,  11, 239,  11, 255,   0, 210,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+     55,  11, 239,  11, 255,   0, 209,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,  56,  11, 239,  11, 255,   0,
+    208,   3,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,  57,  11, 239,  11, 111,   6,   7,   6,   7,   6, 255,   0,  65,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,  58,  11,
+    239,  11, 110,   8,   5,   8,   5,   8, 255,   0,  63,   1,   1,   4,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,  59,  11, 239,  11, 109,   3,
+      4,   3,   3,   3,   4,   3,   3,   3,   4,   3, 255,   0,  61,   1,   1,   1,
+      1,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,  60,  11, 239,  11,
+    109,   2,   6,   2,   3,   2,   6,   2,   3,   2,   6,   2, 255,   0,  60,   1,
+      1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1,  61,  11,
+    239,  11, 117,   2,   2,   2,   8,   1,   2,   2,   8,   2, 255,   0,  58,   1,
+      1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1,  62,  11,
+    239,  11, 116,   3,   2,   2,   8,   1,   2,   2,   8,   2, 255,   0,  57,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,  63,  11,
+    239,  11, 115,   3,   3,   2,   8,   1,   2,   2,   8,   2, 255,   0,  56,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,  64,  11,
+    239,  11, 114,   3,   4,   2,   8,   1,   2,   2,   8,   2, 255,   0,  55,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,  65,  11,
+     10,  20,   4,   3,  14,   4,  14,  11,  31,  10,  10,  16,  11,  10,  71,  11,
+    113,   3,   5,   2,   8,   1,   2,   2,   8,   2, 255,   0,  54,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   3,  65,  11,
+     10,  21,   3,   4,  13,   4,  12,  15,  27,  14,   8,  19,   7,  16,  66,  11,
+    112,   3,   6,   2,   8,   1,   2,   2,   8,   2, 255,   0,  53,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+     66,  11,  10,  21,   3,   5,  12,   4,  10,  19,  23,  18,   6,  21,   5,  19,
+     63,  11, 111,   3,   7,   2,   8,   1,   2,   2,   8,   2, 255,   0,  52,   3,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+     67,  11,  10,  21,   3,   5,  12,   4,   9,  21,  21,  20,   5,  22,   4,  20,
+     62,  11, 110,   3,   8,   2,   8,   1,   2,   2,   8,   2, 255,   0,  52,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,  68,  11,
+     10,   4,  20,   6,  11,   4,   8,   7,   9,   7,  20,   6,   9,   5,   5,   4,
+     11,   7,   4,   5,   8,   9,  60,  11, 109,   3,  10,   2,   6,   2,   3,   2,
+      6,   2, 255,   0,  52,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,  69,  11,  10,   4,  20,   6,  11,   4,   7,   6,  13,   6,
+     18,   5,  12,   5,   4,   4,  13,   6,   3,   4,  12,   7,  59,  11, 108,   3,
+     11,   3,   4,   3,   3,   3,   4,   3, 255,   0,  51,   1,   1,   1,   1,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,  70,  11,  10,   4,  20,   7,
+     10,   4,   6,   6,  15,   6,  17,   4,  14,   4,   4,   4,  14,   5,   3,   4,
+     13,   6,  59,  11, 108,  11,   4,   8,   5,   8, 255,   0,  51,   1,   1,   1,
+      1,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1,  71,  11,  10,   4,
+     20,   7,  10,   4,   6,   5,  17,   4,  18,   4,  14,   4,   4,   4,  15,   4,
+      3,   4,  15,   5,  58,  11, 108,  11,   5,   6,   7,   6, 255,   0,  51,   1,
+      1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1,  72,  11,
+     10,   4,  20,   8,   9,   4,   5,   5,  19,   2,  19,   4,  14,   4,   4,   4,
+     15,   5,   2,   4,  16,   5,  57,  11, 255,   0, 193,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   4,   1,   1,   1,   1,  73,  11,  10,   4,  20,   8,
+      9,   4,   5,   4,  41,   4,  22,   4,  15,   5,   2,   4,  16,   5,  57,  11,
+     54,   2,   5,  11,   5,   6, 255,   0, 109,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   4,   1,   1,  74,  11,  10,   4,  20,   4,   1,   4,
+      8,   4,   4,   5,  41,   4,  22,   4,  16,   4,   2,   4,  17,   5,  56,  11,
+     53,   3,   5,  11,   4,   8, 255,   0, 107,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   4,  75,  11,  10,   4,  20,   4,   1,   4,
+      8,   4,   4,   4,  42,   5,  21,   4,  15,   5,   2,   4,  17,   5,  56,  11,
+     52,   4,   5,   2,  12,   3,   4,   3, 255,   0, 105,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   3,  75,  11,  10,   4,
+     20,   4,   2,   4,   7,   4,   4,   4,  42,   6,  20,   4,  15,   5,   2,   4,
+     18,   4,  56,  11,  51,   5,   5,   2,  12,   2,   6,   2, 255,   0, 104,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,  76,  11,  10,  19,   5,   4,   2,   5,   6,   4,   3,   5,  43,   7,
+     18,   4,  15,   4,   3,   4,  18,   4,  56,  11,  50,   2,   1,   3,   5,   2,
+      1,   6,   4,   2,   8,   2,  90,   6,   4,  11,   5,   6, 235,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+     77,  11,  10,  19,   5,   4,   3,   4,   6,   4,   3,   5,  44,   9,  15,   4,
+     14,   5,   3,   4,  18,   4,  56,  11,  49,   2,   2,   3,   5,  10,   3,   2,
+      8,   2,  89,   8,   3,  11,   4,   8, 233,   3,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,  78,  11,  10,  19,   5,   4,
+      3,   5,   5,   4,   3,   4,  46,  12,  11,   4,  12,   7,   3,   4,  18,   4,
+     56,  11,  48,   2,   3,   3,   5,   3,   5,   3,   2,   2,   8,   2,  88,   3,
+      4,   3,   2,   2,  12,   3,   4,   3, 232,   4,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,  79,  11,  10,  19,   5,   4,   4,   4,
+      5,   4,   3,   4,  10,  18,  19,  14,   8,  22,   4,   4,  19,   3,  56,  11,
+     53,   3,  14,   2,   2,   2,   8,   2,  88,   2,   6,   2,   2,   2,  12,   2,
+      6,   2, 231,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,  80,  11,  10,   4,  20,   4,   4,   5,   4,   4,   3,   4,  10,  18,
+     21,  14,   6,  21,   5,   4,  19,   3,  56,  11,  53,   3,  14,   2,   2,   2,
+      8,   2,  96,   2,   2,   2,   1,   6,   4,   2,   8,   2, 229,   1,   1,   1,
+      1,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,  81,  11,  10,   4,
+     20,   4,   5,   4,   4,   4,   3,   4,  10,  18,  24,  12,   5,  20,   6,   4,
+     18,   4,  56,  11,  53,   3,  14,   2,   2,   2,   8,   2,  95,   3,   2,  10,
+      3,   2,   8,   2, 228,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,
+      1,   1,   1,   1,  82,  11,  10,   4,  20,   4,   6,   4,   3,   4,   3,   5,
+      9,  18,  28,   9,   4,  18,   8,   4,  18,   4,  56,  11,  53,   3,  14,   2,
+      2,   2,   8,   2,  94,   3,   3,   3,   5,   3,   2,   2,   8,   2, 227,   1,
+      1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1,  83,  11,
+     10,   4,  20,   4,   6,   4,   3,   4,   3,   5,  22,   5,  31,   7,   3,   4,
+     22,   4,  18,   4,  56,  11,  53,   3,   5,   2,   6,   3,   2,   2,   8,   2,
+     93,   3,  13,   2,   2,   2,   8,   2, 226,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   4,   1,   1,   1,   1,  84,  11,  10,   4,  20,   4,   7,   4,
+      2,   4,   4,   4,  22,   4,  34,   5,   3,   4,  22,   4,  18,   4,  56,  11,
+     53,   3,   6,   3,   3,   4,   3,   2,   6,   2,  93,   3,  14,   2,   2,   2,
+      8,   2, 225,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,
+      1,   1,  85,  11,  10,   4,  20,   4,   7,   4,   2,   4,   4,   4,  22,   4,
+     35,   4,   3,   4,  22,   4,  18,   4,  56,  11,  53,   3,   7,   8,   4,   3,
+      4,   3,  92,   3,  15,   2,   2,   2,   8,   2, 224,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   4,  86,  11,  10,   4,  20,   4,
+      8,   4,   1,   4,   4,   5,  21,   4,  35,   5,   2,   4,  22,   4,  17,   5,
+     56,  11,  48,  11,   5,   6,   6,   8,  92,   3,  16,   2,   2,   2,   8,   2,
+    223,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   3,  86,  11,  10,   4,  20,   4,   8,   9,   4,   5,  20,   5,  35,   5,
+      2,   4,  22,   4,  16,   5,  57,  11,  48,  11,  18,   6,  92,   3,   8,   2,
+      6,   3,   2,   2,   8,   2, 222,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,  87,  11,  10,   4,  20,   4,
+      9,   8,   5,   5,  18,   5,  16,   4,  16,   5,   2,   4,  22,   4,  16,   5,
+     57,  11, 174,   3,  10,   3,   3,   4,   3,   2,   6,   2, 222,   3,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,  88,  11,
+     10,   4,  20,   4,   9,   8,   5,   6,  17,   5,  16,   5,  15,   5,   2,   4,
+     22,   4,  15,   5,  58,  11, 173,   3,  12,   8,   4,   3,   4,   3, 222,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,  89,  11,
+     10,   4,  20,   4,  10,   7,   6,   6,  15,   5,  17,   5,  15,   4,   3,   4,
+     22,   4,  14,   6,  58,  11, 173,  11,   5,   6,   6,   8, 222,   1,   1,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,  90,  11,  10,   4,
+     20,   4,  10,   7,   7,   6,  13,   6,  18,   5,  13,   5,   3,   4,  22,   4,
+     12,   7,  59,  11, 173,  11,  18,   6, 222,   1,   1,   1,   1,   4,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,  91,  11,  10,   4,  20,   4,  11,   6,
+      7,   8,   9,   7,  19,   6,  11,   5,   4,   4,  22,   5,   9,   8,  60,  11,
+    255,   0, 174,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1,
+      1,   1,  92,  11,  10,  21,   3,   4,  11,   6,   8,  22,  21,   8,   4,   9,
+      4,   4,  22,  21,  61,  11, 255,   0, 173,   1,   1,   1,   1,   1,   1,   1,
+      1,   4,   1,   1,   1,   1,   1,   1,  93,  11,  10,  21,   3,   4,  12,   5,
+     10,  19,  23,  19,   5,   4,  22,  19,  63,  11, 255,   0, 172,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,  94,  11,  10,  21,
+      3,   4,  13,   4,  11,  16,  26,  16,   7,   4,  22,  17,  65,  11, 255,   0,
+    171,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,
+     95,  11,  10,  21,   3,   3,  14,   4,  13,  12,  30,  12,   9,   4,  23,  12,
+     69,  11, 255,   0, 170,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   4,  96,  11, 239,  11, 255,   0, 169,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   3,  96,  11, 239,  11,
+    255,   0, 168,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,  97,  11, 239,  11, 255,   0, 167,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+     98,  11, 239,  11, 255,   0, 166,   3,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,  99,  11, 239,  11, 255,   0, 166,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 100,  11,
+    239,  11, 255,   0, 165,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1, 101,  11, 239,  11, 255,   0, 164,   1,   1,   1,   1,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 102,  11, 239,  11, 255,   0,
+    163,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1,
+    103,  11, 239,  11, 130,   1, 255,   0,  31,   1,   1,   1,   1,   1,   1,   1,
+      1,   4,   1,   1,   1,   1,   1,   1, 104,  11, 239,  11, 129,   2, 255,   0,
+     30,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,
+    105,  11, 239,  11, 129,   2, 255,   0,  29,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   4,   1,   1, 106,  11, 239,  11, 129,   2, 255,   0,
+     28,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,
+    107,  11, 239,  11, 129,   2, 255,   0,  27,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   3, 107,  11, 239,  11, 129,   2,
+    255,   0,  26,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 108,  11, 239,  11, 129,   2, 255,   0,  25,   3,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    109,  11, 239,  11, 121,  17, 255,   0,  18,   4,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1, 110,  11, 239,  11, 116,   5,   1,  15,
+      1,   5, 255,   0,  12,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1, 111,  11, 239,  11, 112,  35, 255,   0,   7,   1,   1,   1,
+      1,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 112,  11, 239,  11,
+    108,  43, 255,   0,   2,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,
+      1,   1,   1,   1, 113,  11, 239,  11, 106,   2,   1,  41,   1,   2, 254,   1,
+      1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1, 114,  11,
+    239,  11,  91,   1,  11,  53,  12,   2, 236,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   4,   1,   1,   1,   1, 115,  11, 239,  11,  90,   1,   1,   1,
+      8,   2,   1,  51,   1,   2,   9,   2, 236,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   4,   1,   1, 116,  11, 239,  11,  89,   1,   1,   2,
+      6,  61,   6,   3, 235,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   4, 117,  11, 239,  11,  90,   4,   3,   4,   1,   4,   1,   5,
+      1,  33,   1,   5,   1,   4,   1,   4,   4,   2, 235,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   3, 117,  11, 239,  11,
+     91,   4,   1,   1,   1,   1,   1,  16,   1,   5,  15,   5,   1,  16,   1,   1,
+      1,   1,   2,   3, 234,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1, 118,  11, 239,  11,  91,  18,   1,   7,
+     25,   7,   1,  17, 234,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1, 119,  11, 239,  11,  14,   2,   8,   6,
+      7,   6,  49,  12,   1,   8,  33,   8,   1,  12, 233,   3,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 120,  11, 239,  11,
+     13,   3,   7,   8,   5,   8,  47,   5,   1,   5,   1,   7,  39,   7,   1,   5,
+      1,   5, 232,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1, 121,  11, 239,  11,  12,   4,   6,   3,   4,   3,   3,   3,   4,   3,
+     45,   1,   1,   6,   1,   1,   1,   6,  45,   6,   1,   1,   1,   6,   1,   1,
+    230,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    122,  11, 239,  11,  11,   5,   6,   2,   6,   2,   3,   2,   6,   2,  44,   4,
+      1,  11,  49,  11,   1,   4, 228,   1,   1,   1,   1,   4,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 123,  11, 239,  11,  10,   2,   1,   3,   5,   2,
+      8,   1,   2,   2,   8,   2,  41,   3,   1,   4,   1,   7,  53,   7,   1,   4,
+      1,   3, 225,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1,
+      1,   1, 124,  11, 239,  11,   9,   2,   2,   3,   5,   2,   8,   1,   2,   2,
+      8,   2,  40,   1,   1,   4,   1,   4,   1,   1,   1,   1,  57,   1,   1,   1,
+      1,   4,   1,   4,   1,   1,  49,   6,   7,   6,   7,   6, 142,   1,   1,   1,
+      1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1, 125,  11, 239,  11,
+      8,   2,   3,   3,   5,   2,   8,   1,   2,   2,   8,   2,  39,   1,   1,   2,
+      1,   4,   1,   5,  59,   5,   1,   4,   1,   2,   1,   1,  47,   8,   5,   8,
+      5,   8, 140,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,
+      1,   1, 126,  11, 239,  11,  13,   3,   5,   2,   8,   1,   2,   2,   8,   2,
+     38,   1,   1,   5,   1,   4,   1,   1,  63,   1,   1,   4,   1,   5,   1,   1,
+     45,   3,   4,   3,   3,   3,   4,   3,   3,   3,   4,   3, 138,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1, 127,  11, 239,  11,
+     13,   3,   5,   2,   8,   1,   2,   2,   8,   2,  37,   5,   1,   4,   1,   3,
+     65,   3,   1,   4,   1,   5,  44,   2,   6,   2,   3,   2,   6,   2,   3,   2,
+      6,   2, 137,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   4, 128,  11, 239,  11,  13,   3,   5,   2,   8,   1,   2,   2,   8,   2,
+     36,   2,   1,   2,   1,   2,   1,   4,  69,   4,   1,   2,   1,   2,   1,   2,
+     51,   2,   2,   2,   8,   1,   2,   2,   8,   2, 135,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   3, 128,  11, 175,  15,
+      6,  15,   5,   4,  14,   3,   2,  11,  13,   3,   5,   2,   8,   1,   2,   2,
+      8,   2,  35,   1,   1,   3,   1,   2,   1,   2,   1,   1,  71,   1,   1,   2,
+      1,   2,   1,   3,   1,   1,  49,   3,   2,   2,   8,   1,   2,   2,   8,   2,
+    134,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1, 129,  11, 175,  16,   5,  16,   4,   4,  13,   4,   2,  11,
+     13,   3,   5,   2,   8,   1,   2,   2,   8,   2,  34,   1,   1,   3,   1,   2,
+      1,   2,   1,   1,  73,   1,   1,   2,   1,   2,   1,   3,   1,   1,  45,   5,
+      3,   2,   8,   1,   2,   2,   8,   2, 133,   3,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 130,  11, 175,   3,   9,   5,
+      4,   3,   9,   5,   3,   5,  12,   4,   2,  11,  13,   3,   6,   2,   6,   2,
+      3,   2,   6,   2,  34,   1,   1,   3,   1,   2,   1,   4,  75,   4,   1,   2,
+      1,   3,   1,   1,  44,   5,   3,   2,   8,   1,   2,   2,   8,   2, 133,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 131,  11,
+    175,   3,  11,   4,   3,   3,  11,   4,   2,   5,  12,   4,   2,  11,  13,   3,
+      6,   3,   4,   3,   3,   3,   4,   3,  34,   4,   1,   2,   1,   3,  79,   3,
+      1,   2,   1,   4,  47,   3,   2,   2,   8,   1,   2,   2,   8,   2, 132,   1,
+      1,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 132,  11,
+    175,   3,  12,   3,   3,   3,  11,   4,   2,   5,  11,   5,   2,  11,   8,  11,
+      4,   8,   5,   8,  34,   3,   1,   3,   1,   3,  81,   3,   1,   3,   1,   3,
+     47,   2,   2,   2,   8,   1,   2,   2,   8,   2, 131,   1,   1,   1,   1,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 133,  11, 175,   3,  12,   4,
+      2,   3,  12,   3,   2,   6,  10,   5,   2,  11,   8,  11,   5,   6,   7,   6,
+     34,   2,   1,   4,   1,   3,  83,   3,   1,   4,   1,   2,  46,   2,   2,   2,
+      8,   1,   2,   2,   8,   2, 130,   1,   1,   1,   1,   1,   1,   4,   1,   1,
+      1,   1,   1,   1,   1,   1, 134,  11, 175,   3,  12,   4,   2,   3,  12,   3,
+      2,   6,   9,   6,   2,  11,  76,   1,   1,   4,   1,   3,   1,   1,  83,   1,
+      1,   3,   1,   4,   1,   1,  37,   2,   6,   2,   2,   2,   8,   1,   2,   2,
+      8,   2, 129,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,
+      1,   1, 135,  11, 175,   3,  12,   3,   3,   3,  12,   3,   2,   7,   8,   6,
+      2,  11,  76,   4,   1,   4,   1,   1,  85,   1,   1,   4,   1,   4,  37,   3,
+      4,   3,   3,   2,   6,   2,   3,   2,   6,   2, 129,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   4,   1,   1,   1,   1, 136,  11, 175,   3,  11,   4,
+      3,   3,  11,   4,   2,   3,   1,   3,   8,   6,   2,  11,  75,   3,   1,   4,
+      1,   2,  87,   2,   1,   4,   1,   3,  37,   8,   4,   3,   4,   3,   3,   3,
+      4,   3, 128,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,
+      1,   1, 137,  11, 175,   3,  10,   5,   3,   3,  10,   4,   3,   3,   1,   3,
+      7,   3,   1,   3,   2,  11,  74,   2,   1,   4,   1,   3,  89,   3,   1,   4,
+      1,   2,  37,   6,   6,   8,   5,   8, 128,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   4, 138,  11, 175,  17,   4,  17,   3,   3,
+      2,   3,   6,   3,   1,   3,   2,  11,  74,   5,   1,   4,  91,   4,   1,   5,
+     50,   6,   7,   6, 128,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   3, 138,  11, 175,  16,   5,  16,   4,   3,   2,   3,
+      6,   3,   1,   3,   2,  11,  73,   3,   1,   5,   1,   1,  91,   1,   1,   5,
+      1,   3, 195,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 139,  11, 175,  14,   7,  14,   6,   3,   2,   3,
+      5,   3,   2,   3,   2,  11,  72,   1,   1,   6,   1,   2,  93,   2,   1,   6,
+      1,   1, 193,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 140,  11, 175,   3,   4,   4,  10,   3,  17,   3,
+      3,   3,   4,   3,   2,   3,   2,  11,  72,   5,   1,   4,  95,   4,   1,   5,
+    192,   3,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1, 141,  11, 175,   3,   5,   4,   9,   3,  17,   3,   3,   3,   3,   3,
+      3,   3,   2,  11,  71,   2,   1,   6,   1,   1,  95,   1,   1,   6,   1,   2,
+    191,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    142,  11, 175,   3,   6,   4,   8,   3,  17,   3,   4,   3,   2,   3,   3,   3,
+      2,  11,  71,   6,   1,   3,  97,   3,   1,   6,   6,   2, 182,   1,   1,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 143,  11, 175,   3,
+      7,   3,   8,   3,  17,   3,   4,   3,   2,   3,   3,   3,   2,  11,  64,   2,
+      4,   2,   1,   7,  99,   7,   1,   2,   3,   4, 181,   1,   1,   1,   1,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 144,  11, 175,   3,   7,   4,
+      7,   3,  17,   3,   4,   3,   1,   3,   4,   3,   2,  11,  63,   5,   2,   6,
+      1,   3,  99,   3,   1,   6,   1,   5, 181,   1,   1,   1,   1,   1,   1,   4,
+      1,   1,   1,   1,   1,   1,   1,   1, 145,  11, 175,   3,   8,   4,   6,   3,
+     17,   3,   5,   6,   4,   3,   2,  11,  63,   7,   1,   8, 101,  13, 182,   1,
+      1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1, 146,  11,
+    175,   3,   9,   4,   5,   3,  17,   3,   5,   6,   4,   3,   2,  11,  65,  10,
+      1,   3, 101,   3,   1,   7, 183,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   4,   1,   1,   1,   1, 147,  11, 175,   3,  10,   4,   4,   3,  17,   3,
+      5,   5,   5,   3,   2,  11,  67,  11, 103,   9, 183,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   4,   1,   1, 148,  11, 175,   3,  10,   4,
+      4,   3,  17,   3,   6,   4,   5,   3,   2,  11,  68,   4,   1,   5, 103,   5,
+      1,   4, 181,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   4, 149,  11, 175,   3,  11,   4,   3,   3,  17,   3,   6,   3,   6,   3,
+      2,  11,  68,   9, 105,   9, 180,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   3, 149,  11, 239,  11,  67,   1,   1,   8,
+    105,   8,   1,   1, 178,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1, 150,  11, 239,  11,  67,   7,   1,   2,
+    105,   2,   1,   7, 177,   3,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 151,  11, 239,  11,  67,   9, 107,   9, 177,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 152,  11,
+    239,  11,  67,   9, 107,   9, 176,   1,   1,   4,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 153,  11, 239,  11,  66,   6,   1,   3, 107,   3,
+      1,   6, 174,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1, 154,  11, 239,  11,  66,   9, 109,   9, 173,   1,   1,   1,   1,   1,
+      1,   4,   1,   1,   1,   1,   1,   1,   1,   1, 155,  11, 239,  11,  66,   9,
+    109,   9, 172,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,
+      1,   1, 156,  11, 239,  11,  66,   9, 109,   9, 171,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   4,   1,   1,   1,   1, 157,  11, 239,  11,  65,   8,
+      1,   1, 109,   1,   1,   8, 169,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   4,   1,   1, 158,  11, 239,  11,  65,   9, 111,   9, 168,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4, 159,  11,
+    239,  11,  65,   9, 111,   9, 167,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   3, 159,  11, 239,  11,  65,   9, 111,   9,
+    166,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1, 160,  11, 239,  11,  65,   9, 111,   9, 165,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    161,  11, 239,  11,  64,   1,   1,   8, 111,   8,   1,   1, 163,   3,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 162,  11,
+    239,  11,  64,   9, 113,   9, 163,   4,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 163,  11, 239,  11,  64,   9, 113,   9, 162,   1,
+      1,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 164, 255,
+      0,   6,  64,   9, 113,   9, 161,   1,   1,   1,   1,   4,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 165, 255,   0,   6,  64,   9, 113,   9, 160,   1,
+      1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1, 166, 248,
+      2,  11,  64,   9, 113,   9, 159,   1,   1,   1,   1,   1,   1,   1,   1,   4,
+      1,   1,   1,   1,   1,   1, 167,  11, 239,  11,  64,   9, 113,   9, 158,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1, 168,  11,
+    239,  11,  64,   9, 113,   9, 157,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   4,   1,   1, 169,  11, 239,  11,  64,   9, 113,   9, 156,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4, 170,  11,
+    239,  11,  64,   9, 113,   9, 155,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   3, 170,  11, 239,  11,  64,   9, 113,   9,
+    154,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1, 171,  11, 239,  11,  64,   9, 113,   9, 153,   3,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 172,  11,
+    239,  11,  64,   9, 113,   9, 153,   4,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 173,  11, 239,  11,  64,   9, 113,   9, 152,   1,
+      1,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 174,  11,
+     27,   6,  17,  12,  29,   5, 143,  11,  64,   9, 113,   9, 151,   1,   1,   1,
+      1,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 175,  11,  24,  12,
+     13,  16,  23,  12, 139,  11,  64,   9, 113,   9, 150,   1,   1,   1,   1,   1,
+      1,   4,   1,   1,   1,   1,   1,   1,   1,   1, 176,  11,  23,  15,  11,  18,
+     19,  15, 138,  11,  64,   1,   1,   8, 111,   8,   1,   1, 149,   1,   1,   1,
+      1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1, 177,  11,  21,  18,
+     10,  19,  17,  18, 136,  11,  65,   9, 111,   9, 149,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   4,   1,   1,   1,   1, 178,  11,  20,  20,   9,  20,
+     15,  20, 135,  11,  65,   9, 111,   9, 148,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   4,   1,   1, 179,  11,  19,   8,   6,   8,   8,   4,
+     10,   7,  13,   8,   6,   8, 134,  11,  65,   9, 111,  12, 144,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4, 180,  11,  18,   7,
+     10,   7,   7,   4,  12,   6,  11,   6,  11,   7, 133,  11,   4,  11,   5,   6,
+     38,  10, 111,  16, 139,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   3, 180,  11,  18,   5,  14,   6,   6,   4,  13,   6,
+      9,   6,  13,   6, 133,  11,   4,  11,   4,   8,  32,  14,   1,   1, 109,   1,
+      1,  15, 138,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 181,  11,  17,   5,  16,   5,   6,   4,  14,   5,
+      9,   5,  15,   6, 132,  11,   4,   2,  12,   3,   4,   3,  30,  17, 109,  16,
+    138,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1, 182,  11,  17,   5,  17,   5,   5,   4,  15,   5,   7,   5,
+     17,   5, 132,  11,   4,   2,  12,   2,   6,   2,  30,   5,   3,   9, 109,   9,
+      4,   2, 138,   3,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1, 183,  11,  16,   5,  18,   5,   5,   4,  15,   5,   7,   5,
+     18,   5, 131,  11,   4,   2,   1,   6,   4,   2,   8,   2,  37,   9, 109,   9,
+    144,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    184,  11,  16,   4,  20,   4,   5,   4,  16,   5,   6,   4,  19,   5, 131,  11,
+      4,  10,   3,   2,   8,   2,  37,   6,   1,   3, 107,   3,   1,   6, 143,   1,
+      1,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 185,  11,
+     16,   4,  20,   5,   4,   4,  16,   5,   5,   5,  20,   4, 131,  11,   4,   3,
+      5,   3,   2,   2,   8,   2,  38,   9, 107,   9,  40,   6,   4,  11,   5,   6,
+     71,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    186,  11,  15,   5,  20,   5,   4,   4,  17,   4,   5,   4,  21,   5, 130,  11,
+     13,   2,   2,   2,   8,   2,  38,   9, 107,   9,  39,   8,   3,  11,   4,   8,
+     69,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1,
+    187,  11,  15,   5,  21,   4,   4,   4,  17,   4,   5,   4,  21,   5, 130,  11,
+     13,   2,   2,   2,   8,   2,  38,   7,   1,   2, 105,   2,   1,   7,  38,   3,
+      4,   3,   2,   2,  12,   3,   4,   3,  67,   1,   1,   1,   1,   1,   1,   1,
+      1,   4,   1,   1,   1,   1,   1,   1, 188,  11,  15,   4,  22,   4,   4,   4,
+     17,   4,   5,   4,  22,   4, 130,  11,  13,   2,   2,   2,   8,   2,  38,   1,
+      1,   8, 105,   8,   1,   1,  38,   2,   6,   2,   2,   2,  12,   2,   6,   2,
+     66,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,
+    189,  11,  15,   4,  22,   4,   4,   4,  17,   4,   5,   4,  22,   4, 130,  11,
+     13,   2,   2,   2,   8,   2,  39,   9, 105,   9,  47,   2,   2,   2,   1,   6,
+      4,   2,   8,   2,  64,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   4,   1,   1, 190,  11,  15,   4,  22,   4,   4,   4,  17,   4,   5,   4,
+     22,   4, 130,  11,   4,   2,   6,   3,   2,   2,   8,   2,  39,   4,   1,   5,
+    103,   5,   1,   4,  46,   3,   2,  10,   3,   2,   8,   2,  63,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4, 191,  11,  15,   4,
+     22,   4,   4,   4,  17,   4,   5,   4,  21,   5, 130,  11,   5,   3,   3,   4,
+      3,   2,   6,   2,  41,   9, 103,   9,  44,   5,   3,   3,   5,   3,   2,   2,
+      8,   2,  62,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   3, 191,  11,  15,   5,  21,   4,   4,   4,  17,   4,   5,   4,
+     21,   5, 130,  11,   6,   8,   4,   3,   4,   3,  41,   6,   1,   3, 101,   3,
+      1,   6,  44,   5,  12,   2,   2,   2,   8,   2,  61,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 192,  11,
+     15,   5,  20,   5,   4,   4,  17,   4,   5,   4,  21,   5, 130,  11,   7,   6,
+      6,   8,  42,   1,   1,   8, 101,   8,   1,   1,  47,   3,  11,   2,   2,   2,
+      8,   2,  60,   3,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1, 193,  11,  16,   4,  20,   5,   4,   4,  16,   5,   5,   5,
+     20,   4, 131,  11,  20,   6,  44,   6,   1,   3,  99,   3,   1,   6,  49,   2,
+     11,   2,   2,   2,   8,   2,  60,   4,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 194,  11,  16,   5,  19,   4,   5,   4,  16,   5,
+      6,   4,  19,   5, 131,  11,  70,   2,   1,   7,  99,   7,   1,   2,  49,   2,
+     11,   2,   2,   2,   8,   2,  59,   1,   1,   4,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 195,  11,  16,   5,  18,   5,   5,   4,  15,   5,
+      7,   5,  18,   5, 131,  11,  71,   6,   1,   3,  97,   3,   1,   6,  42,   2,
+      6,   2,   2,   2,   6,   3,   2,   2,   8,   2,  58,   1,   1,   1,   1,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 196,  11,  17,   5,  16,   6,
+      5,   4,  15,   5,   7,   6,  16,   5, 132,  11,  71,   2,   1,   6,   1,   1,
+     95,   1,   1,   6,   1,   2,  42,   3,   4,   3,   3,   3,   3,   4,   3,   2,
+      6,   2,  58,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1,
+      1,   1, 197,  11,  17,   6,  15,   5,   6,   4,  14,   5,   9,   5,  15,   6,
+    132,  11,  72,   5,   1,   4,  95,   4,   1,   5,  44,   8,   5,   8,   4,   3,
+      4,   3,  57,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,
+      1,   1, 198,  11,  18,   6,  13,   5,   7,   4,  13,   6,   9,   6,  13,   6,
+    133,  11,  72,   1,   1,   6,   1,   2,  93,   2,   1,   6,   1,   1,  45,   6,
+      7,   6,   6,   8,  57,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,
+      1,   1,   1,   1, 199,  11,  18,   7,  10,   7,   7,   4,  11,   7,  11,   7,
+     10,   6, 134,  11,  73,   3,   1,   5,   1,   1,  91,   1,   1,   5,   1,   3,
+     72,   6,  57,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,
+      1,   1, 200,  11,  19,   9,   4,   9,   8,   4,   9,   8,  13,   8,   5,   9,
+    134,  11,  74,   5,   1,   4,  91,   4,   1,   5, 135,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   4, 201,  11,  20,  20,   9,  20,
+     15,  20, 135,  11,  74,   2,   1,   4,   1,   3,  89,   3,   1,   4,   1,   2,
+    134,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   3, 201,  11,  21,  18,  10,  19,  17,  17, 137,  11,  75,   3,   1,   4,
+      1,   2,  87,   2,   1,   4,   1,   3, 134,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 202,  11,  23,  14,
+     12,  18,  19,  15, 138,  11,  76,   4,   1,   4,   1,   1,  85,   1,   1,   4,
+      1,   4, 134,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 203,  11,  25,  10,  14,  16,  24,  10, 140,  11,
+     76,   1,   1,   4,   1,   3,   1,   1,  83,   1,   1,   3,   1,   4,   1,   1,
+    133,   3,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1, 204,  11,  29,   2,  20,  10,  32,   2, 144,  11,  77,   2,   1,   4,
+      1,   3,  83,   3,   1,   4,   1,   2, 134,   4,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1, 205,  11, 239,  11,  78,   3,   1,   3,
+      1,   3,  81,   3,   1,   3,   1,   3, 134,   1,   1,   4,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1, 206,  11, 239,  11,  79,   4,   1,   2,
+      1,   3,  79,   3,   1,   2,   1,   4, 134,   1,   1,   1,   1,   4,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1, 207,  11, 239,  11,  79,   1,   1,   3,
+      1,   2,   1,   4,  75,   4,   1,   2,   1,   3,   1,   1, 133,   1,   1,   1,
+      1,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1, 208,  11, 239,  11,
+     80,   1,   1,   3,   1,   2,   1,   2,   1,   1,  73,   1,   1,   2,   1,   2,
+      1,   3,   1,   1, 133,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,
+      1,   1,   1,   1, 209,  11, 239,  11,  81,   1,   1,   3,   1,   2,   1,   2,
+      1,   1,  71,   1,   1,   2,   1,   2,   1,   3,   1,   1, 133,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1, 210,  11, 239,  11,
+     82,   5,   1,   2,   1,   4,  69,   4,   1,   2,   1,   5, 133,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1, 211,  11, 239,  11,
+     83,   5,   1,   4,   1,   3,  65,   3,   1,   4,   1,   8, 130,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4, 212,  11, 239,  11,
+     82,   3,   1,   5,   1,   4,   1,   1,  63,   1,   1,   4,   1,   5,   1,   4,
+      1,   1, 128,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   3, 212,  11, 239,  11,  80,   3,   2,   1,   1,   2,   1,   4,
+      1,   5,  59,   5,   1,   4,   1,   2,   1,   1,   2,   1,   1,   1,   1,   1,
+    126,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1, 213,  11, 239,  11,  79,   3,   4,   1,   1,   4,   1,   4,
+      1,   1,   1,   1,  57,   1,   1,   1,   1,   4,   1,   4,   1,   1,   4,   1,
+      1,   1,   1,   1, 124,   3,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 214,  11, 239,  11,  78,   3,   6,   3,   1,   4,
+      1,   7,  53,   7,   1,   4,   1,   3,   6,   1,   1,   1, 125,   4,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 215,  11, 239,  11,
+     77,   3,   9,   4,   1,  11,  49,  11,   1,   4,   9,   1, 125,   1,   1,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 216,  11, 239,  11,
+     78,   1,  11,   1,   1,   6,   1,   1,   1,   6,  45,   6,   1,   1,   1,   6,
+      1,   1, 135,   1,   1,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1, 217,  11, 239,  11,  91,   3,   1,   1,   1,   5,   1,   7,  39,   7,
+      1,   5,   1,   1,   1,   3, 135,   1,   1,   1,   1,   1,   1,   4,   1,   1,
+      1,   1,   1,   1,   1,   1, 218,  11, 239,  11,  93,  11,   1,   8,  33,   8,
+      1,  11, 136,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,
+      1,   1, 219,  11, 239,  11,  94,  15,   1,   7,  25,   7,   1,  15, 136,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1, 220,  11,
+    239,  11,  96,   1,   1,   1,   1,  16,   1,   5,  15,   5,   1,  16,   1,   1,
+      1,   1, 137,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,
+      1,   1, 221,  11, 239,  11,  97,   4,   1,   4,   1,   5,   1,  33,   1,   5,
+      1,   4,   1,   4, 137,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   4, 222,  11, 239,  11,  99,  61, 138,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   3, 222,  11, 239,  11,
+    101,   2,   1,  51,   1,   2, 139,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 223,  11, 239,  11, 103,  53,
+    140,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1, 224,  11, 239,  11, 106,   2,   1,  41,   1,   2, 142,   3,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    225,  11, 239,  11, 108,  43, 144,   4,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 226,  11, 239,  11, 112,  35, 147,   1,   1,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 227,  11, 239,  11,
+    116,   5,   1,  15,   1,   5, 150,   1,   1,   1,   1,   4,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 228,  11, 239,  11, 121,  17, 154,   1,   1,   1,
+      1,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1, 229,  11, 239,  11,
+    255,   0,  36,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,
+      1,   1, 230,  11, 239,  11, 255,   0,  35,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   4,   1,   1,   1,   1, 231,  11, 239,  11, 255,   0,  34,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1, 232,  11,
+    239,  11, 255,   0,  33,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   4, 233,  11, 239,  11, 255,   0,  32,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   3, 233,  11, 239,  11,
+     41,   6, 239,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 234,  11, 239,  11,  40,   8, 237,   3,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 235,  11,
+    239,  11,  39,   3,   4,   3, 236,   4,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 236,  11, 239,  11,  39,   2,   6,   2, 235,   1,
+      1,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 237,  11,
+    239,  11,  38,   2,   8,   2, 233,   1,   1,   1,   1,   4,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1, 238,  11, 180,   2,  57,  11,  38,   2,   8,   2,
+    160,   3,   5,   6,   7,   6,  45,   1,   1,   1,   1,   1,   1,   4,   1,   1,
+      1,   1,   1,   1,   1,   1, 239,  11, 179,   4,  56,  11,  38,   2,   8,   2,
+    159,   4,   4,   8,   5,   8,  43,   1,   1,   1,   1,   1,   1,   1,   1,   4,
+      1,   1,   1,   1,   1,   1, 240,  11, 179,   4,  56,  11,  38,   2,   8,   2,
+    158,   5,   3,   3,   4,   3,   3,   3,   4,   3,  41,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   4,   1,   1,   1,   1, 241,  11, 179,   4,  56,  11,
+     38,   2,   8,   2, 157,   2,   1,   3,   3,   2,   6,   2,   3,   2,   6,   2,
+     40,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   4,   1,   1,
+    242,  11, 179,   4,  56,  11,  38,   2,   8,   2, 156,   2,   2,   3,   2,   2,
+      8,   1,   2,   2,   8,   2,  38,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   4, 243,  11, 179,   4,   7,   3,   8,   7,   6,   7,
+     18,  11,  38,   2,   8,   2, 155,   2,   3,   3,   2,   2,   8,   1,   2,   2,
+      8,   2,  37,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   3, 243,  11, 179,   4,   6,   4,   6,  10,   4,  10,  16,  11,
+     38,   2,   8,   2, 154,   2,   4,   3,   2,   2,   8,   1,   2,   2,   8,   2,
+     36,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1, 244,  11, 179,   4,   4,   6,   5,  12,   2,  12,  15,  11,
+     39,   2,   6,   2, 154,   2,   5,   3,   2,   2,   8,   1,   2,   2,   8,   2,
+     35,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1, 245,  11, 179,   4,   3,   6,   5,   6,   3,  11,   2,   6,
+     14,  11,  39,   3,   4,   3, 153,   2,   6,   3,   2,   2,   8,   1,   2,   2,
+      8,   2,  34,   3,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   1,   1,   1, 246,  11, 179,   4,   2,   5,   7,   4,   7,   7,   6,   5,
+     13,  11,  40,   8, 154,  11,   2,   2,   8,   1,   2,   2,   8,   2,  34,   4,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 247,  11,
+    179,   4,   1,   5,   7,   4,   9,   5,   8,   4,  13,  11,  41,   6, 155,  11,
+      2,   2,   8,   1,   2,   2,   8,   2,  33,   1,   1,   4,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   1, 248,  11, 179,   9,   8,   4,   9,   4,
+     10,   3,  13,  11, 210,   3,   2,   2,   8,   1,   2,   2,   8,   2,  32,   1,
+      1,   1,   1,   4,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 249,  11,
+    179,   8,   9,   3,  10,   4,  10,   3,  13,  11, 210,   3,   3,   2,   6,   2,
+      3,   2,   6,   2,  32,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1,
+      1,   1,   1,   1, 250,  11, 179,   7,  10,   3,  10,   4,  10,   3,  13,  11,
+    210,   3,   3,   3,   4,   3,   3,   3,   4,   3,  31,   1,   1,   1,   1,   1,
+      1,   1,   1,   4,   1,   1,   1,   1,   1,   1, 251,  11, 179,   8,   9,   3,
+     10,   4,  10,   3,  13,  11, 210,   3,   4,   8,   5,   8,  31,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   4,   1,   1,   1,   1, 252,  11, 179,   9,
+      8,   3,  10,   4,  10,   3,  13,  11, 218,   6,   7,   6,  33,   1,   1,   1,
+      1,   1,   1,   1,   1,   1,   1,   4,   1,   1, 253,  11, 179,   4,   1,   5,
+      7,   3,  10,   4,  10,   3,  13,  11, 255,   0,  16,   1,   1,   1,   1,   1,
+      1,   1,   1,   1,   1,   4, 254,  11, 179,   4,   2,   6,   5,   3,  10,   4,
+     10,   3,  13,  11, 255,   0,  17,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+      1,   3, 254,  11, 179,   4,   3,   6,   4,   3,  10,   4,  10,   3,  13,  11,
+    255,   0,  18,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1, 255,  11,
+    179,   4,   4,   6,   3,   3,  10,   4,  10,   3,  13,  11, 255,   0,  19,   1,
+      1,   1,   1,   1,   1,   1,   1,   1, 255,   0,   1,  11, 179,   4,   6,   4,
+      3,   3,  10,   4,  10,   3,  13,  11, 255,   0,  20,   1,   1,   1,   1,   1,
+      1,   1, 255,   0,   2,  11, 180,   2,   8,   2,   4,   3,  11,   2,  11,   3,
+     13,  11, 255,   0,  21,   1,   1,   1,   1,   1, 255,   0,   3,  11, 239,  11,
+    255,   0,  22,   1,   1,   1, 255,   0,   4,  11, 239,  11, 255,   0,  23,   1,
+    255,   0,   5,  11, 239,  11, 255,   0, 255,   0,  29,  11, 239,  11, 255,   0,
+    255,   0,  29,  11, 239,  11, 255,   0, 255,   0,  29,  11, 239,  11, 255,   0,
+    255,   0,  29,  11, 239,  11, 255,   0, 255,   0,  29,  11, 239,  11, 255,   0,
+    255,   0,  29,  11, 239,  11, 255,   0, 255,   0,  29,  11, 239,  11, 255,   0,
+    255,   0,  29,  11, 239,  11, 255,   0, 255,   0,  29,  11, 239,  11, 255,   0,
+    255,   0,  29,  11, 239,  11, 246,   2, 255,   0,  36,  11, 239,  11, 246,   3,
+    255,   0,  35,  11, 239,  11, 245,   3, 255,   0,  36,  11, 239,  11, 200,   1,
+     44,   3,   3,   1, 255,   0,  32,  11, 239,  11, 199,   3,  42,   3,   3,   3,
+    255,   0,  31,  11, 239,  11, 199,   3,  42,   3,   3,   3, 255,   0,  31,  11,
+    239,  11, 199,   3,  42,   2,   4,   3, 255,   0,  31,  11, 239,  11, 199,   3,
+     41,   3,   4,   3, 255,   0,  31,   2, 248,   2, 208,   3,   5,   2,   6,   6,
+      4,   6,  12,   2,   5,  10, 255,   0, 255,   0, 229,   3,   4,   3,   5,   8,
+      2,   8,  10,   3,   5,  11, 255,   0, 255,   0, 228,   3,   3,   4,   4,  20,
+      9,   3,   5,  11, 255,   0, 255,   0, 228,   3,   2,   4,   4,   4,   4,   6,
+      4,   3,   8,   3,   6,   4,   5,   3, 255,   0, 255,   0, 227,   8,   5,   3,
+      6,   4,   6,   3,   7,   3,   6,   3,   6,   3, 255,   0, 255,   0, 227,   6,
+      7,   2,   7,   3,   7,   3,   6,   3,   7,   3,   7,   2, 255,   0, 255,   0,
+    227,   6,   7,   2,   7,   3,   7,   3,   6,   3,   7,   3,   7,   3, 255,   0,
+    255,   0, 226,   5,   8,   2,   7,   3,   7,   3,   5,   3,   8,   3,   7,   3,
+    255,   0, 255,   0, 226,   6,   7,   2,   7,   3,   7,   3,   5,   3,   8,   3,
+      7,   3, 255,   0, 255,   0, 226,   7,   6,   2,   7,   3,   7,   3,   4,   3,
+      9,   3,   7,   3, 255,   0, 255,   0, 226,   3,   1,   4,   5,   2,   7,   3,
+      7,   3,   4,   3,   9,   3,   7,   3, 255,   0, 255,   0, 226,   3,   2,   4,
+      4,   2,   7,   3,   7,   3,   3,   3,  10,   3,   7,   3, 255,   0, 255,   0,
+    226,   3,   3,   4,   3,   2,   7,   3,   7,   3,   3,   3,  10,   3,   7,   3,
+    255,   0, 255,   0, 226,   3,   4,   3,   3,   2,   7,   3,   8,   2,   2,   3,
+     11,   3,   7,   3, 255,   0, 255,   0, 227,   1,   7,   1,   3,   1,   9,   1,
+      9,   1,   3,   3,  12,   1,   9,   1, 255,   0, 255,   0, 255,   0,  10,   1,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0, 255,   0,
+    255,   0, 255,   0, 161,
+};
+
+const RleImage imgDashboard = { 800, 480, 10485, imgDashboard_spans };
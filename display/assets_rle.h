@@ -0,0 +1,65 @@
+/* Generated by tools/img2rle.py from display/assets/manifest.txt - do not edit.
+ * 1bpp equivalent: 55576 bytes, span encoding: 15934 bytes */
+
+#ifndef ASSETS_RLE_H
+#define ASSETS_RLE_H
+
+#include "display.h"
+
+#define FONT_DIGITS16X24_W 16
+#define FONT_DIGITS16X24_H 24
+extern const RleImage fontDigits16x24[10];
+
+#define FONT_DIGITS32X50_W 32
+#define FONT_DIGITS32X50_H 50
+extern const RleImage fontDigits32x50[10];
+
+#define IMG_GEAR_LETTER_D_W 48
+#define IMG_GEAR_LETTER_D_H 60
+extern const RleImage imgGearLetterD;
+
+#define IMG_GEAR_LETTER_R_W 48
+#define IMG_GEAR_LETTER_R_H 60
+extern const RleImage imgGearLetterR;
+
+#define IMG_KMH_W 64
+#define IMG_KMH_H 24
+extern const RleImage imgKmh;
+
+#define IMG_ODO_W 96
+#define IMG_ODO_H 36
+extern const RleImage imgOdo;
+
+#define IMG_KM_W 48
+#define IMG_KM_H 24
+extern const RleImage imgKm;
+
+#define IMG_ENG_SPD_W 176
+#define IMG_ENG_SPD_H 36
+extern const RleImage imgEngSpd;
+
+#define IMG_RPM_W 64
+#define IMG_RPM_H 24
+extern const RleImage imgRpm;
+
+#define IMG_WATER_TEMP_W 64
+#define IMG_WATER_TEMP_H 64
+extern const RleImage imgWaterTemp;
+
+#define IMG_ABS_W 80
+#define IMG_ABS_H 64
+extern const RleImage imgAbs;
+
+#define IMG_BATTERY_W 96
+#define IMG_BATTERY_H 64
+extern const RleImage imgBattery;
+
+#define IMG_ENGINE_CHECK_W 88
+#define IMG_ENGINE_CHECK_H 64
+extern const RleImage imgEngineCheck;
+
+#define IMG_DASHBOARD_W 800
+#define IMG_DASHBOARD_H 480
+extern const RleImage imgDashboard;
+
+#endif  // ASSETS_RLE_H
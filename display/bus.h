@@ -0,0 +1,79 @@
+/**
+ * bus.h - Display bus backend interface
+ *
+ * Everything display.c and its helpers send to the SSD1963 goes through
+ * the backend selected here: commands, short data sequences, repeated
+ * pixel patterns and transaction brackets around each primitive. The
+ * backends are
+ *
+ *   busGpio     bit-banged Port M data / Port L strobes (default)
+ *   busDma      busGpio plus the Timer3 + µDMA engine for long fills
+ *   busRecord   records the traffic (host benchmarks, bus traces)
+ *
+ * so the same draw workload can be replayed against each of them.
+ */
+
+#ifndef BUS_H
+#define BUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "display.h"
+
+/* Bytes per bus transfer in fill patterns: one on the 8-bit bus, two
+ * (D15-D8 then D7-D0) with the 16-bit 565 pixel format */
+#if DISPLAY_PIXEL_FORMAT == PIXEL_FORMAT_565
+#define BUS_TRANSFER_BYTES  2
+#else
+#define BUS_TRANSFER_BYTES  1
+#endif
+
+typedef struct {
+    /* Command byte (D/C low) */
+    void (*writeCommand)(uint8_t command);
+    /* len data bytes (D/C high); the buffer may be reused on return */
+    void (*writeData)(const uint8_t *data, uint32_t len);
+    /* Read len parameter bytes of the last command (RD strobe) */
+    void (*readData)(uint8_t *data, uint32_t len);
+    /* pattern[0..patternLen-1] sent `repeats` times. A pattern of exactly
+     * one transfer (BUS_TRANSFER_BYTES) leaves the data lines constant. */
+    void (*fill)(const uint8_t *pattern, uint8_t patternLen, uint32_t repeats);
+    /* Bracket one primitive; begin() returns once the bus is free */
+    void (*begin)(void);
+    void (*end)(void);
+    /* True while an asynchronous transfer still owns the bus */
+    bool (*busy)(void);
+} DisplayBus;
+
+extern const DisplayBus busGpio;
+extern const DisplayBus busDma;
+
+/* Active backend, busGpio until Bus_Select() */
+extern const DisplayBus *displayBus;
+
+/**
+ * Switch backend. Waits until the current one is idle.
+ */
+void Bus_Select(const DisplayBus *bus);
+
+static inline void Bus_Begin(void)
+{
+    displayBus->begin();
+}
+
+static inline void Bus_End(void)
+{
+    displayBus->end();
+}
+
+static inline bool Bus_Busy(void)
+{
+    return displayBus->busy();
+}
+
+static inline void Bus_Fill(const uint8_t *pattern, uint8_t patternLen, uint32_t repeats)
+{
+    displayBus->fill(pattern, patternLen, repeats);
+}
+
+#endif /* BUS_H */
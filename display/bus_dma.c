@@ -0,0 +1,75 @@
+/**
+ * bus_dma.c - Display bus backend using the Timer3 + µDMA engine
+ *
+ * Long pattern fills are handed to busdma.c and return while they
+ * stream; everything else is bit-banged through busGpio once the engine
+ * is idle. Data buffers are never handed to DMA because callers may
+ * reuse them on return.
+ */
+
+#include "bus.h"
+#include "busdma.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#if DISPLAY_BUS_DMA && DISPLAY_PIXEL_FORMAT != PIXEL_FORMAT_888
+#error "The DMA bus engine streams 8-bit data only"
+#endif
+
+static void dmaWriteCommand(uint8_t command)
+{
+    BusDma_Wait();
+    busGpio.writeCommand(command);
+}
+
+static void dmaWriteData(const uint8_t *data, uint32_t len)
+{
+    BusDma_Wait();
+    busGpio.writeData(data, len);
+}
+
+static void dmaReadData(uint8_t *data, uint32_t len)
+{
+    BusDma_Wait();
+    busGpio.readData(data, len);
+}
+
+static void dmaFill(const uint8_t *pattern, uint8_t patternLen, uint32_t repeats)
+{
+    if (patternLen == 3 && repeats >= BUSDMA_MIN_PIXELS) {
+        BusDma_Fill(pattern[0], pattern[1], pattern[2], repeats);
+        return;
+    }
+    // Single-byte pattern of a whole number of pixels (grey levels)
+    if (patternLen == 1 && repeats % 3 == 0 && repeats / 3 >= BUSDMA_MIN_PIXELS) {
+        BusDma_Fill(pattern[0], pattern[0], pattern[0], repeats / 3);
+        return;
+    }
+    BusDma_Wait();
+    busGpio.fill(pattern, patternLen, repeats);
+}
+
+static void dmaBegin(void)
+{
+    BusDma_Wait();
+}
+
+static void dmaEnd(void)
+{
+    // A fill may still be streaming; the next access waits for it
+}
+
+static bool dmaBusy(void)
+{
+    return busDmaBusy;
+}
+
+const DisplayBus busDma = {
+    dmaWriteCommand,
+    dmaWriteData,
+    dmaReadData,
+    dmaFill,
+    dmaBegin,
+    dmaEnd,
+    dmaBusy
+};
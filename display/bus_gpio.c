@@ -0,0 +1,125 @@
+/**
+ * bus_gpio.c - Bit-banged display bus backend
+ *
+ * Port M carries the data byte, Port L the control lines:
+ * 0x11 = command strobe, 0x15 = data strobe, 0x1F = idle.
+ * The SSD1963 latches on the rising WR edge back to 0x1F. With the 16-bit
+ * 565 pixel format Port K carries D15-D8 of pixel transfers; commands
+ * and parameters only use D7-D0.
+ *
+ * Port L bit order (PL0..PL4): RD, WR, D/C, CS, RST - all strobes active
+ * low except RST. A read (0x16) drops CS and RD with D/C high while
+ * Port M is switched to input.
+ */
+
+#include "bus.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_types.h"
+#include "inc/tm4c1294ncpdt.h"
+
+const DisplayBus *displayBus = &busGpio;
+
+static inline void strobeData(uint8_t data)
+{
+    GPIO_PORTM_DATA_R = data;
+    GPIO_PORTL_DATA_R = 0x15;
+    GPIO_PORTL_DATA_R = 0x1F;
+}
+
+static void gpioWriteCommand(uint8_t command)
+{
+    GPIO_PORTM_DATA_R = command;
+    GPIO_PORTL_DATA_R = 0x11;
+    GPIO_PORTL_DATA_R = 0x1F;
+}
+
+static void gpioWriteData(const uint8_t *data, uint32_t len)
+{
+    while (len--)
+        strobeData(*data++);
+}
+
+static void gpioReadData(uint8_t *data, uint32_t len)
+{
+    GPIO_PORTM_DIR_R = 0x00;
+    while (len--) {
+        GPIO_PORTL_DATA_R = 0x16;
+        // tACC of the SSD1963 is longer than one store: read L back twice
+        (void)GPIO_PORTL_DATA_R;
+        (void)GPIO_PORTL_DATA_R;
+        *data++ = GPIO_PORTM_DATA_R;
+        GPIO_PORTL_DATA_R = 0x1F;
+    }
+    GPIO_PORTM_DIR_R = 0xFF;
+}
+
+static void gpioFill(const uint8_t *pattern, uint8_t patternLen, uint32_t repeats)
+{
+    uint8_t i;
+
+    if (patternLen == BUS_TRANSFER_BYTES) {
+        // Same value on every transfer: set the data lines once and only
+        // strobe, two stores per transfer instead of three
+#if BUS_TRANSFER_BYTES == 2
+        GPIO_PORTK_DATA_R = pattern[0];
+        GPIO_PORTM_DATA_R = pattern[1];
+#else
+        GPIO_PORTM_DATA_R = pattern[0];
+#endif
+        while (repeats--) {
+            GPIO_PORTL_DATA_R = 0x15;
+            GPIO_PORTL_DATA_R = 0x1F;
+        }
+        return;
+    }
+
+#if BUS_TRANSFER_BYTES == 2
+    while (repeats--) {
+        for (i = 0; i < patternLen; i += 2) {
+            GPIO_PORTK_DATA_R = pattern[i];
+            strobeData(pattern[i + 1]);
+        }
+    }
+#else
+    if (patternLen == 3) {
+        // The common case: one 24-bit pixel, kept in registers
+        uint8_t r = pattern[0], g = pattern[1], b = pattern[2];
+        while (repeats--) {
+            strobeData(r);
+            strobeData(g);
+            strobeData(b);
+        }
+        return;
+    }
+
+    while (repeats--)
+        for (i = 0; i < patternLen; i++)
+            strobeData(pattern[i]);
+#endif
+}
+
+static void gpioNop(void)
+{
+}
+
+static bool gpioBusy(void)
+{
+    return false;
+}
+
+const DisplayBus busGpio = {
+    gpioWriteCommand,
+    gpioWriteData,
+    gpioReadData,
+    gpioFill,
+    gpioNop,
+    gpioNop,
+    gpioBusy
+};
+
+void Bus_Select(const DisplayBus *bus)
+{
+    while (displayBus->busy()) {}
+    displayBus = bus;
+}
@@ -0,0 +1,134 @@
+/**
+ * bus_record.c - Recording display bus backend
+ */
+
+#include "bus_record.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+static BusEvent *events;
+static uint32_t eventCapacity;
+static uint32_t eventCount;
+static const DisplayBus *forwardBus;
+static BusRecordStats stats;
+static bool inTransaction;
+static BusReadHook readHook;
+static uint8_t lastCommand;
+
+static void record(uint8_t type, const uint8_t *bytes, uint8_t len, uint32_t repeats)
+{
+    BusEvent *ev;
+
+    if (!events) return;
+    if (eventCount >= eventCapacity) {
+        stats.dropped++;
+        return;
+    }
+    ev = &events[eventCount++];
+    ev->type = type;
+    ev->len = len;
+    if (len)
+        memcpy(ev->bytes, bytes, len);
+    ev->repeats = repeats;
+}
+
+static void recWriteCommand(uint8_t command)
+{
+    stats.commands++;
+    lastCommand = command;
+    record(BUS_EV_COMMAND, &command, 1, 1);
+    if (forwardBus) forwardBus->writeCommand(command);
+}
+
+static void recWriteData(const uint8_t *data, uint32_t len)
+{
+    uint32_t i;
+
+    stats.dataBytes += len;
+    // Split into events of up to three bytes
+    for (i = 0; i < len; i += 3)
+        record(BUS_EV_DATA, data + i, (len - i < 3) ? (uint8_t)(len - i) : 3, 1);
+    if (forwardBus) forwardBus->writeData(data, len);
+}
+
+static void recReadData(uint8_t *data, uint32_t len)
+{
+    uint32_t i;
+
+    if (forwardBus)
+        forwardBus->readData(data, len);
+    else if (readHook)
+        readHook(lastCommand, data, len);
+    else
+        memset(data, 0, len);
+
+    stats.readBytes += len;
+    for (i = 0; i < len; i += 3)
+        record(BUS_EV_READ, data + i, (len - i < 3) ? (uint8_t)(len - i) : 3, 1);
+}
+
+static void recFill(const uint8_t *pattern, uint8_t patternLen, uint32_t repeats)
+{
+    stats.fills++;
+    stats.fillBytes += patternLen * repeats;
+    record(BUS_EV_FILL, pattern, patternLen > 3 ? 3 : patternLen, repeats);
+    if (forwardBus) forwardBus->fill(pattern, patternLen, repeats);
+}
+
+static void recBegin(void)
+{
+    if (inTransaction) stats.unbalanced++;
+    inTransaction = true;
+    stats.transactions++;
+    record(BUS_EV_BEGIN, NULL, 0, 0);
+    if (forwardBus) forwardBus->begin();
+}
+
+static void recEnd(void)
+{
+    if (!inTransaction) stats.unbalanced++;
+    inTransaction = false;
+    record(BUS_EV_END, NULL, 0, 0);
+    if (forwardBus) forwardBus->end();
+}
+
+static bool recBusy(void)
+{
+    return forwardBus ? forwardBus->busy() : false;
+}
+
+const DisplayBus busRecord = {
+    recWriteCommand,
+    recWriteData,
+    recReadData,
+    recFill,
+    recBegin,
+    recEnd,
+    recBusy
+};
+
+void BusRecord_Start(BusEvent *buffer, uint32_t capacity, const DisplayBus *forward)
+{
+    events = buffer;
+    eventCapacity = buffer ? capacity : 0;
+    eventCount = 0;
+    forwardBus = forward;
+    inTransaction = false;
+    memset(&stats, 0, sizeof(stats));
+}
+
+void BusRecord_SetReadHook(BusReadHook hook)
+{
+    readHook = hook;
+}
+
+uint32_t BusRecord_Count(void)
+{
+    return eventCount;
+}
+
+const BusRecordStats *BusRecord_Stats(void)
+{
+    return &stats;
+}
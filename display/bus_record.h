@@ -0,0 +1,69 @@
+/**
+ * bus_record.h - Recording display bus backend
+ *
+ * Logs every bus operation into a caller-supplied event buffer and keeps
+ * running totals. Optionally forwards each operation to another backend,
+ * so a trace can be taken on the target without changing the picture.
+ * On the host (no forward backend) it is the reference bus for comparing
+ * draw workloads.
+ */
+
+#ifndef BUS_RECORD_H
+#define BUS_RECORD_H
+
+#include <stdint.h>
+#include "bus.h"
+
+typedef enum {
+    BUS_EV_BEGIN,
+    BUS_EV_END,
+    BUS_EV_COMMAND,     // bytes[0]
+    BUS_EV_DATA,        // bytes[0..len-1]
+    BUS_EV_READ,        // bytes[0..len-1] as returned
+    BUS_EV_FILL         // bytes[0..len-1] sent `repeats` times
+} BusEventType;
+
+typedef struct {
+    uint8_t type;
+    uint8_t len;
+    uint8_t bytes[3];
+    uint32_t repeats;
+} BusEvent;
+
+typedef struct {
+    uint32_t transactions;
+    uint32_t commands;
+    uint32_t dataBytes;         // writeData bytes
+    uint32_t readBytes;
+    uint32_t fills;
+    uint32_t fillBytes;         // patternLen * repeats, summed
+    uint32_t unbalanced;        // end() without begin(), or nested begin()
+    uint32_t dropped;           // events that did not fit in the buffer
+} BusRecordStats;
+
+extern const DisplayBus busRecord;
+
+/**
+ * Clear the totals and start logging into buffer[0..capacity-1]
+ * (buffer may be NULL to keep totals only). forward may be NULL.
+ */
+void BusRecord_Start(BusEvent *buffer, uint32_t capacity, const DisplayBus *forward);
+
+/**
+ * Without a forward backend, reads are answered by hook (command is the
+ * last command written); with neither, reads return zeros
+ */
+typedef void (*BusReadHook)(uint8_t command, uint8_t *data, uint32_t len);
+void BusRecord_SetReadHook(BusReadHook hook);
+
+/**
+ * Number of events stored so far
+ */
+uint32_t BusRecord_Count(void);
+
+/**
+ * Running totals
+ */
+const BusRecordStats *BusRecord_Stats(void);
+
+#endif /* BUS_RECORD_H */
@@ -0,0 +1,115 @@
+/**
+ * busdma.c - DMA + timer driven parallel bus engine (portable part)
+ *
+ * Splits a transfer into chunks and keeps both ping-pong descriptors
+ * loaded. BusDma_ChunkDone() runs in the completion interrupt and
+ * re-arms the descriptor that just finished while the other one is
+ * being streamed.
+ */
+
+#include "busdma.h"
+#include "busdma_port.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+volatile bool busDmaBusy = false;
+
+static bool initialised = false;
+
+/* Current transfer */
+static const uint8_t *src;
+static uint32_t remaining;              // bytes not yet handed to a descriptor
+static bool srcIsPattern;               // fill: every chunk restarts at fillPattern
+static uint8_t inFlight;                // armed descriptors not yet completed
+static uint8_t doneHalf;                // descriptor that completes next
+
+/* One chunk of the fill colour; chunks are a multiple of 3 bytes so
+ * every chunk starts on a pixel boundary */
+static uint8_t fillPattern[BUSDMA_CHUNK_BYTES];
+static uint32_t patternColor = 0xFFFFFFFF;
+
+static bool armNext(uint8_t half)
+{
+    uint16_t n;
+
+    if (remaining == 0) return false;
+
+    n = (remaining > BUSDMA_CHUNK_BYTES) ? BUSDMA_CHUNK_BYTES : (uint16_t)remaining;
+    BusDmaPort_Arm(half, src, n);
+    if (!srcIsPattern)
+        src += n;
+    remaining -= n;
+    inFlight++;
+    return true;
+}
+
+static void startTransfer(void)
+{
+    busDmaBusy = true;
+    inFlight = 0;
+    doneHalf = 0;
+    armNext(0);
+    armNext(1);
+    BusDmaPort_Start();
+}
+
+void BusDma_Init(uint32_t sysClock)
+{
+    BusDmaPort_Init(sysClock);
+    initialised = true;
+}
+
+void BusDma_Fill(uint8_t r, uint8_t g, uint8_t b, uint32_t pixels)
+{
+    uint32_t color = ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    uint16_t i;
+
+    if (pixels == 0) return;
+    BusDma_Wait();
+
+    // Only rebuild the pattern when the colour changes
+    if (color != patternColor) {
+        for (i = 0; i < BUSDMA_CHUNK_BYTES; i += 3) {
+            fillPattern[i] = r;
+            fillPattern[i + 1] = g;
+            fillPattern[i + 2] = b;
+        }
+        patternColor = color;
+    }
+
+    src = fillPattern;
+    srcIsPattern = true;
+    remaining = pixels * 3;
+    startTransfer();
+}
+
+void BusDma_Write(const uint8_t *data, uint32_t len)
+{
+    if (len == 0) return;
+    BusDma_Wait();
+
+    src = data;
+    srcIsPattern = false;
+    remaining = len;
+    startTransfer();
+}
+
+void BusDma_Wait(void)
+{
+    while (busDmaBusy) {}
+}
+
+void BusDma_ChunkDone(void)
+{
+    if (!initialised || inFlight == 0) return;
+    inFlight--;
+
+    // The other descriptor is streaming now; refill this one behind it
+    armNext(doneHalf);
+    doneHalf ^= 1;
+
+    if (inFlight == 0) {
+        BusDmaPort_Stop();
+        busDmaBusy = false;
+    }
+}
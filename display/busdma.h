@@ -0,0 +1,73 @@
+/**
+ * busdma.h - DMA + timer driven parallel bus engine for the SSD1963
+ *
+ * Streams data bytes to the display without the CPU: Timer3 in split
+ * mode paces two µDMA channels. Timer3B fires every BUSDMA_STROBE_CYCLES
+ * and its channel writes the control port (0x15 = WR low, 0x1F = WR high,
+ * latching the byte). Timer3A fires at half that rate, together with
+ * every WR-high timeout, and its channel wins on priority: the byte
+ * lands on Port M while WR is already low, one DMA transfer (a few bus
+ * cycles) before WR rises and the SSD1963 samples it. That gap is the
+ * whole data setup time; the previous byte stays on the port while WR
+ * is low.
+ *
+ *   t:      T     2T    3T    4T    5T   ...
+ *   Port M        d0          d1
+ *   Port L  0x15  0x1F  0x15  0x1F  0x15
+ *
+ * Transfers are cut into BUSDMA_CHUNK_BYTES chunks and run ping-pong, so
+ * the CPU only takes one interrupt per chunk. Commands and window setup
+ * stay on the bit-banged path; the busDma backend (bus_dma.c) waits for a
+ * running transfer before touching the bus.
+ *
+ * The chunking and re-arm logic (busdma.c) only talks to the hardware
+ * through busdma_port.h, so it runs unchanged against the host model in
+ * tools/busdma_model.c.
+ */
+
+#ifndef BUSDMA_H
+#define BUSDMA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Set to 1 to switch the display to the busDma backend (bus_dma.c) */
+#ifndef DISPLAY_BUS_DMA
+#define DISPLAY_BUS_DMA         0
+#endif
+
+#define BUSDMA_STROBE_CYCLES    12      /* CPU cycles per WR edge (2 per byte) */
+#define BUSDMA_CHUNK_BYTES      510     /* per descriptor, multiple of 3, 2x <= 1024 */
+#define BUSDMA_MIN_PIXELS       64      /* shorter runs are cheaper bit-banged */
+
+/* True while a transfer owns the bus */
+extern volatile bool busDmaBusy;
+
+/**
+ * Configure timer, µDMA channels and the completion interrupt
+ */
+void BusDma_Init(uint32_t sysClock);
+
+/**
+ * Stream `pixels` copies of the 3-byte colour r, g, b
+ */
+void BusDma_Fill(uint8_t r, uint8_t g, uint8_t b, uint32_t pixels);
+
+/**
+ * Stream `len` bytes from `data`. The buffer must stay valid until the
+ * transfer has finished (busDmaBusy clear).
+ */
+void BusDma_Write(const uint8_t *data, uint32_t len);
+
+/**
+ * Spin until the bus is free
+ */
+void BusDma_Wait(void);
+
+/**
+ * Called by the port's completion interrupt once per finished chunk.
+ * Ping-pong descriptors complete strictly alternately, primary first.
+ */
+void BusDma_ChunkDone(void);
+
+#endif /* BUSDMA_H */
@@ -0,0 +1,25 @@
+/**
+ * busdma_port.h - Hardware hooks used by the bus engine
+ *
+ * Implemented by busdma_tm4c.c on the target and by the host model in
+ * tools/busdma_model.c. `half` selects the ping-pong descriptor
+ * (0 = primary, 1 = alternate).
+ */
+
+#ifndef BUSDMA_PORT_H
+#define BUSDMA_PORT_H
+
+#include <stdint.h>
+
+/* Timer, channels and interrupt setup */
+void BusDmaPort_Init(uint32_t sysClock);
+
+/* Load descriptor `half` of both channels: `count` data bytes from `src`
+ * and the 2 * `count` matching strobe writes */
+void BusDmaPort_Arm(uint8_t half, const uint8_t *src, uint16_t count);
+
+/* Start pacing from a known timer phase / stop pacing */
+void BusDmaPort_Start(void);
+void BusDmaPort_Stop(void);
+
+#endif /* BUSDMA_PORT_H */
@@ -0,0 +1,138 @@
+/**
+ * busdma_tm4c.c - TM4C1294 port of the bus engine (Timer3 + µDMA)
+ *
+ * Timer3 runs as two 16-bit periodic halves that are started by the same
+ * register write, so their phase is fixed: Timer3B times out every
+ * BUSDMA_STROBE_CYCLES, Timer3A every second time Timer3B does. When both
+ * time out together the data channel (2) wins over the strobe channel (3)
+ * by channel priority, so Port M holds the new byte before WR rises.
+ *
+ * Both channels run in ping-pong mode. Only the strobe channel's
+ * completion interrupt is enabled: its last write is the WR rising edge
+ * of the chunk's last byte, so when it fires the chunk is on the glass.
+ * The interrupt must be serviced within one chunk time
+ * (BUSDMA_CHUNK_BYTES * 2 * BUSDMA_STROBE_CYCLES cycles, ~100 µs), which
+ * only the sensor edge interrupts can delay.
+ */
+
+#include "busdma.h"
+#include "busdma_port.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_types.h"
+#include <inc/hw_memmap.h>
+#include <inc/hw_ints.h>
+#include <inc/hw_gpio.h>
+#include <inc/hw_timer.h>
+#include <driverlib/sysctl.h>
+#include <driverlib/interrupt.h>
+#include <driverlib/timer.h>
+#include <driverlib/udma.h>
+
+#define BUSDMA_TIMER_BASE       TIMER3_BASE
+#define BUSDMA_TIMER_PERIPH     SYSCTL_PERIPH_TIMER3
+#define BUSDMA_DONE_INT         INT_TIMER3B
+#define BUSDMA_PRIORITY         0x20    /* above every bus user (draw queue 0xE0) */
+
+#define BUSDMA_DATA_CH          UDMA_CH2_TIMER3A
+#define BUSDMA_STROBE_CH        UDMA_CH3_TIMER3B
+
+/* Port M data register with all 8 bits unmasked, Port L with bits 0-4
+ * (CS, WR, RS, RD, RST) so the upper pins are never touched */
+#define BUSDMA_DATA_ADDR        (GPIO_PORTM_BASE + GPIO_O_DATA + (0xFF << 2))
+#define BUSDMA_CTRL_ADDR        (GPIO_PORTL_BASE + GPIO_O_DATA + (0x1F << 2))
+
+/* µDMA control table, 1024-byte aligned as required by the controller */
+#if defined(__TI_COMPILER_VERSION__)
+#pragma DATA_ALIGN(dmaControlTable, 1024)
+static tDMAControlTable dmaControlTable[64];
+#else
+static tDMAControlTable dmaControlTable[64] __attribute__ ((aligned(1024)));
+#endif
+
+/* WR low / WR high for every byte of one chunk */
+static uint8_t strobePattern[BUSDMA_CHUNK_BYTES * 2];
+
+void BusDmaTimerIntHandler(void);
+
+void BusDmaPort_Init(uint32_t sysClock)
+{
+    uint16_t i;
+    (void)sysClock;
+
+    for (i = 0; i < sizeof(strobePattern); i += 2) {
+        strobePattern[i] = 0x15;
+        strobePattern[i + 1] = 0x1F;
+    }
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_UDMA)) {}
+    SysCtlPeripheralEnable(BUSDMA_TIMER_PERIPH);
+    while(!SysCtlPeripheralReady(BUSDMA_TIMER_PERIPH)) {}
+
+    uDMAEnable();
+    uDMAControlBaseSet(dmaControlTable);
+
+    uDMAChannelAssign(BUSDMA_DATA_CH);
+    uDMAChannelAssign(BUSDMA_STROBE_CH);
+    uDMAChannelAttributeDisable(BUSDMA_DATA_CH, UDMA_ATTR_ALL);
+    uDMAChannelAttributeDisable(BUSDMA_STROBE_CH, UDMA_ATTR_ALL);
+
+    // One byte per timer request, source walks the buffer, destination fixed
+    uDMAChannelControlSet(BUSDMA_DATA_CH | UDMA_PRI_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_1);
+    uDMAChannelControlSet(BUSDMA_DATA_CH | UDMA_ALT_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_1);
+    uDMAChannelControlSet(BUSDMA_STROBE_CH | UDMA_PRI_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_1);
+    uDMAChannelControlSet(BUSDMA_STROBE_CH | UDMA_ALT_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_1);
+
+    TimerConfigure(BUSDMA_TIMER_BASE, TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_PERIODIC | TIMER_CFG_B_PERIODIC);
+    TimerLoadSet(BUSDMA_TIMER_BASE, TIMER_A, 2 * BUSDMA_STROBE_CYCLES - 1);
+    TimerLoadSet(BUSDMA_TIMER_BASE, TIMER_B, BUSDMA_STROBE_CYCLES - 1);
+    TimerDMAEventSet(BUSDMA_TIMER_BASE, TIMER_DMA_TIMEOUT_A | TIMER_DMA_TIMEOUT_B);
+
+    IntRegister(BUSDMA_DONE_INT, BusDmaTimerIntHandler);
+    IntPrioritySet(BUSDMA_DONE_INT, BUSDMA_PRIORITY);
+    TimerIntEnable(BUSDMA_TIMER_BASE, TIMER_TIMB_DMA);
+    IntEnable(BUSDMA_DONE_INT);
+}
+
+void BusDmaPort_Arm(uint8_t half, const uint8_t *src, uint16_t count)
+{
+    uint32_t sel = half ? UDMA_ALT_SELECT : UDMA_PRI_SELECT;
+
+    uDMAChannelTransferSet(BUSDMA_DATA_CH | sel, UDMA_MODE_PINGPONG,
+                           (void *)src, (void *)BUSDMA_DATA_ADDR, count);
+    uDMAChannelTransferSet(BUSDMA_STROBE_CH | sel, UDMA_MODE_PINGPONG,
+                           strobePattern, (void *)BUSDMA_CTRL_ADDR, count * 2);
+}
+
+void BusDmaPort_Start(void)
+{
+    // Reload both counters so A and B start in phase
+    HWREG(BUSDMA_TIMER_BASE + TIMER_O_TAV) = 2 * BUSDMA_STROBE_CYCLES - 1;
+    HWREG(BUSDMA_TIMER_BASE + TIMER_O_TBV) = BUSDMA_STROBE_CYCLES - 1;
+
+    // A transfer with an odd chunk count ends with the alternate selected
+    uDMAChannelAttributeDisable(BUSDMA_DATA_CH, UDMA_ATTR_ALTSELECT);
+    uDMAChannelAttributeDisable(BUSDMA_STROBE_CH, UDMA_ATTR_ALTSELECT);
+
+    uDMAChannelEnable(BUSDMA_DATA_CH);
+    uDMAChannelEnable(BUSDMA_STROBE_CH);
+    TimerEnable(BUSDMA_TIMER_BASE, TIMER_BOTH);
+}
+
+void BusDmaPort_Stop(void)
+{
+    TimerDisable(BUSDMA_TIMER_BASE, TIMER_BOTH);
+    uDMAChannelDisable(BUSDMA_DATA_CH);
+    uDMAChannelDisable(BUSDMA_STROBE_CH);
+}
+
+void BusDmaTimerIntHandler(void)
+{
+    TimerIntClear(BUSDMA_TIMER_BASE, TIMER_TIMB_DMA);
+    BusDma_ChunkDone();
+}
@@ -15,9 +15,17 @@
  */
 
 #include "display.h"
+#include "assets_rle.h"
+#include "fastlane.h"
+#include "drawqueue.h"
+#include "tearsync.h"
+#include "bus.h"
+#include "profile/costmodel.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include "inc/hw_types.h"
 #include "inc/tm4c1294ncpdt.h"
@@ -37,6 +45,9 @@ uint8_t oldSevenSegDigitNum[5][3], SevenSegDigitNum[5][3] = {0};
 // Lookup Tables
 // ============================================
 
+// Icons and digit fonts are generated into assets_rle.c by tools/img2rle.py
+// from the images in display/assets/.
+
 // Sin/Cos lookup tables for analog speedometer needle
 // Index range: 90-630 maps to 0-360 degrees for speedometer arc
 const int16_t sin_lut[723] = {
@@ -191,622 +202,50 @@ const int16_t cos_lut[723] = {
    255,  255,  255,
 };
 
-// 16x24 pixel digit bitmaps
-const uint8_t digitBitmaps16x24[10][48] = {
-    // -------------------- 0 --------------------
-    {
-        0x07,0xE0, 0x0F,0xF0, 0x1C,0x38, 0x18,0x18,
-        0x30,0x0C, 0x30,0x0C, 0x30,0x0C, 0x30,0x0C,
-        0x30,0x0C, 0x30,0x0C, 0x30,0x0C, 0x30,0x0C,
-        0x18,0x18, 0x1C,0x38, 0x0F,0xF0, 0x07,0xE0,
-        0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
-    },
-    // -------------------- 1 --------------------
-    {
-        0x00,0xC0, 0x01,0xC0, 0x03,0xC0, 0x07,0xC0,
-        0x0D,0xC0, 0x19,0xC0, 0x31,0xC0, 0x01,0xC0,
-        0x01,0xC0, 0x01,0xC0, 0x01,0xC0, 0x01,0xC0,
-        0x01,0xC0, 0x01,0xC0, 0x3F,0xFC, 0x3F,0xFC,
-        0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
-    },
-    // -------------------- 2 --------------------
-    {
-        0x07,0xE0, 0x0F,0xF0, 0x1C,0x38, 0x18,0x18,
-        0x00,0x18, 0x00,0x38, 0x00,0x70, 0x00,0xE0,
-        0x01,0xC0, 0x03,0x80, 0x07,0x00, 0x0E,0x00,
-        0x1C,0x00, 0x38,0x00, 0x3F,0xF8, 0x3F,0xF8,
-        0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
-    },
-    // -------------------- 3 --------------------
-    {
-        0x07,0xE0, 0x0F,0xF0, 0x1C,0x38, 0x18,0x18,
-        0x00,0x18, 0x00,0x38, 0x01,0xF0, 0x01,0xF0,
-        0x00,0x38, 0x00,0x18, 0x00,0x18, 0x18,0x18,
-        0x1C,0x38, 0x0F,0xF0, 0x07,0xE0, 0x00,0x00,
-        0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
-    },
-    // -------------------- 4 --------------------
-    {
-        0x00,0x38, 0x00,0x78, 0x00,0xF8, 0x01,0xB8,
-        0x03,0x38, 0x06,0x38, 0x0C,0x38, 0x18,0x38,
-        0x30,0x38, 0x3F,0xFC, 0x3F,0xFC, 0x00,0x38,
-        0x00,0x38, 0x00,0x38, 0x00,0x38, 0x00,0x00,
-        0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
-    },
-    // -------------------- 5 --------------------
-    {
-        0x3F,0xF8, 0x3F,0xF8, 0x30,0x00, 0x30,0x00,
-        0x37,0xE0, 0x3F,0xF0, 0x38,0x38, 0x00,0x1C,
-        0x00,0x1C, 0x00,0x1C, 0x00,0x1C, 0x30,0x38,
-        0x1C,0x78, 0x0F,0xF0, 0x07,0xE0, 0x00,0x00,
-        0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
-    },
-    // -------------------- 6 --------------------
-    {
-        0x07,0xE0, 0x0F,0xF0, 0x1C,0x38, 0x18,0x00,
-        0x30,0x00, 0x37,0xE0, 0x3F,0xF0, 0x38,0x38,
-        0x30,0x1C, 0x30,0x1C, 0x30,0x1C, 0x38,0x38,
-        0x1C,0x78, 0x0F,0xF0, 0x07,0xE0, 0x00,0x00,
-        0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
-    },
-    // -------------------- 7 --------------------
-    {
-        0x3F,0xF8, 0x3F,0xF8, 0x00,0x38, 0x00,0x70,
-        0x00,0xE0, 0x01,0xC0, 0x03,0x80, 0x03,0x00,
-        0x06,0x00, 0x0E,0x00, 0x0C,0x00, 0x1C,0x00,
-        0x1C,0x00, 0x18,0x00, 0x18,0x00, 0x00,0x00,
-        0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
-    },
-    // -------------------- 8 --------------------
-    {
-        0x07,0xE0, 0x0F,0xF0, 0x1C,0x38, 0x18,0x18,
-        0x18,0x18, 0x1C,0x38, 0x0F,0xF0, 0x07,0xE0,
-        0x0F,0xF0, 0x1C,0x38, 0x18,0x18, 0x18,0x18,
-        0x1C,0x38, 0x0F,0xF0, 0x07,0xE0, 0x00,0x00,
-        0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
-    },
-    // -------------------- 9 --------------------
-    {
-        0x07,0xE0, 0x0F,0xF0, 0x1C,0x38, 0x38,0x1C,
-        0x30,0x1C, 0x30,0x1C, 0x38,0x3C, 0x1F,0xFC,
-        0x0F,0xDC, 0x00,0x1C, 0x00,0x1C, 0x00,0x18,
-        0x1C,0x38, 0x0F,0xF0, 0x07,0xE0, 0x00,0x00,
-        0x00,0x00, 0x00,0x00, 0x00,0x00, 0x00,0x00
-    }
-};
-
-// 32x50 pixel digit bitmaps (empty - to be populated by user)
-const uint8_t digitBitmaps32x50[10][200] = {
-// -------------------- 0 --------------------
-    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0xFF,0xFE,0x00,0x01,0xFF,0xFF,0x00,0x03,0xFF,
-     0xFF,0x80,0x01,0xFF,0xFF,0x60,0x0C,0xFF,0xFE,
-     0xF0,0x1E,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,
-     0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,
-     0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,
-     0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,
-     0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,
-     0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,
-     0x00,0x01,0xF8,0x3E,0x00,0x00,0x78,0x38,0x00,
-     0x00,0x18,0x20,0x00,0x00,0x08,0x00,0x00,0x00,
-     0x00,0x20,0x00,0x00,0x00,0x38,0x00,0x00,0x18,
-     0x3E,0x00,0x00,0x78,0x3F,0x00,0x01,0xF8,0x3F,
-     0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,
-     0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,
-     0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,
-     0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,
-     0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,
-     0x01,0xF8,0x3F,0x00,0x01,0xF8,0x1E,0x00,0x00,
-     0xF0,0x0C,0xFF,0xFE,0x60,0x01,0xFF,0xFF,0x00,
-     0x03,0xFF,0xFF,0x80,0x01,0xFF,0xFF,0x00,0x00,
-     0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},  // 0
-
-    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0xF0,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,
-     0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,
-     0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0x78,0x00,0x00,
-     0x00,0x18,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,
-     0x00,0x00,0x00,0x78,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,
-     0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00},  // 1
-
-    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFE,0x00,0x01,0xFF,0xFF,0x00,0x03,0xFF,
-     0xFF,0x80,0x01,0xFF,0xFF,0x60,0x00,0xFF,0xFE,0xF0,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,
-     0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,
-     0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0x78,0x01,0xFF,
-     0xFE,0x18,0x03,0xFF,0xFF,0x88,0x0F,0xFF,0xFF,0xE0,0x27,0xFF,0xFF,0xC0,0x39,0xFF,0xFF,0x00,
-     0x3E,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,
-     0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,
-     0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,
-     0x00,0x00,0x3F,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x0C,0xFF,0xFE,0x00,0x01,0xFF,0xFF,0x00,
-     0x03,0xFF,0xFF,0x80,0x01,0xFF,0xFF,0x00,0x00,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00},  // 2
-
-    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFE,0x00,0x01,0xFF,0xFF,0x00,0x03,0xFF,
-     0xFF,0x80,0x01,0xFF,0xFF,0x60,0x00,0xFF,0xFE,0xF0,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,
-     0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,
-     0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0x78,0x01,0xFF,
-     0xFE,0x18,0x03,0xFF,0xFF,0x88,0x0F,0xFF,0xFF,0xE0,0x07,0xFF,0xFF,0xC0,0x01,0xFF,0xFF,0x18,
-     0x00,0x00,0x00,0x78,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,
-     0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0xF0,0x00,0xFF,0xFE,0x60,0x01,0xFF,0xFF,0x00,
-     0x03,0xFF,0xFF,0x80,0x01,0xFF,0xFF,0x00,0x00,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00},  // 3
-
-    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x00,0x00,0x00,0x60,0x0C,0x00,0x00,0xF0,0x1E,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,
-     0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,
-     0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,
-     0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3E,0x00,0x00,0x78,0x39,0xFF,
-     0xFE,0x18,0x23,0xFF,0xFF,0x88,0x0F,0xFF,0xFF,0xE0,0x07,0xFF,0xFF,0xC0,0x01,0xFF,0xFF,0x18,
-     0x00,0x00,0x00,0x78,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,
-     0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00},  // 4
-
-    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFE,0x00,0x01,0xFF,0xFF,0x00,0x03,0xFF,
-     0xFF,0x80,0x01,0xFF,0xFF,0x00,0x0C,0xFF,0xFE,0x00,0x1E,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,
-     0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,
-     0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,
-     0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x39,0xFF,
-     0xFE,0x00,0x23,0xFF,0xFF,0x80,0x0F,0xFF,0xFF,0xE0,0x07,0xFF,0xFF,0xC0,0x01,0xFF,0xFF,0x18,
-     0x00,0x00,0x00,0x78,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,
-     0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0xF0,0x00,0xFF,0xFE,0x60,0x01,0xFF,0xFF,0x00,
-     0x03,0xFF,0xFF,0x80,0x01,0xFF,0xFF,0x00,0x00,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00},  // 5
-
-    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFE,0x00,0x01,0xFF,0xFF,0x00,0x03,0xFF,
-     0xFF,0x80,0x01,0xFF,0xFF,0x00,0x0C,0xFF,0xFE,0x00,0x1E,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,
-     0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,
-     0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,
-     0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x39,0xFF,
-     0xFE,0x00,0x23,0xFF,0xFF,0x80,0x0F,0xFF,0xFF,0xE0,0x27,0xFF,0xFF,0xC0,0x39,0xFF,0xFF,0x18,
-     0x3E,0x00,0x00,0x78,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,
-     0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,
-     0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,
-     0x01,0xF8,0x3F,0x00,0x01,0xF8,0x1E,0x00,0x00,0xF0,0x0C,0xFF,0xFE,0x60,0x01,0xFF,0xFF,0x00,
-     0x03,0xFF,0xFF,0x80,0x01,0xFF,0xFF,0x00,0x00,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00},  // 6
-
-    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFE,0x00,0x01,0xFF,0xFF,0x00,0x03,0xFF,
-     0xFF,0x80,0x01,0xFF,0xFF,0x60,0x00,0xFF,0xFE,0xF0,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,
-     0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,
-     0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0x78,0x00,0x00,
-     0x00,0x18,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,
-     0x00,0x00,0x00,0x78,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,
-     0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00},  // 7
-
-    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFE,0x00,0x01,0xFF,0xFF,0x00,0x03,0xFF,
-     0xFF,0x80,0x01,0xFF,0xFF,0x60,0x0C,0xFF,0xFE,0xF0,0x1E,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,
-     0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,
-     0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,
-     0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3E,0x00,0x00,0x78,0x39,0xFF,
-     0xFE,0x18,0x23,0xFF,0xFF,0x88,0x0F,0xFF,0xFF,0xE0,0x27,0xFF,0xFF,0xC0,0x39,0xFF,0xFF,0x18,
-     0x3E,0x00,0x00,0x78,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,
-     0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,
-     0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,
-     0x01,0xF8,0x3F,0x00,0x01,0xF8,0x1E,0x00,0x00,0xF0,0x0C,0xFF,0xFE,0x60,0x01,0xFF,0xFF,0x00,
-     0x03,0xFF,0xFF,0x80,0x01,0xFF,0xFF,0x00,0x00,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00},  // 8
-
-    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFE,0x00,0x01,0xFF,0xFF,0x00,0x03,0xFF,
-     0xFF,0x80,0x01,0xFF,0xFF,0x60,0x0C,0xFF,0xFE,0xF0,0x1E,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,
-     0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,
-     0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,
-     0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3F,0x00,0x01,0xF8,0x3E,0x00,0x00,0x78,0x39,0xFF,
-     0xFE,0x18,0x23,0xFF,0xFF,0x88,0x0F,0xFF,0xFF,0xE0,0x07,0xFF,0xFF,0xC0,0x01,0xFF,0xFF,0x18,
-     0x00,0x00,0x00,0x78,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,
-     0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,
-     0x01,0xF8,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0xF0,0x00,0xFF,0xFE,0x60,0x01,0xFF,0xFF,0x00,
-     0x03,0xFF,0xFF,0x80,0x01,0xFF,0xFF,0x00,0x00,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00}  // 9
-};
-
-// Bitmap arrays (empty - to be populated by user with actual bitmap data)
-const unsigned char GearLetterD[360] = {
-     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xf8,
-      0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x7f, 0xff,
-      0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x00,
-      0x7f, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0x80, 0x00, 0x3f, 0xff, 0x00, 0x7f, 0x80, 0x00, 0x0f,
-      0xff, 0x00, 0x7f, 0x80, 0x00, 0x03, 0xff, 0x80, 0x7f, 0x80, 0x00, 0x01, 0xff, 0xc0, 0x7f, 0x80,
-      0x00, 0x00, 0x7f, 0xe0, 0x7f, 0x80, 0x00, 0x00, 0x3f, 0xe0, 0x7f, 0x80, 0x00, 0x00, 0x1f, 0xf0,
-      0x7f, 0x80, 0x00, 0x00, 0x1f, 0xf8, 0x7f, 0x80, 0x00, 0x00, 0x0f, 0xf8, 0x7f, 0x80, 0x00, 0x00,
-      0x07, 0xf8, 0x7f, 0x80, 0x00, 0x00, 0x07, 0xfc, 0x7f, 0x80, 0x00, 0x00, 0x03, 0xfc, 0x7f, 0x80,
-      0x00, 0x00, 0x03, 0xfc, 0x7f, 0x80, 0x00, 0x00, 0x01, 0xfe, 0x7f, 0x80, 0x00, 0x00, 0x01, 0xfe,
-      0x7f, 0x80, 0x00, 0x00, 0x01, 0xfe, 0x7f, 0x80, 0x00, 0x00, 0x01, 0xfe, 0x7f, 0x80, 0x00, 0x00,
-      0x01, 0xfe, 0x7f, 0x80, 0x00, 0x00, 0x01, 0xfe, 0x7f, 0x80, 0x00, 0x00, 0x01, 0xfe, 0x7f, 0x80,
-      0x00, 0x00, 0x01, 0xfe, 0x7f, 0x80, 0x00, 0x00, 0x01, 0xfe, 0x7f, 0x80, 0x00, 0x00, 0x01, 0xfe,
-      0x7f, 0x80, 0x00, 0x00, 0x01, 0xfe, 0x7f, 0x80, 0x00, 0x00, 0x01, 0xfe, 0x7f, 0x80, 0x00, 0x00,
-      0x03, 0xfe, 0x7f, 0x80, 0x00, 0x00, 0x03, 0xfc, 0x7f, 0x80, 0x00, 0x00, 0x03, 0xfc, 0x7f, 0x80,
-      0x00, 0x00, 0x07, 0xfc, 0x7f, 0x80, 0x00, 0x00, 0x07, 0xf8, 0x7f, 0x80, 0x00, 0x00, 0x0f, 0xf8,
-      0x7f, 0x80, 0x00, 0x00, 0x1f, 0xf0, 0x7f, 0x80, 0x00, 0x00, 0x3f, 0xf0, 0x7f, 0x80, 0x00, 0x00,
-      0x7f, 0xe0, 0x7f, 0x80, 0x00, 0x00, 0xff, 0xe0, 0x7f, 0x80, 0x00, 0x01, 0xff, 0xc0, 0x7f, 0x80,
-      0x00, 0x03, 0xff, 0x80, 0x7f, 0x80, 0x00, 0x0f, 0xff, 0x00, 0x7f, 0x80, 0x00, 0xff, 0xfe, 0x00,
-      0x7f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xff,
-      0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff,
-      0xff, 0xfe, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00,
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
- };
-const unsigned char GearLetterR[360] = {
-        // , 48x60
-      0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0xff, 0xff, 0xc0,
-      0x00, 0x01, 0x1f, 0xff, 0xff, 0xf0, 0x00, 0x01, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x01, 0x3f, 0xff,
-      0xff, 0xff, 0x00, 0x01, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x01, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x01,
-      0x3f, 0xff, 0xff, 0xff, 0xc0, 0x01, 0x3f, 0xff, 0xff, 0xff, 0xe0, 0x01, 0x3f, 0xc0, 0x00, 0x7f,
-      0xf0, 0x01, 0x3f, 0x80, 0x00, 0x3f, 0xf0, 0x01, 0x3f, 0x80, 0x00, 0x1f, 0xf8, 0x01, 0x3f, 0x80,
-      0x00, 0x0f, 0xf8, 0x01, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x01, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x01,
-      0x3f, 0x80, 0x00, 0x03, 0xfc, 0x01, 0x3f, 0x80, 0x00, 0x03, 0xfc, 0x01, 0x3f, 0x80, 0x00, 0x03,
-      0xfc, 0x01, 0x3f, 0x80, 0x00, 0x03, 0xfc, 0x01, 0x3f, 0x80, 0x00, 0x07, 0xf8, 0x01, 0x3f, 0x80,
-      0x00, 0x07, 0xf8, 0x01, 0x3f, 0x80, 0x00, 0x0f, 0xf8, 0x01, 0x3f, 0x80, 0x00, 0x0f, 0xf8, 0x01,
-      0x3f, 0x80, 0x00, 0x1f, 0xf0, 0x01, 0x3f, 0xc0, 0x00, 0x7f, 0xf0, 0x01, 0x3f, 0xe0, 0x03, 0xff,
-      0xe0, 0x01, 0x3f, 0xff, 0xff, 0xff, 0xe0, 0x01, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x01, 0x3f, 0xff,
-      0xff, 0xff, 0x80, 0x01, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x01, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x01,
-      0x3f, 0xff, 0xff, 0xff, 0x80, 0x01, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x01, 0x3f, 0xff, 0xfe, 0xff,
-      0xc0, 0x01, 0x3f, 0x80, 0x00, 0x7f, 0xc0, 0x01, 0x3f, 0x80, 0x00, 0x3f, 0xe0, 0x01, 0x3f, 0x80,
-      0x00, 0x3f, 0xf0, 0x01, 0x3f, 0x80, 0x00, 0x1f, 0xf0, 0x01, 0x3f, 0x80, 0x00, 0x0f, 0xf8, 0x01,
-      0x3f, 0x80, 0x00, 0x0f, 0xf8, 0x01, 0x3f, 0x80, 0x00, 0x07, 0xfc, 0x01, 0x3f, 0x80, 0x00, 0x07,
-      0xfc, 0x01, 0x3f, 0x80, 0x00, 0x03, 0xfe, 0x01, 0x3f, 0x80, 0x00, 0x03, 0xff, 0x01, 0x3f, 0x80,
-      0x00, 0x01, 0xff, 0x01, 0x3f, 0x80, 0x00, 0x00, 0xff, 0x81, 0x3f, 0x80, 0x00, 0x00, 0xff, 0x81,
-      0x3f, 0x80, 0x00, 0x00, 0x7f, 0xc1, 0x3f, 0x80, 0x00, 0x00, 0x7f, 0xe1, 0x3f, 0x80, 0x00, 0x00,
-      0x3f, 0xe1, 0x3f, 0x80, 0x00, 0x00, 0x3f, 0xf1, 0x3f, 0x80, 0x00, 0x00, 0x1f, 0xf1, 0x3f, 0x80,
-      0x00, 0x00, 0x0f, 0xf1, 0x3f, 0x80, 0x00, 0x00, 0x0f, 0xf1, 0x3f, 0x80, 0x00, 0x00, 0x07, 0xf1,
-      0x1f, 0x00, 0x00, 0x00, 0x03, 0xe1, 0x0e, 0x00, 0x00, 0x00, 0x01, 0xc1, 0x00, 0x00, 0x00, 0x00,
-      0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
- };
-const unsigned char kmh [192] = {
-                                 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00,
-                                     0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x88, 0x00,
-                                     0xe0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x00,
-                                     0xe0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1c, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1c, 0x00,
-                                     0xe0, 0xc0, 0xfc, 0x3f, 0x00, 0x0c, 0x1f, 0xf8, 0xe1, 0xc1, 0xfe, 0x7f, 0x80, 0x1c, 0x1f, 0xfc,
-                                     0xe3, 0xc3, 0xff, 0xff, 0xc0, 0x1c, 0x1f, 0xfc, 0xe7, 0x87, 0x87, 0xe1, 0xc0, 0x38, 0x1e, 0x0e,
-                                     0xff, 0x07, 0x03, 0xc0, 0xe0, 0x38, 0x1c, 0x0e, 0xfc, 0x06, 0x03, 0x80, 0xe0, 0x70, 0x1c, 0x06,
-                                     0xfc, 0x06, 0x03, 0x80, 0xe0, 0x70, 0x1c, 0x07, 0xf8, 0x06, 0x03, 0x80, 0xe0, 0xe0, 0x1c, 0x07,
-                                     0xfc, 0x06, 0x03, 0x80, 0xe0, 0xe0, 0x1c, 0x07, 0xfe, 0x06, 0x03, 0x80, 0xe1, 0xc0, 0x1c, 0x07,
-                                     0xef, 0x06, 0x03, 0x80, 0xe1, 0xc0, 0x1c, 0x07, 0xe7, 0x86, 0x03, 0x80, 0xe3, 0x80, 0x1c, 0x07,
-                                     0xe3, 0xc6, 0x03, 0x80, 0xe3, 0x80, 0x1c, 0x07, 0xe1, 0xc6, 0x03, 0x80, 0x67, 0x00, 0x1c, 0x07,
-                                     0x40, 0x44, 0x01, 0x00, 0x47, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00};
-
-// 'ODO', 144x48px
-const unsigned char ODO [432] = {
-                                 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00,
-                                 0x0f, 0xff, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x1f, 0xff, 0xe0, 0x00,
-                                 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xfe, 0x00,
-                                 0x01, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xc0,
-                                 0x1f, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x07, 0xf8, 0x1f, 0xe0, 0x1e, 0x00, 0x7f, 0x00,
-                                 0x07, 0xf8, 0x1f, 0xe0, 0x0f, 0xe0, 0x07, 0xf0, 0x1e, 0x00, 0x1f, 0x80, 0x0f, 0xc0, 0x07, 0xf0,
-                                 0x0f, 0x80, 0x01, 0xf8, 0x1e, 0x00, 0x0f, 0xc0, 0x1f, 0x80, 0x03, 0xf0, 0x1f, 0x00, 0x00, 0xf8,
-                                 0x1e, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x01, 0xf8, 0x1f, 0x00, 0x00, 0x7c, 0x1e, 0x00, 0x03, 0xe0,
-                                 0x3e, 0x00, 0x00, 0xf8, 0x3e, 0x00, 0x00, 0x7c, 0x1e, 0x00, 0x03, 0xe0, 0x3e, 0x00, 0x00, 0x7c,
-                                 0x3c, 0x00, 0x00, 0x3c, 0x1e, 0x00, 0x01, 0xf0, 0x3c, 0x00, 0x00, 0x7c, 0x3c, 0x00, 0x00, 0x3e,
-                                 0x1e, 0x00, 0x01, 0xf0, 0x7c, 0x00, 0x00, 0x3c, 0x7c, 0x00, 0x00, 0x3e, 0x1e, 0x00, 0x00, 0xf0,
-                                 0x78, 0x00, 0x00, 0x3e, 0x7c, 0x00, 0x00, 0x1e, 0x1e, 0x00, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3e,
-                                 0x78, 0x00, 0x00, 0x1e, 0x1e, 0x00, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x1e, 0x78, 0x00, 0x00, 0x1e,
-                                 0x1e, 0x00, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x1e, 0x78, 0x00, 0x00, 0x1e, 0x1e, 0x00, 0x00, 0xf0,
-                                 0x78, 0x00, 0x00, 0x1e, 0x78, 0x00, 0x00, 0x1e, 0x1e, 0x00, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3e,
-                                 0x7c, 0x00, 0x00, 0x1e, 0x1e, 0x00, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3e, 0x7c, 0x00, 0x00, 0x3e,
-                                 0x1e, 0x00, 0x00, 0xf0, 0x78, 0x00, 0x00, 0x3e, 0x3c, 0x00, 0x00, 0x3e, 0x1e, 0x00, 0x01, 0xf0,
-                                 0x7c, 0x00, 0x00, 0x3c, 0x3e, 0x00, 0x00, 0x3c, 0x1e, 0x00, 0x01, 0xf0, 0x3c, 0x00, 0x00, 0x7c,
-                                 0x3e, 0x00, 0x00, 0x7c, 0x1e, 0x00, 0x03, 0xe0, 0x3e, 0x00, 0x00, 0x7c, 0x1f, 0x00, 0x00, 0xfc,
-                                 0x1e, 0x00, 0x03, 0xe0, 0x3f, 0x00, 0x00, 0xf8, 0x1f, 0x80, 0x00, 0xf8, 0x1e, 0x00, 0x07, 0xc0,
-                                 0x1f, 0x00, 0x01, 0xf8, 0x0f, 0xc0, 0x01, 0xf0, 0x1e, 0x00, 0x0f, 0xc0, 0x1f, 0x80, 0x03, 0xf0,
-                                 0x0f, 0xe0, 0x07, 0xf0, 0x1e, 0x00, 0x3f, 0x80, 0x0f, 0xe0, 0x07, 0xe0, 0x07, 0xfc, 0x3f, 0xe0,
-                                 0x1e, 0x00, 0xff, 0x00, 0x07, 0xf8, 0x3f, 0xe0, 0x03, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xfe, 0x00,
-                                 0x03, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0x00,
-                                 0x00, 0x7f, 0xfe, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x1f, 0xf8, 0x00,
-                                 0x1f, 0xff, 0xe0, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x01, 0x80, 0x00, 0x07, 0xfe, 0x00, 0x00,
-                                 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-// 'km', 48x24px
-const unsigned char km [144] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xf0, 0x1c, 0x03, 0xf8, 0x1f, 0xc0, 0xf0, 0x3c, 0x0f, 0xfc, 0x3f, 0xf0,
-    0xf0, 0xfc, 0x1f, 0xfe, 0x7f, 0xf8, 0xf1, 0xf8, 0x3f, 0x1f, 0xfc, 0xfc, 0xf3, 0xe0, 0x3c, 0x07,
-    0xf0, 0x3e, 0xf7, 0xc0, 0x78, 0x03, 0xe0, 0x1e, 0xff, 0x80, 0x78, 0x03, 0xc0, 0x0e, 0xff, 0x00,
-    0x70, 0x03, 0xc0, 0x0e, 0xfe, 0x00, 0x70, 0x03, 0xc0, 0x0e, 0xff, 0x00, 0x70, 0x03, 0xc0, 0x0e,
-    0xff, 0x80, 0x70, 0x03, 0xc0, 0x0e, 0xf7, 0xc0, 0x70, 0x03, 0xc0, 0x0e, 0xf3, 0xf0, 0x70, 0x03,
-    0xc0, 0x0e, 0xf1, 0xf8, 0x70, 0x03, 0xc0, 0x0e, 0xf0, 0xfc, 0x70, 0x03, 0xc0, 0x0e, 0xf0, 0x3c,
-    0x70, 0x03, 0xc0, 0x0e, 0x60, 0x18, 0x70, 0x01, 0x80, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-// 'engspd', 176x36px
-const unsigned char engspd [792] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xf8, 0x70, 0x00, 0x3c, 0x00, 0x0f, 0xfe, 0x00,
-    0x00, 0x00, 0x03, 0xff, 0x00, 0x3f, 0xff, 0xc0, 0x07, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xfc, 0x78,
-    0x00, 0x3c, 0x00, 0x3f, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x3f, 0xff, 0xf8, 0x0f, 0xff,
-    0xf0, 0x00, 0x7f, 0xff, 0xfc, 0x7c, 0x00, 0x3c, 0x00, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xff,
-    0xf0, 0x3f, 0xff, 0xfe, 0x0f, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xfc, 0x7c, 0x00, 0x3c, 0x01, 0xff,
-    0xff, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x00, 0x78, 0x00,
-    0x00, 0x7e, 0x00, 0x3c, 0x03, 0xf8, 0x03, 0xf8, 0x00, 0x00, 0x7e, 0x00, 0xf8, 0x3c, 0x00, 0x7f,
-    0x0f, 0x80, 0x7f, 0xc0, 0x78, 0x00, 0x00, 0x7e, 0x00, 0x3c, 0x07, 0xe0, 0x00, 0xfc, 0x00, 0x00,
-    0xf8, 0x00, 0x7c, 0x3c, 0x00, 0x1f, 0x8f, 0x00, 0x0f, 0xe0, 0x78, 0x00, 0x00, 0x7f, 0x00, 0x3c,
-    0x0f, 0xc0, 0x00, 0x7e, 0x00, 0x00, 0xf0, 0x00, 0x3c, 0x3c, 0x00, 0x0f, 0x8f, 0x00, 0x07, 0xe0,
-    0x78, 0x00, 0x00, 0x7f, 0x00, 0x3c, 0x0f, 0x80, 0x00, 0x3c, 0x00, 0x00, 0xf0, 0x00, 0x3c, 0x3c,
-    0x00, 0x07, 0x8f, 0x00, 0x01, 0xf0, 0x78, 0x00, 0x00, 0x7f, 0x80, 0x3c, 0x1f, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0xf0, 0x00, 0x3c, 0x3c, 0x00, 0x07, 0xcf, 0x00, 0x00, 0xf8, 0x78, 0x00, 0x00, 0x7f,
-    0x80, 0x3c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x3c, 0x00, 0x07, 0xcf, 0x00,
-    0x00, 0xf8, 0x78, 0x00, 0x00, 0x7b, 0xc0, 0x3c, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00,
-    0x00, 0x3c, 0x00, 0x03, 0xcf, 0x00, 0x00, 0x7c, 0x78, 0x00, 0x00, 0x7b, 0xc0, 0x3c, 0x3c, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x3c, 0x00, 0x07, 0xcf, 0x00, 0x00, 0x7c, 0x78, 0x00,
-    0x00, 0x79, 0xe0, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x3c, 0x00, 0x07,
-    0xcf, 0x00, 0x00, 0x3c, 0x7f, 0xff, 0xf0, 0x79, 0xf0, 0x3c, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7f, 0x00, 0x00, 0x3c, 0x00, 0x07, 0x8f, 0x00, 0x00, 0x3c, 0x7f, 0xff, 0xf0, 0x78, 0xf0, 0x3c,
-    0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x3c, 0x00, 0x0f, 0x8f, 0x00, 0x00, 0x3c,
-    0x7f, 0xff, 0xf0, 0x78, 0xf8, 0x3c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x3c,
-    0x00, 0x3f, 0x8f, 0x00, 0x00, 0x3c, 0x7f, 0xff, 0xf0, 0x78, 0x78, 0x3c, 0x78, 0x01, 0xff, 0xff,
-    0x80, 0x00, 0x0f, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x1c, 0x78, 0x00, 0x00, 0x78,
-    0x7c, 0x3c, 0x78, 0x01, 0xff, 0xff, 0x80, 0x00, 0x03, 0xff, 0xf0, 0x3f, 0xff, 0xfe, 0x0f, 0x00,
-    0x00, 0x1c, 0x78, 0x00, 0x00, 0x78, 0x3c, 0x3c, 0x78, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 0x7f,
-    0xf8, 0x3f, 0xff, 0xfc, 0x0f, 0x00, 0x00, 0x3c, 0x78, 0x00, 0x00, 0x78, 0x1e, 0x3c, 0x7c, 0x01,
-    0xff, 0xff, 0x80, 0x00, 0x00, 0x07, 0xfc, 0x3f, 0xff, 0xf0, 0x0f, 0x00, 0x00, 0x3c, 0x78, 0x00,
-    0x00, 0x78, 0x1e, 0x3c, 0x7c, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0xfe, 0x3c, 0x00, 0x00,
-    0x0f, 0x00, 0x00, 0x3c, 0x78, 0x00, 0x00, 0x78, 0x0f, 0x3c, 0x3c, 0x00, 0x00, 0x0f, 0x00, 0x00,
-    0x00, 0x00, 0x3e, 0x3c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x3c, 0x78, 0x00, 0x00, 0x78, 0x0f, 0x3c,
-    0x3c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x3c,
-    0x78, 0x00, 0x00, 0x78, 0x07, 0xbc, 0x3e, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x3c,
-    0x00, 0x00, 0x0f, 0x00, 0x00, 0x7c, 0x78, 0x00, 0x00, 0x78, 0x07, 0xfc, 0x3e, 0x00, 0x00, 0x1f,
-    0x00, 0x00, 0x00, 0x00, 0x1f, 0x3c, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf8, 0x78, 0x00, 0x00, 0x78,
-    0x03, 0xfc, 0x1f, 0x00, 0x00, 0x3e, 0x00, 0x01, 0xe0, 0x00, 0x1f, 0x3c, 0x00, 0x00, 0x0f, 0x00,
-    0x00, 0xf8, 0x78, 0x00, 0x00, 0x78, 0x03, 0xfc, 0x1f, 0x80, 0x00, 0x3e, 0x00, 0x01, 0xf0, 0x00,
-    0x1f, 0x3c, 0x00, 0x00, 0x0f, 0x00, 0x01, 0xf0, 0x78, 0x00, 0x00, 0x78, 0x01, 0xfc, 0x0f, 0xc0,
-    0x00, 0x7c, 0x00, 0x01, 0xf0, 0x00, 0x1e, 0x3c, 0x00, 0x00, 0x0f, 0x00, 0x03, 0xf0, 0x78, 0x00,
-    0x00, 0x78, 0x01, 0xfc, 0x07, 0xe0, 0x00, 0xfc, 0x00, 0x00, 0xf8, 0x00, 0x3e, 0x3c, 0x00, 0x00,
-    0x0f, 0x00, 0x0f, 0xe0, 0x78, 0x00, 0x00, 0x78, 0x00, 0xfc, 0x07, 0xf8, 0x03, 0xf8, 0x00, 0x00,
-    0xfc, 0x00, 0x7c, 0x3c, 0x00, 0x00, 0x0f, 0x80, 0x3f, 0xc0, 0x7f, 0xff, 0xfc, 0x78, 0x00, 0xfc,
-    0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0x87, 0xfc, 0x3c, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x80,
-    0x7f, 0xff, 0xfc, 0x78, 0x00, 0x7c, 0x00, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xff, 0xf8, 0x3c,
-    0x00, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x7f, 0xff, 0xfc, 0x78, 0x00, 0x3c, 0x00, 0x7f, 0xff, 0x80,
-    0x00, 0x00, 0x1f, 0xff, 0xe0, 0x3c, 0x00, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xfc, 0x70,
-    0x00, 0x3c, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xff, 0x80, 0x3c, 0x00, 0x00, 0x07, 0xff,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-const unsigned char rpm [192] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x03, 0xff, 0xf8, 0x3c, 0x00, 0x0e,
-    0x7f, 0xff, 0x83, 0xff, 0xfc, 0x3c, 0x00, 0x1e, 0x70, 0x07, 0xc3, 0x80, 0x3e, 0x3e, 0x00, 0x1e,
-    0x70, 0x01, 0xe3, 0x80, 0x0f, 0x3e, 0x00, 0x1e, 0x70, 0x00, 0xe3, 0x80, 0x0f, 0x3e, 0x00, 0x3e,
-    0x70, 0x00, 0xf3, 0x80, 0x07, 0x3f, 0x00, 0x3e, 0x70, 0x00, 0xf3, 0x80, 0x07, 0x3f, 0x00, 0x7e,
-    0x70, 0x00, 0xe3, 0x80, 0x07, 0x3f, 0x80, 0x7e, 0x70, 0x01, 0xe3, 0x80, 0x0f, 0x3b, 0x80, 0x7e,
-    0x70, 0x03, 0xe3, 0x80, 0x1e, 0x3b, 0x80, 0xee, 0x7f, 0xff, 0xc3, 0xff, 0xfe, 0x39, 0xc0, 0xee,
-    0x7f, 0xff, 0x83, 0xff, 0xfc, 0x39, 0xc0, 0xee, 0x7f, 0xfe, 0x03, 0xff, 0xf0, 0x39, 0xc1, 0xce,
-    0x70, 0xf0, 0x03, 0x80, 0x00, 0x38, 0xe1, 0xce, 0x70, 0x78, 0x03, 0x80, 0x00, 0x38, 0xe3, 0x8e,
-    0x70, 0x3c, 0x03, 0x80, 0x00, 0x38, 0x73, 0x8e, 0x70, 0x1c, 0x03, 0x80, 0x00, 0x38, 0x73, 0x8e,
-    0x70, 0x1e, 0x03, 0x80, 0x00, 0x38, 0x77, 0x0e, 0x70, 0x0f, 0x03, 0x80, 0x00, 0x38, 0x3f, 0x0e,
-    0x70, 0x07, 0x83, 0x80, 0x00, 0x38, 0x3f, 0x0e, 0x70, 0x03, 0xc3, 0x80, 0x00, 0x38, 0x3e, 0x0e,
-    0x70, 0x03, 0xc3, 0x80, 0x00, 0x38, 0x1e, 0x0e, 0x70, 0x01, 0xe3, 0x80, 0x00, 0x38, 0x1c, 0x0e
-};
-
-// 'water-temperature-1', 64x64px
-const unsigned char watertemp [512] = { //64x64
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00,
-    0x1f, 0xe0, 0x00, 0x1f, 0xe0, 0x00, 0xfe, 0x00, 0xff, 0xf8, 0x00, 0x3f, 0xf0, 0x07, 0xff, 0xc0,
-    0x7f, 0xfe, 0x00, 0x7f, 0xf0, 0x0f, 0xff, 0xe0, 0x7e, 0x7f, 0xf0, 0x7f, 0xf8, 0x1f, 0xc7, 0xfc,
-    0x40, 0x1f, 0xfc, 0x7f, 0xf8, 0x3e, 0x00, 0xfe, 0x00, 0x07, 0xfc, 0xff, 0xf8, 0x1c, 0x00, 0x3e,
-    0x00, 0x01, 0xf8, 0x7f, 0xf8, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x03, 0xf0, 0x00, 0x00,
-    0x00, 0x00, 0x3f, 0x80, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x0f, 0xfe, 0x00, 0x20,
-    0x0e, 0x00, 0xff, 0xf0, 0x1f, 0xff, 0x00, 0xf0, 0x0f, 0x01, 0xf1, 0xf8, 0x1e, 0x0f, 0x01, 0xf8,
-    0x0f, 0xc3, 0xe0, 0xfc, 0x3c, 0x07, 0x83, 0xf0, 0x07, 0xff, 0xc0, 0x3f, 0xf8, 0x07, 0xdf, 0xc0,
-    0x03, 0xff, 0x80, 0x1f, 0xf8, 0x03, 0xff, 0x80, 0x00, 0xff, 0x00, 0x07, 0xe0, 0x01, 0xfe, 0x00,
-    0x00, 0x3c, 0x00, 0x01, 0x80, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-const unsigned char Abs [640] = { // 80x64watertempabs
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x00,
-    0x18, 0x00, 0x00, 0x1c, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x38, 0x00, 0x00, 0x3e, 0x00, 0xff,
-    0xff, 0xff, 0xfe, 0x00, 0x7c, 0x00, 0x00, 0x7f, 0x01, 0xff, 0xf8, 0x1f, 0xff, 0x80, 0xfe, 0x00,
-    0x00, 0xff, 0x03, 0xff, 0x00, 0x01, 0xff, 0xc0, 0xff, 0x00, 0x00, 0xff, 0x07, 0xfc, 0x00, 0x00,
-    0x7f, 0xe0, 0xff, 0x00, 0x01, 0xfe, 0x0f, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0x7f, 0x80, 0x01, 0xfc,
-    0x1f, 0xe0, 0x00, 0x00, 0x07, 0xf8, 0x3f, 0x80, 0x03, 0xf8, 0x3f, 0xc0, 0x00, 0x00, 0x03, 0xfc,
-    0x1f, 0xc0, 0x03, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x1f, 0xc0, 0x07, 0xf0, 0xfe, 0x00,
-    0x00, 0x00, 0x00, 0xfe, 0x0f, 0xe0, 0x07, 0xf0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x0f, 0xe0,
-    0x0f, 0xe1, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x07, 0xf0, 0x0f, 0xe1, 0xf8, 0x00, 0x00, 0x00,
-    0x00, 0x1f, 0x87, 0xf0, 0x0f, 0xc3, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x83, 0xf8, 0x1f, 0xc3,
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc3, 0xf8, 0x1f, 0xc7, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x0f,
-    0xc3, 0xf8, 0x1f, 0x87, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc1, 0xf8, 0x1f, 0x87, 0xc0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xe1, 0xf8, 0x3f, 0x8f, 0xc0, 0x78, 0x0f, 0xf0, 0x0f, 0xe7, 0xe1, 0xfc,
-    0x3f, 0x8f, 0xc0, 0xf8, 0x0f, 0xfc, 0x1f, 0xe3, 0xe1, 0xfc, 0x3f, 0x0f, 0x80, 0xf8, 0x0e, 0x1c,
-    0x3c, 0x63, 0xf0, 0xfc, 0x3f, 0x0f, 0x80, 0xdc, 0x0e, 0x0e, 0x38, 0x03, 0xf0, 0xfc, 0x3f, 0x0f,
-    0x80, 0xdc, 0x0e, 0x0e, 0x30, 0x01, 0xf0, 0xfc, 0x3f, 0x0f, 0x81, 0xcc, 0x0e, 0x0e, 0x38, 0x01,
-    0xf0, 0xfc, 0x3f, 0x0f, 0x81, 0x8e, 0x0e, 0x1c, 0x3c, 0x01, 0xf0, 0xfe, 0x7f, 0x1f, 0x81, 0x8e,
-    0x0f, 0xf8, 0x1f, 0x01, 0xf0, 0xfe, 0x7f, 0x1f, 0x83, 0x8e, 0x0f, 0xf8, 0x0f, 0xc1, 0xf0, 0xfe,
-    0x7f, 0x1f, 0x83, 0x87, 0x0f, 0xfc, 0x07, 0xe1, 0xf0, 0xfe, 0x7f, 0x1f, 0x83, 0x87, 0x0e, 0x0e,
-    0x00, 0xf1, 0xf0, 0xfe, 0x3f, 0x0f, 0x83, 0xff, 0x0e, 0x0f, 0x00, 0x71, 0xf0, 0xfe, 0x3f, 0x0f,
-    0x87, 0xff, 0x0e, 0x0f, 0x00, 0x71, 0xf0, 0xfc, 0x3f, 0x0f, 0x87, 0x03, 0x8e, 0x0f, 0x00, 0x71,
-    0xf0, 0xfc, 0x3f, 0x0f, 0x8e, 0x03, 0x8e, 0x0e, 0x00, 0x73, 0xf0, 0xfc, 0x3f, 0x8f, 0x8e, 0x03,
-    0x8e, 0x3e, 0x39, 0xe3, 0xe0, 0xfc, 0x3f, 0x8f, 0xce, 0x03, 0xcf, 0xfc, 0x7f, 0xc3, 0xe1, 0xfc,
-    0x3f, 0x87, 0xcc, 0x01, 0x87, 0xe0, 0x1f, 0x07, 0xe1, 0xfc, 0x1f, 0x87, 0xe0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xe1, 0xf8, 0x1f, 0x87, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc1, 0xf8, 0x1f, 0xc3,
-    0xe0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc3, 0xf8, 0x1f, 0xc3, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x1f,
-    0xc3, 0xf8, 0x0f, 0xe3, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x87, 0xf0, 0x0f, 0xe1, 0xf8, 0x00,
-    0x00, 0x00, 0x00, 0x3f, 0x87, 0xf0, 0x0f, 0xe0, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x07, 0xf0,
-    0x07, 0xf0, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x0f, 0xe0, 0x07, 0xf8, 0x7f, 0x00, 0x00, 0x00,
-    0x00, 0xfe, 0x1f, 0xe0, 0x03, 0xf8, 0x7f, 0x80, 0x00, 0x00, 0x01, 0xfc, 0x1f, 0xc0, 0x03, 0xfc,
-    0x3f, 0xc0, 0x00, 0x00, 0x03, 0xf8, 0x3f, 0xc0, 0x01, 0xfc, 0x1f, 0xe0, 0x00, 0x00, 0x0f, 0xf0,
-    0x3f, 0x80, 0x01, 0xfe, 0x0f, 0xf8, 0x00, 0x00, 0x1f, 0xf0, 0x7f, 0x80, 0x00, 0xff, 0x07, 0xfe,
-    0x00, 0x00, 0x7f, 0xe0, 0xff, 0x00, 0x00, 0x7f, 0x03, 0xff, 0x80, 0x03, 0xff, 0x80, 0xfe, 0x00,
-    0x00, 0x7f, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfe, 0x00, 0x00, 0x3e, 0x00, 0x7f, 0xff, 0xff,
-    0xfe, 0x00, 0x7c, 0x00, 0x00, 0x1c, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x00, 0x38, 0x00, 0x00, 0x08,
-    0x00, 0x0f, 0xff, 0xff, 0xe0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-const unsigned char battery [768] = { // 96x6480x64watertempabsbattery
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x1f,
-    0xff, 0xfe, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00,
-    0x00, 0x03, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff,
-    0xe0, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x3f,
-    0xff, 0xfe, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00,
-    0x00, 0x03, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0,
-    0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0,
-    0x1f, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x07, 0xc0,
-    0x1f, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x07, 0xc0, 0x1f, 0x00, 0x3f, 0xfc,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0,
-    0x1f, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0,
-    0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0,
-    0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0,
-    0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0,
-    0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0,
-    0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0,
-    0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0,
-    0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-// 'istockphoto-1203724431-612x612', 88x64px96x6480x64watertempabsbatteryenginecheck
-const unsigned char enginecheck [704] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff,
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x00,
-    0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x3c, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00,
-    0x00, 0x3e, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x3e, 0x1f, 0xff, 0x80,
-    0x00, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x00, 0x3e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf8,
-    0x00, 0x00, 0x3e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x1f, 0x80, 0x3e, 0x1e, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x7f, 0xf0, 0x3e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7c, 0x7f, 0xf0, 0x3e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xf8, 0x3e, 0x1e,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xf8, 0x3e, 0x1e, 0x00, 0xe2, 0x27, 0x8e, 0x22,
-    0x00, 0x7c, 0xf8, 0xfc, 0x3e, 0x1e, 0x01, 0x12, 0x24, 0x11, 0x24, 0x00, 0x7c, 0xf8, 0x7c, 0x3e,
-    0x1e, 0x01, 0x02, 0x24, 0x10, 0x28, 0x00, 0x7f, 0xf8, 0x7c, 0x3e, 0x1e, 0x01, 0x03, 0xe7, 0x90,
-    0x38, 0x00, 0x7f, 0xf8, 0x7c, 0x3e, 0x1e, 0x01, 0x02, 0x24, 0x10, 0x24, 0x00, 0x7f, 0xf8, 0x7c,
-    0x3f, 0xfe, 0x01, 0x12, 0x24, 0x11, 0x26, 0x00, 0x7f, 0xf8, 0x7c, 0x3f, 0xfe, 0x00, 0xe2, 0x27,
-    0x8e, 0x22, 0x00, 0x7f, 0xf8, 0x7c, 0x3f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3c, 0x3f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3f, 0xfe, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3c, 0x3e, 0x1e, 0x07, 0xc8, 0x8e, 0x24, 0x4f, 0x00, 0x00, 0x00, 0x3c, 0x3e, 0x1e, 0x06,
-    0x0c, 0x91, 0x26, 0x48, 0x00, 0x00, 0x00, 0x3c, 0x3e, 0x1e, 0x06, 0x0c, 0x90, 0x26, 0x48, 0x00,
-    0x00, 0x00, 0x3c, 0x3e, 0x1e, 0x07, 0xca, 0x93, 0x25, 0x4f, 0x00, 0x00, 0x00, 0x3c, 0x3e, 0x1e,
-    0x04, 0x0b, 0x91, 0xa5, 0xc8, 0x00, 0x00, 0x00, 0x3c, 0x3e, 0x1e, 0x06, 0x09, 0x91, 0xa4, 0xc8,
-    0x00, 0x00, 0x00, 0x3c, 0x3e, 0x1e, 0x07, 0xc8, 0x8f, 0x24, 0x4f, 0x00, 0x7f, 0xf8, 0x7c, 0x3e,
-    0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf8, 0x7c, 0x3e, 0x1e, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7f, 0xf8, 0x7c, 0x3e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf8, 0x7c,
-    0x3e, 0x1f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf8, 0x7c, 0x3e, 0x1f, 0xff, 0xfc, 0x00,
-    0x00, 0x00, 0x00, 0x7c, 0xf8, 0x7c, 0x3e, 0x1f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xf8,
-    0x7c, 0x1c, 0x0f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xf8, 0x00, 0x07, 0xff, 0xff,
-    0xe0, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x7c,
-    0xff, 0xf8, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x7c, 0x7f, 0xf0, 0x00, 0x00, 0x00,
-    0x01, 0xfe, 0x00, 0x00, 0x00, 0x7c, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
-    0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff,
-    0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-
 // ============================================
 // Low-Level Display Functions
 // ============================================
 
-inline void write_command(unsigned char command)
+// The bus itself is behind displayBus (bus.h); these keep the byte-wise
+// API used by the controller setup and the helper modules.
+void write_command(unsigned char command)
+{
+    displayBus->writeCommand(command);
+}
+
+void write_data(unsigned char data)
 {
-    GPIO_PORTM_DATA_R = command;
-    GPIO_PORTL_DATA_R = 0x11;
-    GPIO_PORTL_DATA_R = 0x1F;
+    uint8_t byte = data;
+    displayBus->writeData(&byte, 1);
 }
 
-inline void write_data(unsigned char data)
+void window_set(int min_x, int min_y, int max_x, int max_y)
 {
-    GPIO_PORTM_DATA_R = data;
-    GPIO_PORTL_DATA_R = 0x15;
-    GPIO_PORTL_DATA_R = 0x1F;
+    uint8_t args[4];
+
+    args[0] = min_x >> 8;
+    args[1] = min_x;
+    args[2] = max_x >> 8;
+    args[3] = max_x;
+    displayBus->writeCommand(0x2A);
+    displayBus->writeData(args, 4);
+
+    args[0] = min_y >> 8;
+    args[1] = min_y;
+    args[2] = max_y >> 8;
+    args[3] = max_y;
+    displayBus->writeCommand(0x2B);
+    displayBus->writeData(args, 4);
 }
 
-inline void window_set(int min_x, int min_y, int max_x, int max_y)
+// Every primitive starts here, so the previous pixel stream is complete:
+// a safe point to slip urgent fast-lane jobs in before taking the bus,
+// except inside a sync group, which must run uninterrupted
+static inline void beginPrimitive(void)
 {
-    write_command(0x2A);
-    write_data(min_x >> 8);
-    write_data(min_x);
-    write_data(max_x >> 8);
-    write_data(max_x);
-    write_command(0x2B);
-    write_data(min_y >> 8);
-    write_data(min_y);
-    write_data(max_y >> 8);
-    write_data(max_y);
+    if (fastLanePending && !drawQueueInGroup)
+        FastLane_Service();
+    Bus_Begin();
 }
 
 void init_ports_display(void)
@@ -818,6 +257,13 @@ void init_ports_display(void)
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOL);
     while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOL));
     GPIOPinTypeGPIOOutput(GPIO_PORTL_BASE, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3 | GPIO_PIN_4);
+
+#if DISPLAY_PIXEL_FORMAT == PIXEL_FORMAT_565
+    // Upper data byte D15-D8
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOK);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOK));
+    GPIOPinTypeGPIOOutput(GPIO_PORTK_BASE, 0xFF);
+#endif
 }
 
 void configure_display_controller_large(void)
@@ -828,6 +274,7 @@ void configure_display_controller_large(void)
     GPIO_PORTL_DATA_R |= RST;
     SysCtlDelay(12000);
 
+    Bus_Begin();
     write_command(SOFTWARE_RESET);
     SysCtlDelay(120000);
 
@@ -884,47 +331,200 @@ void configure_display_controller_large(void)
     write_data(0x03);
 
     write_command(SET_PIXEL_DATA_FORMAT);
-    write_data(0x00);
+#if DISPLAY_PIXEL_FORMAT == PIXEL_FORMAT_565
+    write_data(0x03);   // 16-bit, 565
+#else
+    write_data(0x00);   // 8-bit, 3 x 8 bits per pixel
+#endif
 
     write_command(SET_DISPLAY_ON);
+    Bus_End();
 }
 
 // ============================================
 // Drawing Primitives
 // ============================================
 
+// ============================================
+// Pixel Patterns
+// ============================================
+// Colors are converted to their bus pattern at compile time. When every
+// transfer of a pixel carries the same value (BLACK, GREY, WHITE on the
+// 8-bit bus, every color on the 16-bit bus) the pattern collapses to one
+// transfer repeated, and the backend only has to toggle the strobe.
+
+typedef struct {
+    enum colors col;
+    uint8_t len;            // pattern bytes handed to Bus_Fill()
+    uint8_t repeats;        // pattern repeats per pixel
+    uint8_t bytes[3];
+} PixelPattern;
+
+#define R8(c)   (((c) >> 16) & 0xff)
+#define G8(c)   (((c) >> 8) & 0xff)
+#define B8(c)   ((c) & 0xff)
+
+#if DISPLAY_PIXEL_FORMAT == PIXEL_FORMAT_565
+#define PIXEL_PATTERN(c) \
+    { c, 2, 1, { (R8(c) & 0xf8) | (G8(c) >> 5), ((G8(c) & 0x1c) << 3) | (B8(c) >> 3), 0 } }
+#else
+#define SAME_BYTES(c) (R8(c) == G8(c) && G8(c) == B8(c))
+#define PIXEL_PATTERN(c) \
+    { c, SAME_BYTES(c) ? 1 : 3, SAME_BYTES(c) ? 3 : 1, { R8(c), G8(c), B8(c) } }
+#endif
+
+// Dashboard colors first: they are nearly every lookup
+static const PixelPattern palette[] = {
+    PIXEL_PATTERN(BURNT_ORANGE),
+    PIXEL_PATTERN(ORANGE),
+    PIXEL_PATTERN(BLACK),
+    PIXEL_PATTERN(WHITE),
+    PIXEL_PATTERN(GREY),
+    PIXEL_PATTERN(RED),
+    PIXEL_PATTERN(GREEN),
+    PIXEL_PATTERN(BLUE),
+    PIXEL_PATTERN(YELLOW),
+};
+
+#define PALETTE_SIZE (sizeof(palette) / sizeof(palette[0]))
+
+static const PixelPattern *pixelPattern(enum colors col)
+{
+    static PixelPattern other;
+    uint8_t i;
+
+    for (i = 0; i < PALETTE_SIZE; i++)
+        if (palette[i].col == col)
+            return &palette[i];
+
+    // Not a named color (e.g. blinky's colorarray): convert now
+    {
+        const PixelPattern p = PIXEL_PATTERN(col);
+        other = p;
+    }
+    return &other;
+}
+
+void writePixelRun(enum colors col, uint32_t count)
+{
+    const PixelPattern *p = pixelPattern(col);
+    Bus_Fill(p->bytes, p->len, count * p->repeats);
+}
+
 void drawBox(int x_min, int x_max, int y_min, int y_max, enum colors col)
 {
-    int i = 0;
+    beginPrimitive();
     window_set(x_min, y_min, x_max, y_max);
     write_command(0x2C);
-    for(i = 0; i < ((x_max - x_min) * (y_max - y_min)); i++) {
-        write_data((col >> 16) & 0xff);
-        write_data((col >> 8) & 0xff);
-        write_data((col) & 0xff);
-    }
+    writePixelRun(col, (uint32_t)((x_max - x_min) * (y_max - y_min)));
+    Bus_End();
 }
 
 void drawPixel(int x, int y, enum colors col)
 {
-    write_command(0x2A);
-    write_data(x >> 8);
-    write_data(x);
-    write_data((x + 1) >> 8);
-    write_data(x + 1);
-    write_command(0x2B);
-    write_data(y >> 8);
-    write_data(y);
-    write_data((y + 1) >> 8);
-    write_data(y + 1);
+    beginPrimitive();
+    window_set(x, y, x + 1, y + 1);
+    write_command(0x2C);
+    writePixelRun(col, 1);
+    Bus_End();
+}
+
+void drawHSpan(int x, int y, int len, enum colors col)
+{
+    beginPrimitive();
+    window_set(x, y, x + len - 1, y);
+    write_command(0x2C);
+    writePixelRun(col, (uint32_t)len);
+    Bus_End();
+}
+
+void drawVSpan(int x, int y, int len, enum colors col)
+{
+    beginPrimitive();
+    window_set(x, y, x, y + len - 1);
     write_command(0x2C);
-    write_data((col >> 16) & 0xff);
-    write_data((col >> 8) & 0xff);
-    write_data((col) & 0xff);
+    writePixelRun(col, (uint32_t)len);
+    Bus_End();
+}
+
+// ============================================
+// Span-Coalescing Rasterizer
+// ============================================
+// Line and circle walkers feed their pixels into a SpanAccumulator instead
+// of calling drawPixel(). Consecutive pixels on the same row or column are
+// merged and emitted as one window plus N pixels, so a run of N pixels
+// costs one window_set instead of N.
+
+typedef struct {
+    int16_t x, y;       // run origin (top/left pixel)
+    int16_t len;        // 0 = empty
+    uint8_t vertical;   // orientation, only meaningful once len > 1
+    enum colors col;
+} SpanAccumulator;
+
+static void spanInit(SpanAccumulator *acc, enum colors col)
+{
+    acc->len = 0;
+    acc->vertical = 0;
+    acc->col = col;
+}
+
+static void spanFlush(SpanAccumulator *acc)
+{
+    if (acc->len == 0) return;
+    if (acc->vertical)
+        drawVSpan(acc->x, acc->y, acc->len, acc->col);
+    else
+        drawHSpan(acc->x, acc->y, acc->len, acc->col);
+    acc->len = 0;
 }
 
+static void spanPlot(SpanAccumulator *acc, int16_t x, int16_t y)
+{
+    if (acc->len > 0) {
+        bool canH = (acc->len == 1 || !acc->vertical) && y == acc->y;
+        bool canV = (acc->len == 1 || acc->vertical) && x == acc->x;
+
+        if (canH && x == acc->x + acc->len) {                  // extend right
+            acc->vertical = 0;
+            acc->len++;
+            return;
+        }
+        if (canH && x == acc->x - 1) {                         // extend left
+            acc->vertical = 0;
+            acc->x = x;
+            acc->len++;
+            return;
+        }
+        if (canV && y == acc->y + acc->len) {                  // extend down
+            acc->vertical = 1;
+            acc->len++;
+            return;
+        }
+        if (canV && y == acc->y - 1) {                         // extend up
+            acc->vertical = 1;
+            acc->y = y;
+            acc->len++;
+            return;
+        }
+        if (x >= acc->x && y >= acc->y &&                      // already covered
+            (acc->vertical ? (x == acc->x && y < acc->y + acc->len)
+                           : (y == acc->y && x < acc->x + acc->len)))
+            return;
+        spanFlush(acc);
+    }
+    acc->x = x;
+    acc->y = y;
+    acc->len = 1;
+}
+
+// Thick (2 px) Bresenham line. Every step covers the pixel one ahead on
+// the major axis and the pixel one across on the minor axis; each of the
+// two pixel streams gets its own accumulator, so both collapse into long
+// runs along the major axis.
 void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, enum colors color)
 {
+    SpanAccumulator ahead, across;
     int16_t steep = abs(y1 - y0) > abs(x1 - x0);
     if (steep) {
         _swap_int16_t(x0, y0);
@@ -949,13 +549,16 @@ void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, enum colors color
         ystep = -1;
     }
 
+    spanInit(&ahead, color);
+    spanInit(&across, color);
+    COST_CHARGE((uint32_t)(dx + 1) * COST_LINE_STEP);
     for (; x0 <= x1; x0++) {
         if (steep) {
-            drawPixel(y0 + 1, x0, color);
-            drawPixel(y0, x0 + 1, color);
+            spanPlot(&ahead, y0 + 1, x0);
+            spanPlot(&across, y0, x0 + 1);
         } else {
-            drawPixel(x0 + 1, y0, color);
-            drawPixel(x0, y0 + 1, color);
+            spanPlot(&ahead, x0 + 1, y0);
+            spanPlot(&across, x0, y0 + 1);
         }
         err -= dy;
         if (err < 0) {
@@ -963,6 +566,8 @@ void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, enum colors color
             err += dx;
         }
     }
+    spanFlush(&ahead);
+    spanFlush(&across);
 }
 
 void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, enum colors color)
@@ -980,18 +585,25 @@ void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, enum colors color)
     }
 }
 
+// Midpoint circle with one accumulator per octant: near the top/bottom
+// the octant walks produce horizontal runs, near the sides vertical ones.
 void drawCircle(int16_t x0, int16_t y0, int16_t r, enum colors color)
 {
+    SpanAccumulator oct[8];
     int16_t f = 1 - r;
     int16_t ddF_x = 1;
     int16_t ddF_y = -2 * r;
     int16_t x = 0;
     int16_t y = r;
+    uint8_t i;
 
-    drawPixel(x0, y0 + r, color);
-    drawPixel(x0, y0 - r, color);
-    drawPixel(x0 + r, y0, color);
-    drawPixel(x0 - r, y0, color);
+    for (i = 0; i < 8; i++)
+        spanInit(&oct[i], color);
+
+    spanPlot(&oct[0], x0, y0 + r);
+    spanPlot(&oct[2], x0, y0 - r);
+    spanPlot(&oct[4], x0 + r, y0);
+    spanPlot(&oct[5], x0 - r, y0);
 
     while (x < y) {
         if (f >= 0) {
@@ -1003,24 +615,32 @@ void drawCircle(int16_t x0, int16_t y0, int16_t r, enum colors color)
         ddF_x += 2;
         f += ddF_x;
 
-        drawPixel(x0 + x, y0 + y, color);
-        drawPixel(x0 - x, y0 + y, color);
-        drawPixel(x0 + x, y0 - y, color);
-        drawPixel(x0 - x, y0 - y, color);
-        drawPixel(x0 + y, y0 + x, color);
-        drawPixel(x0 - y, y0 + x, color);
-        drawPixel(x0 + y, y0 - x, color);
-        drawPixel(x0 - y, y0 - x, color);
+        spanPlot(&oct[0], x0 + x, y0 + y);
+        spanPlot(&oct[1], x0 - x, y0 + y);
+        spanPlot(&oct[2], x0 + x, y0 - y);
+        spanPlot(&oct[3], x0 - x, y0 - y);
+        spanPlot(&oct[4], x0 + y, y0 + x);
+        spanPlot(&oct[5], x0 - y, y0 + x);
+        spanPlot(&oct[6], x0 + y, y0 - x);
+        spanPlot(&oct[7], x0 - y, y0 - x);
     }
+
+    for (i = 0; i < 8; i++)
+        spanFlush(&oct[i]);
 }
 
 void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, enum colors color)
 {
+    SpanAccumulator oct[8];
     int16_t f = 1 - r;
     int16_t ddF_x = 1;
     int16_t ddF_y = -2 * r;
     int16_t x = 0;
     int16_t y = r;
+    uint8_t i;
+
+    for (i = 0; i < 8; i++)
+        spanInit(&oct[i], color);
 
     while (x < y) {
         if (f >= 0) {
@@ -1032,22 +652,25 @@ void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, enu
         ddF_x += 2;
         f += ddF_x;
         if (cornername & 0x4) {
-            drawPixel(x0 + x, y0 + y, color);
-            drawPixel(x0 + y, y0 + x, color);
+            spanPlot(&oct[0], x0 + x, y0 + y);
+            spanPlot(&oct[1], x0 + y, y0 + x);
         }
         if (cornername & 0x2) {
-            drawPixel(x0 + x, y0 - y, color);
-            drawPixel(x0 + y, y0 - x, color);
+            spanPlot(&oct[2], x0 + x, y0 - y);
+            spanPlot(&oct[3], x0 + y, y0 - x);
         }
         if (cornername & 0x8) {
-            drawPixel(x0 - y, y0 + x, color);
-            drawPixel(x0 - x, y0 + y, color);
+            spanPlot(&oct[4], x0 - y, y0 + x);
+            spanPlot(&oct[5], x0 - x, y0 + y);
         }
         if (cornername & 0x1) {
-            drawPixel(x0 - y, y0 - x, color);
-            drawPixel(x0 - x, y0 - y, color);
+            spanPlot(&oct[6], x0 - y, y0 - x);
+            spanPlot(&oct[7], x0 - x, y0 - y);
         }
     }
+
+    for (i = 0; i < 8; i++)
+        spanFlush(&oct[i]);
 }
 
 // ============================================
@@ -1057,45 +680,13 @@ void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, enu
 void drawDigit16x24(int x, int y, int digit, enum colors col, enum colors bgcol)
 {
     if (digit < 0 || digit > 9) return;
-    const uint8_t *bitmap = digitBitmaps16x24[digit];
-
-    int row, colBit;
-    for (row = 0; row < 24; row++) {
-        uint8_t left = bitmap[row * 2];
-        uint8_t right = bitmap[row * 2 + 1];
-        uint16_t line = (left << 8) | right;
-
-        for (colBit = 0; colBit < 16; colBit++) {
-            if (line & (1 << (15 - colBit))) {
-                drawPixel(x + colBit, y + row, col);
-            } else {
-                drawPixel(x + colBit, y + row, bgcol);
-            }
-        }
-    }
+    drawImageRLE(x, y, &fontDigits16x24[digit], col, bgcol);
 }
 
 void drawDigit32x50(int x, int y, uint8_t digit, enum colors col, enum colors bgcol)
 {
     if (digit > 9) return;
-
-    const uint8_t *bitmap = digitBitmaps32x50[digit];
-    int row, colBit;
-    for (row = 0; row < 50; row++) {
-        uint32_t line =
-            (bitmap[row * 4 + 0] << 24) |
-            (bitmap[row * 4 + 1] << 16) |
-            (bitmap[row * 4 + 2] << 8) |
-            bitmap[row * 4 + 3];
-
-        for (colBit = 0; colBit < 32; colBit++) {
-            if (line & (1u << (31 - colBit))) {
-                drawPixel(x + colBit, y + row, col);
-            } else {
-                drawPixel(x + colBit, y + row, bgcol);
-            }
-        }
-    }
+    drawImageRLE(x, y, &fontDigits32x50[digit], col, bgcol);
 }
 
 void drawNumber16x24(int x, int y, int number, enum colors col, enum colors bgcol)
@@ -1105,7 +696,7 @@ void drawNumber16x24(int x, int y, int number, enum colors col, enum colors bgco
     int i = 0;
     while (buffer[i] != '\0') {
         int digit = buffer[i] - '0';
-        drawDigit16x24(x + i * 13, y, digit, col, bgcol);
+        DrawQueue_Image(x + i * 13, y, &fontDigits16x24[digit], col, bgcol);
         i++;
     }
 }
@@ -1114,6 +705,7 @@ uint32_t pow_table[] = { 1, 10, 100, 1000, 10000 };
 
 uint8_t ExtractDigit(int V, int P)
 {
+    COST_CHARGE(COST_TABLE_LOOKUP + 2 * COST_INT_DIV);
     return V / pow_table[P] % 10;
 }
 
@@ -1124,13 +716,14 @@ void drawNumber32x50(int x, int y, uint64_t number, uint8_t digAmount, int8_t dp
     for (i = 0; i < digAmount; i++) {
         if (i > dp) offset = 12;
         SevenSegDigitNum[i][id] = ExtractDigit(number, digAmount - 1 - i);
+        // Only commit the digit cache once the glyph is actually queued
         if (oldSevenSegDigitNum[i][id] != SevenSegDigitNum[i][id]) {
-            drawDigit32x50(offset + x + i * 30, y, SevenSegDigitNum[i][id], col, bgcol);
-            oldSevenSegDigitNum[i][id] = SevenSegDigitNum[i][id];
+            if (DrawQueue_Image(offset + x + i * 30, y, &fontDigits32x50[SevenSegDigitNum[i][id]], col, bgcol))
+                oldSevenSegDigitNum[i][id] = SevenSegDigitNum[i][id];
         }
 
         if (i == dp) {
-            drawBox(32 + x + i * 30, 8 + 32 + x + i * 30, y + 45, y + 8 + 45, col);
+            DrawQueue_Rect(32 + x + i * 30, 8 + 32 + x + i * 30, y + 45, y + 8 + 45, col);
         }
     }
 }
@@ -1151,12 +744,30 @@ void drawBitmap1BPP(int x0, int y0, const unsigned char *bmp, int width, int hei
     }
 }
 
+void drawImageRLE(int x0, int y0, const RleImage *img, enum colors colorFG, enum colors colorBG)
+{
+    const uint8_t *span = img->spans;
+    const uint8_t *end = span + img->spanCount;
+    bool foreground = false;
+
+    // One window for the whole image, then stream the runs straight to the bus
+    beginPrimitive();
+    window_set(x0, y0, x0 + img->width - 1, y0 + img->height - 1);
+    write_command(0x2C);
+    while (span < end) {
+        writePixelRun(foreground ? colorFG : colorBG, *span++);
+        foreground = !foreground;
+    }
+    Bus_End();
+}
+
 // ============================================
 // Utility Functions
 // ============================================
 
 int16_t MAP(uint32_t au32_IN, uint32_t au32_INmin, uint32_t au32_INmax, uint32_t au32_OUTmin, uint32_t au32_OUTmax)
 {
+    COST_CHARGE(COST_INT_DIV);
     return ((((au32_IN - au32_INmin) * (au32_OUTmax - au32_OUTmin)) / (au32_INmax - au32_INmin)) + au32_OUTmin);
 }
 
@@ -1172,59 +783,15 @@ int16_t ABS(int16_t value)
 
 void InitSpeedometerDisplay(void)
 {
-    int x, y, j, l;
-    enum colors color = BURNT_ORANGE;
-
-    // Fill background
-    window_set(0, 0, MAX_X - 1, MAX_Y - 1);
-    write_command(0x2C);
-    for (x = 0; x <= (MAX_X) - 1; x++)
-        for (y = 0; y <= (MAX_Y) - 1; y++) {
-            write_data((color >> 16) & 0xff);
-            write_data((color >> 8) & 0xff);
-            write_data((color) & 0xff);
-        }
-
-    // Draw UI elements
-    drawBox(210, 790, 195, 205, ORANGE);
-    drawBox(520, 530, 195, 479, ORANGE);
-    drawBox(270, 280, 195, 479, ORANGE);
-    drawBox(280, 520, 330, 333, ORANGE);
-
-    for (l = 0; l < 10; l++) {
-        drawLine(l, 425 + l, 210 + l, 195 + l, ORANGE);
-    }
-
-    // Draw bitmaps for labels
-    drawBitmap1BPP(730, 445, kmh, 64, 24, ORANGE, BURNT_ORANGE);
-    drawBitmap1BPP(295, 340, ODO, 96, 36, ORANGE, BURNT_ORANGE);
-    drawBitmap1BPP(460, 410, km, 48, 24, ORANGE, BURNT_ORANGE);
-    drawBitmap1BPP(290, 220, engspd, 176, 36, ORANGE, BURNT_ORANGE);
-    drawBitmap1BPP(455, 290, rpm, 64, 24, ORANGE, BURNT_ORANGE);
-
-    // Draw analog speedometer scale
-    for (j = 8; j >= 0; j--) {
-        drawNumber16x24(645 + (sin_lut[MAP(j, 0, 8, 90, 630)] * 0.45) + (cos_lut[MAP(j, 0, 8, 90, 630)] * 0.028),
-                        328 + (cos_lut[MAP(j, 0, 8, 90, 630)] * 0.45) + (sin_lut[MAP(j, 0, 8, 90, 630)] * 0.012),
-                        (8 - j) * 50, ORANGE, BURNT_ORANGE);
-
-        drawCircle(660, 335, 65 - j, ORANGE);
-
-        uint8_t k = 0;
-        for (k = 0; k < 3; k++) {
-            drawLine(660 + (sin_lut[MAP(j, 0, 8, 90, 630) + k] * 0.25),
-                     335 + (cos_lut[MAP(j, 0, 8, 90, 630) + k] * 0.25),
-                     660 + (sin_lut[MAP(j, 0, 8, 90, 630) + k] * 0.28),
-                     335 + (cos_lut[MAP(j, 0, 8, 90, 630) + k] * 0.28),
-                     ORANGE);
-        }
-    }
+    int j;
 
-    // Initialize displays with zeros
-    drawNumber32x50(600, 425, 999, 3, -1, 0, ORANGE, BURNT_ORANGE);
-    drawNumber32x50(278, 270, 99999, 5, -1, 1, ORANGE, BURNT_ORANGE);
-    drawNumber32x50(290, 390, 99999, 5, 2, 2, ORANGE, BURNT_ORANGE);
+    // Static layer: background, frame, labels and the analog scale are
+    // pre-rendered by tools/gen_dashboard.py and streamed as one window
+    drawImageRLE(0, 0, &imgDashboard, ORANGE, BURNT_ORANGE);
 
+    // Invalidate the digit change-detection cache so every field is
+    // painted exactly once with zeros
+    memset(oldSevenSegDigitNum, 0xFF, sizeof(oldSevenSegDigitNum));
     drawNumber32x50(600, 425, 0, 3, -1, 0, ORANGE, BURNT_ORANGE);
     drawNumber32x50(278, 270, 0, 5, -1, 1, ORANGE, BURNT_ORANGE);
     drawNumber32x50(290, 390, 0, 5, 2, 2, ORANGE, BURNT_ORANGE);
@@ -1242,16 +809,18 @@ void InitSpeedometerDisplay(void)
     }
 
     // Initialize warning lights to OFF state (black icons visible)
-    drawBitmap1BPP(185, 250, watertemp, 64, 64, BLACK, BURNT_ORANGE);     // Water temp OFF
-    drawBitmap1BPP(176, 330, Abs, 80, 64, BLACK, BURNT_ORANGE);           // ABS OFF
-    drawBitmap1BPP(170, 410, battery, 96, 64, BLACK, BURNT_ORANGE);       // Battery OFF
-    drawBitmap1BPP(60, 410, enginecheck, 88, 64, BLACK, BURNT_ORANGE);    // Check engine OFF
+    drawImageRLE(185, 250, &imgWaterTemp, BLACK, BURNT_ORANGE);     // Water temp OFF
+    drawImageRLE(176, 330, &imgAbs, BLACK, BURNT_ORANGE);           // ABS OFF
+    drawImageRLE(170, 410, &imgBattery, BLACK, BURNT_ORANGE);       // Battery OFF
+    drawImageRLE(60, 410, &imgEngineCheck, BLACK, BURNT_ORANGE);    // Check engine OFF
 }
 
 void UpdateSpeedBars(uint32_t rpm, uint8_t *shadowArray, uint8_t *pictureArray, uint8_t startUp)
 {
     uint32_t analogRPM;
     uint8_t drawSeg;
+    uint8_t changed = 0;
+    int yTop = MAX_Y, yBottom = 0;
     int j;
 
     // Map RPM to bar graph segments (clamp at 20k max)
@@ -1265,23 +834,38 @@ void UpdateSpeedBars(uint32_t rpm, uint8_t *shadowArray, uint8_t *pictureArray,
     else
         analogRPM = MAP(rpm_clamped, 5000, 20000, 20, 110);
 
+    // First pass: which bars change, and which rows they cover
     for (j = 0; j < 110; j++) {
-        int xPos = (j * 7) + 20;
-        int yPos = j * 8;
-
         if (j > analogRPM)
             drawSeg = 0;
         else if (j <= analogRPM)
             drawSeg = 1;
         shadowArray[j] = drawSeg;
 
+        if (shadowArray[j] != pictureArray[j]) {
+            int top = (j < 20) ? 15 + (20 * 8) - j * 8 : 15;
+            changed++;
+            if (top < yTop) yTop = top;
+            if (top + 150 > yBottom) yBottom = top + 150;
+        }
+    }
+
+    // Repaint the changed bars between two scan passes (the startup
+    // frame interleaves labels, and nothing is moving yet)
+    if (changed && !startUp)
+        DrawQueue_Sync(yTop, yBottom, TEAR_FILL_CYCLES(changed * 5 * 150), changed);
+
+    for (j = 0; j < 110; j++) {
+        int xPos = (j * 7) + 20;
+        int yPos = j * 8;
+
+        drawSeg = shadowArray[j];
+
         if (j < 20) {
             if (shadowArray[j] != pictureArray[j]) {
-                pictureArray[j] = shadowArray[j];
-                if (drawSeg)
-                    drawBox(xPos, xPos + 5, 15 + (20 * 8) - yPos, 150 + 15 + (20 * 8) - yPos, ORANGE);
-                else
-                    drawBox(xPos, xPos + 5, 15 + (20 * 8) - yPos, 150 + 15 + (20 * 8) - yPos, BLACK);
+                if (DrawQueue_Rect(xPos, xPos + 5, 15 + (20 * 8) - yPos, 150 + 15 + (20 * 8) - yPos,
+                                   drawSeg ? ORANGE : BLACK))
+                    pictureArray[j] = shadowArray[j];
             }
             if ((j * 25) % 20 == 0) {
                 if (startUp)
@@ -1289,11 +873,8 @@ void UpdateSpeedBars(uint32_t rpm, uint8_t *shadowArray, uint8_t *pictureArray,
             }
         } else {
             if (shadowArray[j] != pictureArray[j]) {
-                pictureArray[j] = shadowArray[j];
-                if (drawSeg)
-                    drawBox(xPos, xPos + 5, 15, 150 + 15, ORANGE);
-                else
-                    drawBox(xPos, xPos + 5, 15, 150 + 15, BLACK);
+                if (DrawQueue_Rect(xPos, xPos + 5, 15, 150 + 15, drawSeg ? ORANGE : BLACK))
+                    pictureArray[j] = shadowArray[j];
             }
             if (((j - 20) * 10) % 200 == 0) {
                 if (startUp)
@@ -1311,31 +892,60 @@ void UpdateRPMDisplay(uint32_t rpm)
 
 void UpdateKMHDisplay(uint32_t kmh)
 {
-    uint8_t k;
+    int16_t seg[NEEDLE_THICK][8];
+    int yTop = MAX_Y, yBottom = 0;
+    uint32_t points = 0;
+    uint8_t k, i;
+    bool queued = true;
 
     // Update digital KMH display
     drawNumber32x50(600, 425, kmh, 3, -1, 0, ORANGE, BURNT_ORANGE);
 
-    // Update analog speedometer needle
+    if (oldDigitalKMH == kmh)
+        return;
+
+    // Analog speedometer needle: new and old segment per thickness step
     for (k = 0; k < NEEDLE_THICK; k++) {
-        int16_t x0 = (int16_t)sin_lut[MAP(ABS(399 - kmh), 0, 400, 90, 630) + k] * 0.30;
-        int16_t x1 = (int16_t)sin_lut[MAP(ABS(399 - kmh), 0, 400, 90, 630) + k] * 0.37;
-        int16_t y0 = (int16_t)cos_lut[MAP(ABS(399 - kmh), 0, 400, 90, 630) + k] * 0.3;
-        int16_t y1 = (int16_t)cos_lut[MAP(ABS(399 - kmh), 0, 400, 90, 630) + k] * 0.37;
-
-        int16_t x0old = (int16_t)sin_lut[MAP(ABS(399 - oldDigitalKMH), 0, 400, 90, 630) + k] * 0.3;
-        int16_t x1old = (int16_t)sin_lut[MAP(ABS(399 - oldDigitalKMH), 0, 400, 90, 630) + k] * 0.37;
-        int16_t y0old = (int16_t)cos_lut[MAP(ABS(399 - oldDigitalKMH), 0, 400, 90, 630) + k] * 0.3;
-        int16_t y1old = (int16_t)cos_lut[MAP(ABS(399 - oldDigitalKMH), 0, 400, 90, 630) + k] * 0.37;
-
-        if (oldDigitalKMH != kmh) {
-            // Draw new needle position
-            drawLine(660 + x0, 335 + y0, 660 + x1, 335 + y1, ORANGE);
-            // Erase old needle position
-            drawLine(660 + x0old, 335 + y0old, 660 + x1old, 335 + y1old, BURNT_ORANGE);
+        // The 0.30 / 0.37 scales are double: int -> double, multiply and
+        // back are soft-float calls on the M4F
+        COST_CHARGE(8 * (COST_TABLE_LOOKUP + 3 * COST_DOUBLE_OP));
+        seg[k][0] = 660 + (int16_t)(sin_lut[MAP(ABS(399 - kmh), 0, 400, 90, 630) + k] * 0.30);
+        seg[k][1] = 335 + (int16_t)(cos_lut[MAP(ABS(399 - kmh), 0, 400, 90, 630) + k] * 0.3);
+        seg[k][2] = 660 + (int16_t)(sin_lut[MAP(ABS(399 - kmh), 0, 400, 90, 630) + k] * 0.37);
+        seg[k][3] = 335 + (int16_t)(cos_lut[MAP(ABS(399 - kmh), 0, 400, 90, 630) + k] * 0.37);
+
+        seg[k][4] = 660 + (int16_t)(sin_lut[MAP(ABS(399 - oldDigitalKMH), 0, 400, 90, 630) + k] * 0.3);
+        seg[k][5] = 335 + (int16_t)(cos_lut[MAP(ABS(399 - oldDigitalKMH), 0, 400, 90, 630) + k] * 0.3);
+        seg[k][6] = 660 + (int16_t)(sin_lut[MAP(ABS(399 - oldDigitalKMH), 0, 400, 90, 630) + k] * 0.37);
+        seg[k][7] = 335 + (int16_t)(cos_lut[MAP(ABS(399 - oldDigitalKMH), 0, 400, 90, 630) + k] * 0.37);
+
+        for (i = 0; i < 8; i += 4) {
+            int dx = ABS(seg[k][i + 2] - seg[k][i]);
+            int dy = ABS(seg[k][i + 3] - seg[k][i + 1]);
+            points += ((dx > dy) ? dx : dy) + 1;
+            if (seg[k][i + 1] < yTop) yTop = seg[k][i + 1];
+            if (seg[k][i + 3] < yTop) yTop = seg[k][i + 3];
+            if (seg[k][i + 1] > yBottom) yBottom = seg[k][i + 1];
+            if (seg[k][i + 3] > yBottom) yBottom = seg[k][i + 3];
         }
     }
-    oldDigitalKMH = kmh;
+
+    // All or nothing: a half-queued move would leave a needle at a
+    // position the next update does not know to erase
+    if (DrawQueue_Free() < 1 + 2 * NEEDLE_THICK)
+        return;
+
+    // Erase the old position, then draw the new one, between two scan
+    // passes. Erasing last would cut into the new needle where the two
+    // positions overlap.
+    queued &= DrawQueue_Sync(yTop, yBottom, TEAR_PLOT_CYCLES(points), 2 * NEEDLE_THICK);
+    for (k = 0; k < NEEDLE_THICK; k++)
+        queued &= DrawQueue_Line(seg[k][4], seg[k][5], seg[k][6], seg[k][7], BURNT_ORANGE);
+    for (k = 0; k < NEEDLE_THICK; k++)
+        queued &= DrawQueue_Line(seg[k][0], seg[k][1], seg[k][2], seg[k][3], ORANGE);
+    // Cannot fail after the free-space check; kept as a guard
+    if (queued)
+        oldDigitalKMH = kmh;
 }
 
 void UpdateODODisplay(uint64_t odo_decimeters)
@@ -1344,42 +954,37 @@ void UpdateODODisplay(uint64_t odo_decimeters)
     drawNumber32x50(290, 390, odo_decimeters, 5, 2, 2, ORANGE, BURNT_ORANGE);
 }
 
-void UpdateDirectionGear(uint8_t isForward)
+uint8_t UpdateDirectionGear(uint8_t isForward)
 {
     if (isForward) {
-        drawBitmap1BPP(636, 305, GearLetterD, 48, 60, ORANGE, BURNT_ORANGE);
+        return DrawQueue_Image(636, 305, &imgGearLetterD, ORANGE, BURNT_ORANGE);
     } else {
-        drawBitmap1BPP(636, 305, GearLetterR, 48, 60, ORANGE, BURNT_ORANGE);
+        return DrawQueue_Image(636, 305, &imgGearLetterR, ORANGE, BURNT_ORANGE);
     }
 }
 
 void UpdateWarningLights(uint8_t errorCode)
 {
     static uint8_t oldErrorCode = 0x00;
-
-    // Water temp warning
-    if ((errorCode & 0x01) && !(oldErrorCode & 0x01))
-        drawBitmap1BPP(185, 250, watertemp, 64, 64, ORANGE, BURNT_ORANGE);
-    else if (!(errorCode & 0x01) && (oldErrorCode & 0x01))
-        drawBitmap1BPP(185, 250, watertemp, 64, 64, BLACK, BURNT_ORANGE);
-
-    // ABS warning
-    if ((errorCode & 0x02) && !(oldErrorCode & 0x02))
-        drawBitmap1BPP(176, 330, Abs, 80, 64, ORANGE, BURNT_ORANGE);
-    else if (!(errorCode & 0x02) && (oldErrorCode & 0x02))
-        drawBitmap1BPP(176, 330, Abs, 80, 64, BLACK, BURNT_ORANGE);
-
-    // Battery warning
-    if ((errorCode & 0x04) && !(oldErrorCode & 0x04))
-        drawBitmap1BPP(170, 410, battery, 96, 64, ORANGE, BURNT_ORANGE);
-    else if (!(errorCode & 0x04) && (oldErrorCode & 0x04))
-        drawBitmap1BPP(170, 410, battery, 96, 64, BLACK, BURNT_ORANGE);
-
-    // Engine check warning
-    if ((errorCode & 0x08) && !(oldErrorCode & 0x08))
-        drawBitmap1BPP(60, 410, enginecheck, 88, 64, ORANGE, BURNT_ORANGE);
-    else if (!(errorCode & 0x08) && (oldErrorCode & 0x08))
-        drawBitmap1BPP(60, 410, enginecheck, 88, 64, BLACK, BURNT_ORANGE);
-
-    oldErrorCode = errorCode;
+    static const struct {
+        int16_t x, y;
+        const RleImage *img;
+    } lights[4] = {
+        { 185, 250, &imgWaterTemp },    // 0x01 Water temp warning
+        { 176, 330, &imgAbs },          // 0x02 ABS warning
+        { 170, 410, &imgBattery },      // 0x04 Battery warning
+        { 60,  410, &imgEngineCheck },  // 0x08 Engine check warning
+    };
+    uint8_t i;
+
+    // A light's bit in oldErrorCode only follows errorCode once its
+    // repaint has been queued, so a full queue retries next update
+    for (i = 0; i < 4; i++) {
+        uint8_t bit = 1 << i;
+        if ((errorCode ^ oldErrorCode) & bit) {
+            if (DrawQueue_Image(lights[i].x, lights[i].y, lights[i].img,
+                                (errorCode & bit) ? ORANGE : BLACK, BURNT_ORANGE))
+                oldErrorCode ^= bit;
+        }
+    }
 }
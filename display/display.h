@@ -27,6 +27,21 @@
 #define SET_PIXEL_DATA_FORMAT 0xF0
 #define SET_DISPLAY_ON      0x29
 #define SET_DISPLAY_OFF     0x28
+#define SET_SCROLL_AREA     0x33
+#define SET_SCROLL_START    0x37
+#define GET_SCANLINE        0x45
+
+// ======================
+// Pixel transfer format (SET_PIXEL_DATA_FORMAT)
+// PIXEL_FORMAT_888: 8-bit bus, 3 transfers per pixel (this board)
+// PIXEL_FORMAT_565: 16-bit bus, D15-D8 on Port K, 1 transfer per pixel
+// ======================
+#define PIXEL_FORMAT_888    0
+#define PIXEL_FORMAT_565    1
+
+#ifndef DISPLAY_PIXEL_FORMAT
+#define DISPLAY_PIXEL_FORMAT PIXEL_FORMAT_888
+#endif
 
 // ======================
 // Utility macro
@@ -48,6 +63,18 @@ enum colors {
     BURNT_ORANGE  = 0x00662D15
 };
 
+// ======================
+// Run-length encoded 1bpp image (generated by tools/img2rle.py)
+// spans[] holds alternating background/foreground run lengths in
+// row-major order, starting with background.
+// ======================
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint16_t spanCount;
+    const uint8_t *spans;
+} RleImage;
+
 // ======================
 // External variables
 // ======================
@@ -66,8 +93,11 @@ void window_set(int min_x, int min_y, int max_x, int max_y);
 // ======================
 // Drawing primitives
 // ======================
+void writePixelRun(enum colors col, uint32_t count);
 void drawBox(int x_min, int x_max, int y_min, int y_max, enum colors col);
 void drawPixel(int x, int y, enum colors col);
+void drawHSpan(int x, int y, int len, enum colors col);
+void drawVSpan(int x, int y, int len, enum colors col);
 void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, enum colors color);
 void drawCircle(int16_t x0, int16_t y0, int16_t r, enum colors color);
 void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, enum colors color);
@@ -84,6 +114,7 @@ void drawNumber32x50(int x, int y, uint64_t number, uint8_t digAmount, int8_t dp
 // Bitmap rendering
 // ======================
 void drawBitmap1BPP(int x0, int y0, const unsigned char *bmp, int width, int height, enum colors colorFG, enum colors colorBG);
+void drawImageRLE(int x0, int y0, const RleImage *img, enum colors colorFG, enum colors colorBG);
 
 // ======================
 // High-level display functions
@@ -93,7 +124,7 @@ void UpdateSpeedBars(uint32_t rpm, uint8_t *shadowArray, uint8_t *pictureArray,
 void UpdateRPMDisplay(uint32_t rpm);
 void UpdateKMHDisplay(uint32_t kmh);
 void UpdateODODisplay(uint64_t odo_decimeters);
-void UpdateDirectionGear(uint8_t isForward);
+uint8_t UpdateDirectionGear(uint8_t isForward);     // 0 if not queued (retry)
 void UpdateWarningLights(uint8_t errorCode);
 
 // ======================
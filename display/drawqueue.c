@@ -0,0 +1,435 @@
+/**
+ * drawqueue.c - Asynchronous display command queue
+ *
+ * Single producer (main loop) / single consumer (drain ISR) ring buffer.
+ * head is only written by the producer, tail only by the consumer, so no
+ * locking is needed beyond the volatile indices.
+ */
+
+#include "drawqueue.h"
+#include "fastlane.h"
+#include "tearsync.h"
+#include "bus.h"
+#include "profile/trace.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <inc/hw_memmap.h>
+#include <inc/hw_ints.h>
+#include <driverlib/sysctl.h>
+#include <driverlib/interrupt.h>
+#include <driverlib/timer.h>
+
+#define DRAWQUEUE_TIMER_BASE    TIMER0_BASE
+#define DRAWQUEUE_TIMER_INT     INT_TIMER0A
+#define DRAWQUEUE_PRIORITY      0xE0            /* lowest */
+
+/* Cost charged against the burst budget for non-pixel-count commands */
+#define DRAWQUEUE_CALL_COST     64
+
+typedef enum {
+    CMD_RECT,
+    CMD_IMAGE,
+    CMD_LINE,
+    CMD_CALL,
+    CMD_SYNC
+} DrawCmdType;
+
+typedef struct {
+    uint8_t type;
+    bool group;             // queued as part of the sync group before it
+    int16_t x0, y0;         // rect: x_min/y_min, line: start, image: origin
+    int16_t x1, y1;         // rect: x_max/y_max, line: end
+    enum colors fg, bg;
+    const RleImage *img;    // image
+    DrawCallback fn;        // call
+    uint32_t arg;           // call argument, sync: write cycles
+} DrawCmd;
+
+static DrawCmd queue[DRAWQUEUE_SIZE];
+static volatile uint16_t head = 0;      // next free slot (producer)
+static volatile uint16_t tail = 0;      // next command to run (consumer)
+static uint16_t highWater = 0;
+static uint32_t overflows = 0;
+static bool started = false;
+static volatile bool draining = false;  // drain timer running
+static uint32_t syncHoldTicks = 0;
+
+/* Sync group: commands of the last marker still to be pushed (producer);
+ * running the group without budget, ticks held so far (consumer) */
+static uint8_t  groupToPush = 0;
+bool drawQueueInGroup = false;
+static uint16_t groupHolds = 0;
+
+/* Progress of the command at tail when it spans several bursts */
+static bool     inProgress = false;
+static uint32_t rectDone;               // rect: pixels written so far
+static uint16_t imgRow;                 // image: rows written so far
+static const uint8_t *imgSpan;          // image: next span byte
+static uint16_t imgRemaining;           // image: pixels left in current run
+static bool     imgForeground;          // image: colour of current run
+
+static uint32_t runCommand(const DrawCmd *cmd, uint32_t budget);
+
+void DrawQueueTimerIntHandler(void);
+
+// ============================================
+// Producers
+// ============================================
+
+static bool push(const DrawCmd *cmd)
+{
+    uint16_t depth;
+    bool group = groupToPush > 0;
+
+    // A command rejected below is simply missing from its group
+    if (group)
+        groupToPush--;
+
+    // Not started yet: draw synchronously (boot)
+    if (!started) {
+        runCommand(cmd, 0xFFFFFFFF);
+        return true;
+    }
+
+    depth = (uint16_t)(head - tail);
+    if (depth >= DRAWQUEUE_SIZE) {
+        overflows++;
+        TRACE_INSTANT_EVENT(TRACE_QUEUE_FULL, depth);
+        return false;
+    }
+
+    queue[head & (DRAWQUEUE_SIZE - 1)] = *cmd;
+    queue[head & (DRAWQUEUE_SIZE - 1)].group = group;
+    head++;
+    DrawQueue_Wake();
+
+    if (depth + 1 > highWater)
+        highWater = depth + 1;
+    return true;
+}
+
+bool DrawQueue_Rect(int x_min, int x_max, int y_min, int y_max, enum colors col)
+{
+    DrawCmd cmd;
+    cmd.type = CMD_RECT;
+    cmd.x0 = x_min;
+    cmd.x1 = x_max;
+    cmd.y0 = y_min;
+    cmd.y1 = y_max;
+    cmd.fg = col;
+    return push(&cmd);
+}
+
+bool DrawQueue_Image(int x, int y, const RleImage *img, enum colors colorFG, enum colors colorBG)
+{
+    DrawCmd cmd;
+    cmd.type = CMD_IMAGE;
+    cmd.x0 = x;
+    cmd.y0 = y;
+    cmd.fg = colorFG;
+    cmd.bg = colorBG;
+    cmd.img = img;
+    return push(&cmd);
+}
+
+bool DrawQueue_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, enum colors col)
+{
+    DrawCmd cmd;
+    cmd.type = CMD_LINE;
+    cmd.x0 = x0;
+    cmd.y0 = y0;
+    cmd.x1 = x1;
+    cmd.y1 = y1;
+    cmd.fg = col;
+    return push(&cmd);
+}
+
+bool DrawQueue_Call(DrawCallback fn, uint32_t arg)
+{
+    DrawCmd cmd;
+    cmd.type = CMD_CALL;
+    cmd.fn = fn;
+    cmd.arg = arg;
+    return push(&cmd);
+}
+
+bool DrawQueue_Sync(int y_min, int y_max, uint32_t cycles, uint8_t commands)
+{
+    DrawCmd cmd;
+
+    // Too big to dodge the scan, or to run in one tick: let the group
+    // drain at the normal pace
+    if (cycles > DRAWQUEUE_SYNC_MAX_CYCLES || !TearSync_Fits(y_min, y_max, cycles))
+        return true;
+    if (!started) {
+        TearSync_WaitRegion(y_min, y_max, cycles);
+        return true;
+    }
+    cmd.type = CMD_SYNC;
+    cmd.y0 = y_min;
+    cmd.y1 = y_max;
+    cmd.arg = cycles;
+    groupToPush = 0;
+    if (!push(&cmd))
+        return false;
+    groupToPush = commands;
+    return true;
+}
+
+// ============================================
+// Consumer
+// ============================================
+
+// drawBox() semantics: (x_max - x_min) * (y_max - y_min) pixels streamed
+// into the inclusive window. Bursts end on whole window rows so the rest
+// can be resumed with a fresh window starting at the next row.
+static uint32_t runRect(const DrawCmd *cmd, uint32_t budget)
+{
+    uint32_t rowLen = cmd->x1 - cmd->x0 + 1;
+    uint32_t total = (uint32_t)((cmd->x1 - cmd->x0) * (cmd->y1 - cmd->y0));
+    uint32_t chunk;
+
+    if (!inProgress) {
+        rectDone = 0;
+        inProgress = true;
+    }
+
+    chunk = total - rectDone;
+    if (chunk > budget) {
+        chunk = (budget / rowLen) * rowLen;
+        if (chunk == 0) chunk = rowLen;
+        if (chunk > total - rectDone) chunk = total - rectDone;
+    }
+
+    Bus_Begin();
+    window_set(cmd->x0, cmd->y0 + rectDone / rowLen, cmd->x1, cmd->y1);
+    write_command(0x2C);
+    writePixelRun(cmd->fg, chunk);
+    Bus_End();
+
+    rectDone += chunk;
+    if (rectDone >= total)
+        inProgress = false;
+    return chunk;
+}
+
+static void imageNextRun(const RleImage *img)
+{
+    const uint8_t *end = img->spans + img->spanCount;
+    while (imgRemaining == 0 && imgSpan < end) {
+        imgRemaining = *imgSpan++;
+        imgForeground = !imgForeground;
+    }
+}
+
+static uint32_t runImage(const DrawCmd *cmd, uint32_t budget)
+{
+    const RleImage *img = cmd->img;
+    uint32_t rows;
+    uint32_t need, written;
+
+    if (!inProgress) {
+        imgRow = 0;
+        imgSpan = img->spans;
+        imgRemaining = 0;
+        imgForeground = true;       // toggled to background by the first run
+        inProgress = true;
+    }
+
+    rows = budget / img->width;
+    if (rows == 0) rows = 1;
+    if (rows > (uint32_t)(img->height - imgRow)) rows = img->height - imgRow;
+
+    Bus_Begin();
+    window_set(cmd->x0, cmd->y0 + imgRow, cmd->x0 + img->width - 1, cmd->y0 + img->height - 1);
+    write_command(0x2C);
+
+    need = rows * img->width;
+    written = need;
+    while (need > 0) {
+        uint32_t n;
+        imageNextRun(img);
+        if (imgRemaining == 0) break;           // truncated table
+        n = (imgRemaining < need) ? imgRemaining : need;
+        writePixelRun(imgForeground ? cmd->fg : cmd->bg, n);
+        imgRemaining -= n;
+        need -= n;
+    }
+    Bus_End();
+
+    imgRow += rows;
+    if (imgRow >= img->height)
+        inProgress = false;
+    return written;
+}
+
+static uint32_t runCommand(const DrawCmd *cmd, uint32_t budget)
+{
+    uint32_t written = 0;
+
+    switch (cmd->type) {
+    case CMD_RECT:
+        written = runRect(cmd, budget);
+        break;
+    case CMD_IMAGE:
+        written = runImage(cmd, budget);
+        break;
+    case CMD_LINE:
+        drawLine(cmd->x0, cmd->y0, cmd->x1, cmd->y1, cmd->fg);
+        written = DRAWQUEUE_CALL_COST;
+        break;
+    case CMD_CALL:
+        cmd->fn(cmd->arg);
+        written = DRAWQUEUE_CALL_COST;
+        break;
+    }
+    return written;
+}
+
+uint32_t DrawQueue_Drain(uint32_t pixelBudget)
+{
+    uint32_t written = 0;
+
+    while ((written < pixelBudget || drawQueueInGroup) && tail != head) {
+        const DrawCmd *cmd = &queue[tail & (DRAWQUEUE_SIZE - 1)];
+
+        if (cmd->type == CMD_SYNC) {
+            drawQueueInGroup = false;
+            // Scan about to pass the group's rows: retry next tick
+            if (groupHolds < DRAWQUEUE_SYNC_MAX_HOLDS &&
+                !TearSync_RegionSafe(cmd->y0, cmd->y1, cmd->arg)) {
+                groupHolds++;
+                syncHoldTicks++;
+                TRACE_INSTANT_EVENT(TRACE_SYNC_HOLD, groupHolds);
+                break;
+            }
+            groupHolds = 0;
+            drawQueueInGroup = true;
+            tail++;
+            continue;
+        }
+        // The group is what was queued with it, not what was asked for
+        if (!cmd->group)
+            drawQueueInGroup = false;
+
+        // Commands are the bus boundaries inside a burst; a sync group
+        // runs uninterrupted so it stays ahead of the scan
+        if (fastLanePending && !drawQueueInGroup)
+            FastLane_Service();
+
+        written += runCommand(cmd, drawQueueInGroup ? 0xFFFFFFFF : pixelBudget - written);
+        if (!inProgress)
+            tail++;
+
+        // An asynchronous backend owns the bus now; give the CPU back
+        // until the next tick (a sync group keeps going; begin() waits)
+        if (Bus_Busy() && !drawQueueInGroup)
+            break;
+    }
+    return written;
+}
+
+// ============================================
+// Drain interrupt
+// ============================================
+
+void DrawQueueTimerIntHandler(void)
+{
+    uint32_t written = 0;
+
+    TimerIntClear(DRAWQUEUE_TIMER_BASE, TIMER_TIMA_TIMEOUT);
+
+    // Nothing to do: stop ticking until the next push or fast-lane post,
+    // so an idle display does not wake the core a thousand times a second.
+    // Masked against a post from a higher-priority interrupt in between.
+    if (tail == head && !fastLanePending) {
+        bool wasMasked = IntMasterDisable();
+        if (tail == head && !fastLanePending) {
+            TimerDisable(DRAWQUEUE_TIMER_BASE, TIMER_A);
+            draining = false;
+        }
+        if (!wasMasked)
+            IntMasterEnable();
+        return;
+    }
+    TRACE_BEGIN_EVENT(TRACE_DRAIN);
+
+    // Between bursts the bus is idle: urgent jobs go first
+    if (fastLanePending)
+        FastLane_Service();
+
+    // Previous burst still streaming: skip this slice
+    if (!Bus_Busy())
+        written = DrawQueue_Drain(DRAWQUEUE_BURST_PIXELS);
+
+    TRACE_END_EVENT(TRACE_DRAIN, written);
+}
+
+void DrawQueue_Start(uint32_t sysClock)
+{
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER0)) {}
+
+    TimerConfigure(DRAWQUEUE_TIMER_BASE, TIMER_CFG_PERIODIC);
+    TimerLoadSet(DRAWQUEUE_TIMER_BASE, TIMER_A, (sysClock / DRAWQUEUE_TICK_HZ) - 1);
+
+    IntRegister(DRAWQUEUE_TIMER_INT, DrawQueueTimerIntHandler);
+    IntPrioritySet(DRAWQUEUE_TIMER_INT, DRAWQUEUE_PRIORITY);
+    TimerIntEnable(DRAWQUEUE_TIMER_BASE, TIMER_TIMA_TIMEOUT);
+
+    started = true;
+    draining = true;
+
+    IntEnable(DRAWQUEUE_TIMER_INT);
+    TimerEnable(DRAWQUEUE_TIMER_BASE, TIMER_A);
+}
+
+void DrawQueue_Wake(void)
+{
+    bool wasMasked;
+
+    if (!started)
+        return;
+    if (!draining) {
+        wasMasked = IntMasterDisable();
+        if (!draining) {
+            draining = true;
+            TimerEnable(DRAWQUEUE_TIMER_BASE, TIMER_A);
+        }
+        if (!wasMasked)
+            IntMasterEnable();
+    }
+    // Fast-lane jobs go now, not at the next tick: the core may be asleep
+    // until then
+    if (fastLanePending)
+        IntPendSet(DRAWQUEUE_TIMER_INT);
+}
+
+// ============================================
+// Metrics
+// ============================================
+
+uint16_t DrawQueue_Depth(void)
+{
+    return (uint16_t)(head - tail);
+}
+
+uint16_t DrawQueue_Free(void)
+{
+    return started ? DRAWQUEUE_SIZE - (uint16_t)(head - tail) : DRAWQUEUE_SIZE;
+}
+
+uint16_t DrawQueue_HighWater(void)
+{
+    return highWater;
+}
+
+uint32_t DrawQueue_Overflows(void)
+{
+    return overflows;
+}
+
+uint32_t DrawQueue_SyncHolds(void)
+{
+    return syncHoldTicks;
+}
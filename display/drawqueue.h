@@ -0,0 +1,98 @@
+/**
+ * drawqueue.h - Asynchronous display command queue
+ *
+ * The main loop produces draw commands (rect fill, RLE image/glyph, line,
+ * deferred callback) into a bounded ring buffer and never touches the
+ * bus itself. A lowest-priority timer interrupt drains the queue in
+ * bursts of at most DRAWQUEUE_BURST_PIXELS pixels per tick, so the main
+ * loop (button handling, sensor computation) runs between bursts instead
+ * of waiting behind a long repaint.
+ *
+ * Large rects and images are split at row boundaries and resumed on the
+ * next tick. Until DrawQueue_Start() is called every command is executed
+ * synchronously, which is what boot-time drawing relies on.
+ *
+ * A sync marker (DrawQueue_Sync) holds the commands after it until the
+ * refresh scan is clear of their rows, then runs them back to back
+ * regardless of the burst budget so they land between two scan passes.
+ *
+ * Once the queue is started, the drain interrupt is the only bus user:
+ * do not call the direct draw primitives from the main loop any more.
+ */
+
+#ifndef DRAWQUEUE_H
+#define DRAWQUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "display.h"
+
+#define DRAWQUEUE_SIZE          128     /* entries, power of two */
+#define DRAWQUEUE_TICK_HZ       1000    /* drain interrupt rate */
+#define DRAWQUEUE_BURST_PIXELS  1024    /* max pixels written per tick */
+#define DRAWQUEUE_SYNC_MAX_HOLDS 80     /* ticks (two frames) before a held
+                                           sync group is drawn anyway */
+#define DRAWQUEUE_SYNC_MAX_CYCLES 100000 /* longest group run in one tick */
+
+/* Deferred draw callback, executed in drain context */
+typedef void (*DrawCallback)(uint32_t arg);
+
+/* Drain is running a sync group: primitives hold off the fast lane */
+extern bool drawQueueInGroup;
+
+/**
+ * Start draining from the timer interrupt (Timer0A, lowest priority)
+ */
+void DrawQueue_Start(uint32_t sysClock);
+
+/**
+ * Restart the drain interrupt, which stops itself while the queue is
+ * empty and no fast-lane job is pending. The producers below call it;
+ * FastLane_Post() too. Safe from any context, a no-op before
+ * DrawQueue_Start().
+ */
+void DrawQueue_Wake(void);
+
+/**
+ * Producers - return false (and count an overflow) if the queue is full.
+ * Callers with change-detection state must not commit it on failure.
+ */
+bool DrawQueue_Rect(int x_min, int x_max, int y_min, int y_max, enum colors col);
+bool DrawQueue_Image(int x, int y, const RleImage *img, enum colors colorFG, enum colors colorBG);
+bool DrawQueue_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, enum colors col);
+bool DrawQueue_Call(DrawCallback fn, uint32_t arg);
+
+/**
+ * Tear-free group: the next `commands` commands write memory rows
+ * y_min..y_max and take about `cycles` CPU cycles (TEAR_FILL_CYCLES /
+ * TEAR_PLOT_CYCLES). They are held until the scan allows it. Before
+ * DrawQueue_Start() this spins on the scanline instead. Groups that can
+ * never fit between two scan passes, or would hold the drain interrupt
+ * longer than DRAWQUEUE_SYNC_MAX_CYCLES, are not synchronised.
+ * Only the commands actually queued belong to the group: one rejected
+ * because the queue is full is missing from it, and a rejected marker
+ * (false) leaves the commands unsynchronised.
+ */
+bool DrawQueue_Sync(int y_min, int y_max, uint32_t cycles, uint8_t commands);
+
+/**
+ * Execute queued commands until pixelBudget pixels have been written or
+ * the queue is empty. Returns the number of pixels written.
+ */
+uint32_t DrawQueue_Drain(uint32_t pixelBudget);
+
+/**
+ * Free entries. Only the drain frees entries, so a producer that sees
+ * n free can push n commands without an overflow.
+ */
+uint16_t DrawQueue_Free(void);
+
+/**
+ * Metrics: current depth, high-water mark and rejected commands
+ */
+uint16_t DrawQueue_Depth(void);
+uint16_t DrawQueue_HighWater(void);
+uint32_t DrawQueue_Overflows(void);
+uint32_t DrawQueue_SyncHolds(void);     // ticks a sync group waited
+
+#endif /* DRAWQUEUE_H */
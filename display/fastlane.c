@@ -0,0 +1,98 @@
+/**
+ * fastlane.c - High-priority render jobs ahead of the normal frame
+ */
+
+#include "fastlane.h"
+#include "drawqueue.h"
+#include "display.h"
+#include "bus.h"
+#include "profile/cycles.h"
+#include "profile/trace.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <driverlib/interrupt.h>
+
+volatile uint8_t fastLanePending = 0;
+
+static volatile uint32_t postCycles = 0;   // timestamp of the oldest pending job
+static uint32_t lastLatency = 0;
+static uint32_t maxLatency = 0;
+
+void FastLane_Post(uint8_t jobs)
+{
+    bool wasDisabled = IntMasterDisable();
+
+    // ON and OFF cancel each other; only the latest state matters
+    if (jobs & FASTLANE_SHIFT_ON)
+        fastLanePending &= ~FASTLANE_SHIFT_OFF;
+    if (jobs & FASTLANE_SHIFT_OFF)
+        fastLanePending &= ~FASTLANE_SHIFT_ON;
+
+    if (fastLanePending == 0)
+        postCycles = Cycles_Now();
+    fastLanePending |= jobs;
+
+    if (!wasDisabled) IntMasterEnable();
+
+    // The drain interrupt services the fast lane; it may be stopped
+    DrawQueue_Wake();
+}
+
+static void drawShiftLight(enum colors col)
+{
+    Bus_Begin();
+    window_set(SHIFT_LIGHT_X, SHIFT_LIGHT_Y,
+               SHIFT_LIGHT_X + SHIFT_LIGHT_SIZE - 1, SHIFT_LIGHT_Y + SHIFT_LIGHT_SIZE - 1);
+    write_command(0x2C);
+    writePixelRun(col, SHIFT_LIGHT_SIZE * SHIFT_LIGHT_SIZE);
+    Bus_End();
+}
+
+void FastLane_Service(void)
+{
+    static bool running = false;
+    uint8_t jobs;
+    uint32_t posted;
+    bool wasDisabled;
+
+    if (running) return;
+    running = true;
+
+    while (fastLanePending) {
+        // Fetch and clear atomically against FastLane_Post() in the ISRs
+        wasDisabled = IntMasterDisable();
+        jobs = fastLanePending;
+        posted = postCycles;
+        fastLanePending = 0;
+        if (!wasDisabled) IntMasterEnable();
+
+        TRACE_BEGIN_EVENT(TRACE_FASTLANE);
+        if (jobs & FASTLANE_SHIFT_ON)
+            drawShiftLight(ORANGE);
+        else if (jobs & FASTLANE_SHIFT_OFF)
+            drawShiftLight(BURNT_ORANGE);
+        TRACE_END_EVENT(TRACE_FASTLANE, jobs);
+
+        lastLatency = Cycles_Now() - posted;
+        if (lastLatency > maxLatency)
+            maxLatency = lastLatency;
+    }
+
+    running = false;
+}
+
+uint32_t FastLane_GetLastLatency(void)
+{
+    return lastLatency;
+}
+
+uint32_t FastLane_GetMaxLatency(void)
+{
+    return maxLatency;
+}
+
+void FastLane_ResetStats(void)
+{
+    lastLatency = 0;
+    maxLatency = 0;
+}
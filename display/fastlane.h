@@ -0,0 +1,48 @@
+/**
+ * fastlane.h - High-priority render jobs ahead of the normal frame
+ *
+ * Urgent cues (shift light) are posted from interrupt context and drawn
+ * at the next point where the display bus is between primitives: the
+ * start of any drawing primitive or between draw queue commands. They never wait
+ * for the 10 Hz display tick, and they never interrupt a half-written
+ * pixel stream.
+ */
+
+#ifndef FASTLANE_H
+#define FASTLANE_H
+
+#include <stdint.h>
+
+/* Job bits for FastLane_Post() */
+#define FASTLANE_SHIFT_ON   0x01
+#define FASTLANE_SHIFT_OFF  0x02
+
+/* Shift light lamp position (free area right of the 'engspd' label) */
+#define SHIFT_LIGHT_X       476
+#define SHIFT_LIGHT_Y       216
+#define SHIFT_LIGHT_SIZE    36
+
+/* Pending job mask, tested inline at every bus boundary */
+extern volatile uint8_t fastLanePending;
+
+/**
+ * Queue a job. Safe from any interrupt; timestamps the request with the
+ * DWT cycle counter for the edge-to-pixel latency metric.
+ */
+void FastLane_Post(uint8_t jobs);
+
+/**
+ * Draw all pending jobs. Must only be called while no pixel stream is in
+ * progress; re-entrant calls are ignored.
+ */
+void FastLane_Service(void);
+
+/**
+ * Edge-to-pixel latency of fast-lane jobs in CPU cycles: the most recent
+ * job and the worst case since boot (or since the last reset).
+ */
+uint32_t FastLane_GetLastLatency(void);
+uint32_t FastLane_GetMaxLatency(void);
+void FastLane_ResetStats(void);
+
+#endif /* FASTLANE_H */
@@ -0,0 +1,120 @@
+/**
+ * stripchart.c - Hardware-scrolled strip chart for the SSD1963
+ *
+ * Frame memory layout of the band (rows top .. top+height-1) is a ring
+ * buffer: `head` is the next row to write. After writing row `head` the
+ * scroll start is set to the row after it, which puts the oldest sample
+ * at the top of the band and the new one at the bottom.
+ */
+
+#include "stripchart.h"
+#include "drawqueue.h"
+#include "bus.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+static uint16_t chartTop, chartHeight, chartLeft, chartWidth;
+static uint32_t chartFullScale;
+static int16_t  chartMarkCol;       // column inside the chart, -1 = none
+static enum colors chartTraceCol, chartMarkColor, chartBgCol;
+static uint16_t head;
+static bool chartActive = false;
+
+static void setScrollArea(uint16_t tfa, uint16_t vsa, uint16_t bfa)
+{
+    write_command(SET_SCROLL_AREA);
+    write_data(tfa >> 8);
+    write_data(tfa);
+    write_data(vsa >> 8);
+    write_data(vsa);
+    write_data(bfa >> 8);
+    write_data(bfa);
+}
+
+static void setScrollStart(uint16_t line)
+{
+    write_command(SET_SCROLL_START);
+    write_data(line >> 8);
+    write_data(line);
+}
+
+void StripChart_Init(uint16_t top, uint16_t height, uint16_t left, uint16_t width,
+                     uint32_t fullScale, uint32_t markValue,
+                     enum colors traceCol, enum colors markCol, enum colors bgCol)
+{
+    if (height < 2 || top + height > MAX_Y || left + width > MAX_X || fullScale == 0)
+        return;
+
+    chartTop = top;
+    chartHeight = height;
+    chartLeft = left;
+    chartWidth = width;
+    chartFullScale = fullScale;
+    chartTraceCol = traceCol;
+    chartMarkColor = markCol;
+    chartBgCol = bgCol;
+    chartMarkCol = (markValue > 0 && markValue < fullScale)
+                 ? (int16_t)((uint64_t)markValue * width / fullScale) : -1;
+    head = 0;
+
+    // Empty chart: background with the marker column on every row
+    Bus_Begin();
+    window_set(left, top, left + width - 1, top + height - 1);
+    write_command(0x2C);
+    writePixelRun(bgCol, (uint32_t)width * height);
+    Bus_End();
+    if (chartMarkCol >= 0)
+        drawVSpan(left + chartMarkCol, top, height, markCol);
+
+    Bus_Begin();
+    setScrollArea(top, height, MAX_Y - top - height);
+    setScrollStart(top);
+    Bus_End();
+    chartActive = true;
+}
+
+// Runs in draw queue context, the only place the ring head advances
+static void drawRow(uint32_t value)
+{
+    uint16_t fill;
+    uint16_t row;
+
+    if (value > chartFullScale) value = chartFullScale;
+    fill = (uint16_t)((uint64_t)value * chartWidth / chartFullScale);
+
+    // One row: trace bar [0, fill), background after, marker column on top
+    row = chartTop + head;
+    Bus_Begin();
+    window_set(chartLeft, row, chartLeft + chartWidth - 1, row);
+    write_command(0x2C);
+    if (chartMarkCol >= 0 && chartMarkCol >= fill) {
+        writePixelRun(chartTraceCol, fill);
+        writePixelRun(chartBgCol, chartMarkCol - fill);
+        writePixelRun(chartMarkColor, 1);
+        writePixelRun(chartBgCol, chartWidth - chartMarkCol - 1);
+    } else {
+        writePixelRun(chartTraceCol, fill);
+        writePixelRun(chartBgCol, chartWidth - fill);
+    }
+
+    head++;
+    if (head >= chartHeight) head = 0;
+    setScrollStart(chartTop + head);
+    Bus_End();
+}
+
+void StripChart_Push(uint32_t value)
+{
+    if (!chartActive) return;
+    DrawQueue_Call(drawRow, value);
+}
+
+void StripChart_Disable(void)
+{
+    if (!chartActive) return;
+    Bus_Begin();
+    setScrollArea(0, MAX_Y, 0);
+    setScrollStart(0);
+    Bus_End();
+    chartActive = false;
+}
@@ -0,0 +1,53 @@
+/**
+ * stripchart.h - Hardware-scrolled strip chart (SSD1963 vertical scroll)
+ *
+ * The chart owns a band of full-width frame-memory rows configured as the
+ * controller's vertical scroll area. Time runs vertically: each sample is
+ * one new row (newest at the bottom) and the controller's scroll start is
+ * advanced, so pushing a sample costs one window of `width` pixels plus
+ * a 2-byte SET_SCROLL_START instead of a chart redraw.
+ *
+ * The scroll area always spans the full 800 px row. Anything drawn in the
+ * band outside the chart's columns must be constant per column (e.g.
+ * plain background) or it will visibly scroll with the chart.
+ *
+ * Rows are frame-memory rows, like every other draw call. The mapping
+ * assumes a frame-buffer-relative scroll area, as the SSD1963 datasheet
+ * defines it: TFA/VSA/BFA and the scroll start count frame-memory lines,
+ * and the vertical flip of SET_ADRESS_MODE (tearsync.h) is applied on
+ * output, after scrolling. So TFA = top, VSA = height, BFA = the rest,
+ * and the band scrolls in place with the newest sample at its bottom in
+ * the dashboard's coordinates; in scan order the flip refreshes that row
+ * first (scanline VPS + MAX_Y - top - height). Not yet confirmed on the
+ * panel; tools/stripchart_check.c checks the emitted commands and the
+ * ring wrap against this model.
+ */
+
+#ifndef STRIPCHART_H
+#define STRIPCHART_H
+
+#include <stdint.h>
+#include "display.h"
+
+/**
+ * Configure the scroll area and clear the chart band
+ * top/height:  frame-memory rows owned by the chart (height >= 2)
+ * left/width:  columns used for the trace inside the band
+ * fullScale:   value mapped to the right edge (e.g. 20000 RPM)
+ * markValue:   value drawn as a fixed marker column (0 = none)
+ */
+void StripChart_Init(uint16_t top, uint16_t height, uint16_t left, uint16_t width,
+                     uint32_t fullScale, uint32_t markValue,
+                     enum colors traceCol, enum colors markCol, enum colors bgCol);
+
+/**
+ * Append one sample: queues one row and a scroll of the band by one line
+ */
+void StripChart_Push(uint32_t value);
+
+/**
+ * Restore a zero scroll area (whole screen fixed) and stop using the band
+ */
+void StripChart_Disable(void);
+
+#endif /* STRIPCHART_H */
@@ -0,0 +1,100 @@
+/**
+ * tearsync.c - Tear-free updates by racing the SSD1963 refresh scan
+ */
+
+#include "tearsync.h"
+#include "bus.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+static uint32_t checks = 0;
+static uint32_t holds = 0;
+
+uint16_t TearSync_Scanline(void)
+{
+    uint8_t raw[2];
+
+    Bus_Begin();
+    write_command(GET_SCANLINE);
+    displayBus->readData(raw, 2);
+    Bus_End();
+    return (uint16_t)(((raw[0] << 8) | raw[1]) % TEAR_VT);
+}
+
+// Memory row -> scanline it is shown on
+static int rowToScanline(int y)
+{
+#if TEAR_FLIPPED
+    return TEAR_VPS + (MAX_Y - 1 - y);
+#else
+    return TEAR_VPS + y;
+#endif
+}
+
+// Lines the scan advances while the region is written, plus margin
+static int leadLines(uint32_t cycles)
+{
+    return (int)((cycles + TEAR_LINE_CYCLES - 1) / TEAR_LINE_CYCLES) + TEAR_MARGIN_LINES;
+}
+
+bool TearSync_Fits(int y_min, int y_max, uint32_t cycles)
+{
+    int height = (y_max > y_min) ? y_max - y_min + 1 : y_min - y_max + 1;
+    return height + leadLines(cycles) < TEAR_VT;
+}
+
+bool TearSync_Unsafe(uint16_t scanline, int y_min, int y_max, uint32_t cycles)
+{
+    int a = rowToScanline(y_min), b = rowToScanline(y_max);
+    int first = (a < b) ? a : b;
+    int last = (a < b) ? b : a;
+    int lead = leadLines(cycles);
+    int ahead;
+
+    if (!TearSync_Fits(y_min, y_max, cycles))
+        return false;
+
+    // Inside the region now, or reaching it before the write is done
+    if (scanline >= first && scanline <= last)
+        return true;
+    ahead = (first - scanline + TEAR_VT) % TEAR_VT;
+    return ahead <= lead;
+}
+
+bool TearSync_RegionSafe(int y_min, int y_max, uint32_t cycles)
+{
+    bool unsafe = TearSync_Unsafe(TearSync_Scanline(), y_min, y_max, cycles);
+
+    checks++;
+    if (unsafe)
+        holds++;
+    return !unsafe;
+}
+
+void TearSync_WaitRegion(int y_min, int y_max, uint32_t cycles)
+{
+    uint16_t last = TEAR_VT, stuck = 0;
+
+    checks++;
+    if (!TearSync_Unsafe(TearSync_Scanline(), y_min, y_max, cycles))
+        return;
+    holds++;
+    // A controller that does not answer reads returns a constant line
+    while (stuck < TEAR_STUCK_POLLS) {
+        uint16_t line = TearSync_Scanline();
+        if (!TearSync_Unsafe(line, y_min, y_max, cycles))
+            return;
+        stuck = (line == last) ? stuck + 1 : 0;
+        last = line;
+    }
+}
+
+uint32_t TearSync_Checks(void)
+{
+    return checks;
+}
+
+uint32_t TearSync_Holds(void)
+{
+    return holds;
+}
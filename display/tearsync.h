@@ -0,0 +1,82 @@
+/**
+ * tearsync.h - Tear-free updates by racing the SSD1963 refresh scan
+ *
+ * The panel is refreshed from controller memory one line at a time. A
+ * moving element (needle, bar graph) rewritten while the scan passes
+ * through it shows half old, half new for one frame. The TE output is not
+ * wired on this board, so the scan position is polled with GET_SCANLINE
+ * over the bus instead: a region is only written when the scan will not
+ * reach it before the write is done.
+ *
+ * Timing, from configure_display_controller():
+ *   PLL 10 MHz * 37 / 3 = 123.3 MHz, PCLK = PLL * 0x170A4 / 2^20 = 11.1 MHz
+ *   HT  = 0x035E + 1 = 863 PCLK  -> 77.8 us = 9330 CPU cycles per line
+ *   VT  = 0x01FE + 1 = 511 lines -> 39.7 ms (25.2 Hz) per frame
+ *   VPS = 0x000C: the first visible line follows 12 lines of blanking
+ * SET_ADRESS_MODE 0x03 flips the panel vertically, so memory row y is
+ * shown on scanline VPS + (MAX_Y - 1 - y).
+ */
+
+#ifndef TEARSYNC_H
+#define TEARSYNC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "display.h"
+#include "profile/costmodel.h"
+
+#define TEAR_VT                 511     /* scanlines per frame */
+#define TEAR_VPS                12      /* first visible scanline */
+#define TEAR_LINE_CYCLES        9330    /* CPU cycles per scanline */
+#define TEAR_FLIPPED            1       /* SET_ADRESS_MODE vertical flip */
+
+/* Lines kept between the scan and a region on top of the write time
+ * (scanline read latency, interrupts during the write) */
+#define TEAR_MARGIN_LINES       2
+
+/* Identical scanline reads after which a wait gives up (a read takes
+ * well under a line, so a live scan changes every few dozen polls) */
+#define TEAR_STUCK_POLLS        4096
+
+/* Bus cost estimates used by producers to size their write windows
+ * (profile/costmodel.h) */
+#define TEAR_FILL_CYCLES(px)    ((uint32_t)(px) * COST_BITBANG_PIXEL)   /* writePixelRun */
+#define TEAR_PLOT_CYCLES(px)    ((uint32_t)(px) * 180)  /* drawLine, per point */
+
+/**
+ * Current refresh scanline (0 .. TEAR_VT - 1), read over the display bus
+ * in its own transaction: call between primitives only.
+ */
+uint16_t TearSync_Scanline(void);
+
+/**
+ * Can writing memory rows y_min..y_max for `cycles` CPU cycles fit
+ * between two passes of the scan at all?
+ */
+bool TearSync_Fits(int y_min, int y_max, uint32_t cycles);
+
+/**
+ * Pure check: with the scan at `scanline`, is writing memory rows
+ * y_min..y_max for `cycles` CPU cycles liable to tear? Regions that do
+ * not fit (TearSync_Fits) are reported safe.
+ */
+bool TearSync_Unsafe(uint16_t scanline, int y_min, int y_max, uint32_t cycles);
+
+/**
+ * One scanline read + TearSync_Unsafe(). Counts checks and holds.
+ */
+bool TearSync_RegionSafe(int y_min, int y_max, uint32_t cycles);
+
+/**
+ * Spin until the region is safe (synchronous drawing), or until the
+ * scanline stops moving
+ */
+void TearSync_WaitRegion(int y_min, int y_max, uint32_t cycles);
+
+/**
+ * Metrics: region checks and checks that had to hold the write
+ */
+uint32_t TearSync_Checks(void);
+uint32_t TearSync_Holds(void);
+
+#endif /* TEARSYNC_H */
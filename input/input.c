@@ -0,0 +1,206 @@
+/**
+ * input.c - Debounced push buttons with press gestures
+ */
+
+#include "input.h"
+#include "sched/sched.h"
+#include "profile/trace.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <inc/hw_memmap.h>
+#include <inc/hw_ints.h>
+#include <driverlib/sysctl.h>
+#include <driverlib/gpio.h>
+#include <driverlib/interrupt.h>
+
+#define MS_TO_TICKS(ms)         ((uint32_t)(ms) * SCHED_TICK_HZ / 1000)
+#define TICKS_TO_MS(t)          (((t) * 1000 + SCHED_TICK_HZ - 1) / SCHED_TICK_HZ)
+
+/* Gesture states */
+enum {
+    STATE_IDLE,                 // released
+    STATE_DOWN,                 // first press, long-press window open
+    STATE_UP,                   // short press released, double window open
+    STATE_HELD                  // pressed, gesture reported: wait for release
+};
+
+static InputButton buttons[INPUT_MAX_BUTTONS];
+static uint8_t buttonCount;
+static uint8_t inputTask = SCHED_NONE;
+
+// ============================================
+// Edge interrupt
+// ============================================
+
+// Mask each pin that moved until the input task has sampled it settled,
+// INPUT_DEBOUNCE_MS from now
+void InputGpioIntHandler(void)
+{
+    uint32_t settle = Sched_Now() + MS_TO_TICKS(INPUT_DEBOUNCE_MS);
+    bool moved = false;
+    uint8_t i;
+
+    for (i = 0; i < buttonCount; i++) {
+        InputButton *b = &buttons[i];
+        if (GPIOIntStatus(b->port, true) & b->pin) {
+            GPIOIntDisable(b->port, b->pin);
+            GPIOIntClear(b->port, b->pin);
+            b->settle = settle;
+            b->masked = 1;
+            TRACE_INSTANT_EVENT(TRACE_BUTTON_IRQ, i);
+            moved = true;
+        }
+    }
+    if (moved)
+        Sched_PostAfter(inputTask, INPUT_DEBOUNCE_MS);
+}
+
+// ============================================
+// Gestures (input task)
+// ============================================
+
+static void emit(uint8_t id, InputEvent event)
+{
+    InputButton *b = &buttons[id];
+
+    b->events[event]++;
+    if (b->handler)
+        b->handler(id, event);
+}
+
+static void edge(uint8_t id, uint32_t now)
+{
+    InputButton *b = &buttons[id];
+
+    b->since = now;
+    if (b->pressed) {
+        emit(id, INPUT_PRESS);
+        if (b->state == STATE_UP) {
+            emit(id, INPUT_DOUBLE);
+            b->state = STATE_HELD;
+        } else {
+            b->state = STATE_DOWN;
+        }
+    } else {
+        emit(id, INPUT_RELEASE);
+        b->state = (b->state == STATE_DOWN) ? STATE_UP : STATE_IDLE;
+    }
+}
+
+// Ticks until the open window closes, 0 if none is open
+static uint32_t timeout(uint8_t id, uint32_t now)
+{
+    InputButton *b = &buttons[id];
+    uint32_t window, held;
+
+    if (b->state == STATE_DOWN)
+        window = MS_TO_TICKS(INPUT_LONG_MS);
+    else if (b->state == STATE_UP)
+        window = MS_TO_TICKS(INPUT_DOUBLE_MS);
+    else
+        return 0;
+
+    held = now - b->since;
+    if (held < window)
+        return window - held;
+
+    if (b->state == STATE_DOWN) {
+        emit(id, INPUT_LONG);
+        b->state = STATE_HELD;
+    } else {
+        emit(id, INPUT_CLICK);
+        b->state = STATE_IDLE;
+    }
+    return 0;
+}
+
+static void runInput(void)
+{
+    uint32_t now = Sched_Now();
+    uint32_t next = 0;
+    uint8_t i;
+
+    for (i = 0; i < buttonCount; i++) {
+        InputButton *b = &buttons[i];
+        uint8_t pressed;
+        uint32_t left;
+
+        // Only a pin whose debounce window has ended: another button or
+        // a gesture timeout may have released the task early
+        if (b->masked) {
+            int32_t wait = (int32_t)(b->settle - now);
+            if (wait > 0) {
+                if (next == 0 || (uint32_t)wait < next)
+                    next = (uint32_t)wait;
+            } else {
+                // Unmask first: an edge after this point posts the task again
+                b->masked = 0;
+                GPIOIntClear(b->port, b->pin);
+                GPIOIntEnable(b->port, b->pin);
+                pressed = (GPIOPinRead(b->port, b->pin) & b->pin) ? 0 : 1;
+
+                if (pressed != b->pressed) {
+                    b->pressed = pressed;
+                    edge(i, now);
+                }
+            }
+        }
+        left = timeout(i, now);
+        if (left && (next == 0 || left < next))
+            next = left;
+    }
+    if (next)
+        Sched_PostAfter(inputTask, TICKS_TO_MS(next));
+}
+
+// ============================================
+// Setup
+// ============================================
+
+void Input_Init(uint8_t priority)
+{
+    inputTask = Sched_AddEvent("input", runInput, INPUT_DEADLINE_MS, priority);
+}
+
+uint8_t Input_AddButton(const char *name, uint32_t periph, uint32_t port, uint8_t pin,
+                        uint32_t irq, InputHandler handler)
+{
+    InputButton *b;
+    uint8_t id;
+
+    if (buttonCount == INPUT_MAX_BUTTONS || inputTask == SCHED_NONE)
+        return INPUT_NONE;
+    id = buttonCount;
+    b = &buttons[id];
+    b->name = name;
+    b->port = port;
+    b->pin = pin;
+    b->handler = handler;
+    b->state = STATE_IDLE;
+    b->pressed = 0;
+    b->masked = 0;
+    b->settle = 0;
+
+    SysCtlPeripheralEnable(periph);
+    while(!SysCtlPeripheralReady(periph)) {}
+
+    /* Button connects to ground when pressed */
+    GPIOPinTypeGPIOInput(port, pin);
+    GPIOPadConfigSet(port, pin, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
+    GPIOIntTypeSet(port, pin, GPIO_BOTH_EDGES);
+    GPIOIntClear(port, pin);
+
+    /* In the table before the first edge can reach the handler */
+    buttonCount++;
+    GPIOIntEnable(port, pin);
+    IntRegister(irq, InputGpioIntHandler);
+    IntEnable(irq);
+
+    return id;
+}
+
+const InputButton *Input_GetButton(uint8_t id)
+{
+    return id < buttonCount ? &buttons[id] : NULL;
+}
@@ -0,0 +1,85 @@
+/**
+ * input.h - Debounced push buttons with press gestures
+ *
+ * Each button is an active-low GPIO input with the internal pull-up and
+ * an interrupt on both edges. The edge interrupt masks the pin, notes
+ * when its debounce window ends and asks the scheduler for the input
+ * task INPUT_DEBOUNCE_MS later. The task unmasks and samples only the
+ * buttons whose window has ended, then runs the gesture state machine;
+ * whatever released it, a pin still bouncing stays masked. Long-press
+ * and double-press windows are timed the same way (Sched_PostAfter()
+ * keeps the earliest pending release; each run posts the next window
+ * still open), so nothing polls and nothing blocks: between gestures
+ * the buttons cost no CPU at all.
+ *
+ * Events, delivered to the button's handler from the input task:
+ *
+ *   PRESS, RELEASE  every debounced edge
+ *   LONG            held for INPUT_LONG_MS (no CLICK or DOUBLE follows)
+ *   DOUBLE          second press within INPUT_DOUBLE_MS of a short press
+ *   CLICK           short press with no second one in that window
+ *
+ * CLICK waits out the double-press window; a button that never needs
+ * DOUBLE can act on RELEASE instead.
+ */
+
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define INPUT_MAX_BUTTONS       4
+#define INPUT_NONE              0xFF    /* Input_AddButton() table full */
+
+#define INPUT_DEBOUNCE_MS       20      /* contact bounce settles within */
+#define INPUT_LONG_MS           1000
+#define INPUT_DOUBLE_MS         300     /* release to second press */
+#define INPUT_DEADLINE_MS       20      /* input task, after its release */
+
+typedef enum {
+    INPUT_PRESS,
+    INPUT_RELEASE,
+    INPUT_CLICK,
+    INPUT_DOUBLE,
+    INPUT_LONG,
+    INPUT_EVENT_COUNT
+} InputEvent;
+
+/* Called from the input task (main loop context) */
+typedef void (*InputHandler)(uint8_t button, InputEvent event);
+
+typedef struct {
+    const char *name;
+    uint32_t port;
+    uint8_t pin;
+    InputHandler handler;
+
+    uint8_t state;              // gesture state (input.c)
+    uint8_t pressed;            // debounced level
+    volatile uint8_t masked;    // pin masked by the edge interrupt, bouncing
+    volatile uint32_t settle;   // tick its debounce window ends
+    uint32_t since;             // tick of the last debounced edge
+    uint32_t events[INPUT_EVENT_COUNT];
+} InputButton;
+
+/**
+ * Add the input task to the scheduler at `priority`. Call once, before
+ * Sched_Start() and the first Input_AddButton().
+ */
+void Input_Init(uint8_t priority);
+
+/**
+ * Configure `pin` of `port` (clock `periph`, NVIC line `irq`) as a
+ * button. Buttons may share a port. Returns the button id passed to the
+ * handler, or INPUT_NONE.
+ */
+uint8_t Input_AddButton(const char *name, uint32_t periph, uint32_t port, uint8_t pin,
+                        uint32_t irq, InputHandler handler);
+
+/**
+ * Button table entry for statistics, NULL past the last button
+ */
+const InputButton *Input_GetButton(uint8_t id);
+
+#endif /* INPUT_H */
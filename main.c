@@ -9,9 +9,19 @@
 #include <stdio.h>
 #include <string.h>
 #include "display/display.h"
+#include "display/stripchart.h"
+#include "display/fastlane.h"
+#include "display/drawqueue.h"
+#include "display/busdma.h"
+#include "display/bus.h"
 #include <driverlib/sysctl.h>
 #include <stdbool.h>
 #include "Sensor/Sensor.h"
+#include "profile/cycles.h"
+#include "profile/trace.h"
+#include "profile/costcal.h"
+#include "sched/sched.h"
+#include "input/input.h"
 #include <driverlib/timer.h>
 #include <inc/hw_memmap.h>
 #include <inc/hw_ints.h>
@@ -19,22 +29,67 @@
 #include <driverlib/gpio.h>
 #include <driverlib/pin_map.h>
 
-#define DISPLAY_TIMER_BASE   TIMER1_BASE
-#define DISPLAY_TIMER_INT    INT_TIMER1A
+/* Host simulator (sim/): charge point and loop statistics every pass */
+#ifdef HOST_BUILD
+#include "sim/sim.h"
+#else
+#define MAIN_LOOP_HOOK()
+#endif
+
+/*
+ * Optional live RPM strip chart using the SSD1963 hardware scroll area.
+ * Default band: the free rows above the bar graph. Off by default until
+ * the scroll direction has been checked against SET_ADRESS_MODE flipping
+ * on the panel.
+ */
+#define RPM_STRIPCHART_ENABLE        0
+#define RPM_STRIPCHART_TOP           0
+#define RPM_STRIPCHART_HEIGHT        14
+#define RPM_STRIPCHART_SAMPLE_MS     100    /* one sample (scrolled row) every N ms */
+
+/*
+ * Optional edges-per-revolution calibration of the motor encoder from
+ * boot (Sensor/calib.h): once the motor has turned a few revolutions the
+ * proposal replaces motorEncoder.edgesPerRev. Off by default: a rotor
+ * with near-identical pole pairs is proposed one pole pair per
+ * revolution, so enable it for a new rotor and check the RPM.
+ */
+#define MOTOR_AUTO_CALIBRATE         0
 
-/* Volatile variables for display update */
-volatile uint8_t displayUpdate = 0;
+/*
+ * Scheduler tasks (sched/sched.h): period, deadline in ms, priority
+ * (0 runs first). Every display task starts one period in, as the 10 Hz
+ * display timer used to. The sensor task processes at SENSOR_PROCESS_HZ
+ * whatever the display does; the display tasks sample its snapshot.
+ */
+#define SENSOR_PERIOD_MS            (1000 / SENSOR_PROCESS_HZ)
+#define SENSOR_DEADLINE_MS          SENSOR_PERIOD_MS
+#define DASHBOARD_PERIOD_MS         100     /* bar graph, gear, warning lights */
+#define DASHBOARD_DEADLINE_MS       50
+#define READOUT_PERIOD_MS           200     /* RPM and KMH digits, needle */
+#define READOUT_DEADLINE_MS         100
+#define ODO_PERIOD_MS               1000
+#define ODO_DEADLINE_MS             500
+
+enum {
+    PRIO_INPUT,
+    PRIO_SENSOR,
+    PRIO_DASHBOARD,
+    PRIO_READOUT,
+    PRIO_ODO
+};
 
 /* Display state arrays for speed bars */
 uint8_t shadowArray[110] = {0};
 uint8_t pictureArray[110] = {0};
 uint8_t startUp = 1;
 
-/* Counter for RPM display update (slower than bars) */
-uint32_t rpmDisplayCounter = 0;
-
-/* Counter for odometer update (1 Hz = once per second) */
-uint32_t odoDisplayCounter = 0;
+/* Latest readings, sampled from the sensor snapshot by each display task */
+uint32_t rpmValue = 0;
+uint32_t alarmRpmValue = 0;     /* window RPM: the settled reading, for thresholds */
+uint32_t kmhValue = 0;          /* km/h scaled x7 for the display */
+uint64_t odoDecimeters = 0;
+uint8_t isForward = 1;
 
 /* Last direction for change detection */
 uint8_t lastDirection = 1;  // Start with forward (D)
@@ -46,85 +101,291 @@ uint8_t warningFlashState = 0;
 /* Check engine light state - turns ON permanently after 14k RPM hit once */
 uint8_t checkEngineTriggered = 0;
 
-/* Button state for reset functionality */
-volatile uint8_t buttonPressed = 0;
+/* Boot-to-first-frame time in CPU cycles (clock configured -> static
+ * dashboard and zeroed readouts on screen). Tracked in README. */
+volatile uint32_t bootToFirstFrameCycles = 0;
+
+/*
+ * CRITICAL: TM4C1294 Port P uses PER-PIN interrupts!
+ * These values come from hw_ints.h - use the actual defines
+ */
+#ifndef INT_GPIOP0
+#define INT_GPIOP0      92   /* Actual value from TM4C1294 hw_ints.h */
+#endif
+#ifndef INT_GPIOP1
+#define INT_GPIOP1      93
+#endif
+
+/* Drive motor encoder: KMZ60 S1/S2 on PP0/PP1 (per-pin interrupts),
+ * quadrature on one pole pair, 0.5 cm wheel */
+static const SensorChannelConfig motorEncoder = {
+    "motor", SYSCTL_PERIPH_GPIOP, GPIO_PORTP_BASE, GPIO_PIN_0, GPIO_PIN_1,
+    INT_GPIOP0, INT_GPIOP1, 4, 2.0f * 3.14159265f * 0.005f
+};
+uint8_t motorSensor = SENSOR_NONE;
+
+/* Task ids */
+uint8_t sensorTask = SCHED_NONE;
+uint8_t dashboardTask = SCHED_NONE;
+
+/* Odometer view, cycled by a click on PJ0: total distance or trip */
+enum {
+    ODO_VIEW_TOTAL,
+    ODO_VIEW_TRIP,
+    ODO_VIEW_COUNT
+};
+uint8_t odoView = ODO_VIEW_TOTAL;
+uint64_t tripStartDecimeters = 0;
+
+/* Shift light threshold (fast lane, evaluated per edge) */
+#define SHIFT_LIGHT_RPM             14000
+#define SHIFT_LIGHT_HYSTERESIS_RPM  500
 
 /* Function prototypes */
-void DisplayTimer_Init(uint32_t sysClock);
-void Button_Init(void);
+void Tasks_Init(void);
+void SampleSensor(void);
+void ShiftLightHook(uint8_t channel, uint8_t above);
+void OdoTask(void);
+void ButtonHandler(uint8_t button, InputEvent event);
+
+/* Sensor edge ISR -> fast lane: drawn at the next bus boundary */
+void ShiftLightHook(uint8_t channel, uint8_t above)
+{
+    (void)channel;
 
-/* Timer ISR for display update (10Hz = every 100ms) */
-void Timer1IntHandler(void)
+    FastLane_Post(above ? FASTLANE_SHIFT_ON : FASTLANE_SHIFT_OFF);
+}
+
+/*
+ * PJ0 gestures (input/input.h):
+ *   long press    reset odometer, trip and check engine light
+ *   click         cycle the odometer view (total / trip)
+ *   double press  zero the trip
+ */
+void ButtonHandler(uint8_t button, InputEvent event)
 {
-    TimerIntClear(DISPLAY_TIMER_BASE, TIMER_TIMA_TIMEOUT);
-    displayUpdate = 1;
+    (void)button;
+
+    switch (event) {
+    case INPUT_LONG:
+        TRACE_BEGIN_EVENT(TRACE_BUTTON);
+        Sensor_ResetDistance(motorSensor);
+        odoDecimeters = 0;
+        tripStartDecimeters = 0;
+        checkEngineTriggered = 0;
+        TRACE_END_EVENT(TRACE_BUTTON, 0);
+        break;
+    case INPUT_CLICK:
+        odoView = (odoView + 1) % ODO_VIEW_COUNT;
+        break;
+    case INPUT_DOUBLE:
+        SampleSensor();
+        tripStartDecimeters = odoDecimeters;
+        break;
+    default:
+        return;
+    }
+    /* Show the change now rather than at the next odometer period */
+    OdoTask();
 }
 
-/* Button ISR for reset functionality (PJ0) */
-void GPIOPortJIntHandler(void)
+/* Sensor processing tick: estimates, filters, odometer, alarms */
+void SensorTask(void)
 {
-    uint32_t status = GPIOIntStatus(GPIO_PORTJ_BASE, true);
-    GPIOIntClear(GPIO_PORTJ_BASE, status);
+    TRACE_BEGIN_EVENT(TRACE_SENSOR_PROCESS);
+    Sensor_Process();
+    TRACE_END_EVENT(TRACE_SENSOR_PROCESS, 0);
 
-    if (status & GPIO_PIN_0) {
-        buttonPressed = 1;
+#if MOTOR_AUTO_CALIBRATE
+    /* Calibration from boot: apply the proposal once; no pattern found
+     * keeps motorEncoder as configured */
+    {
+        CalibResult calibration;
+        CalibState state = Sensor_GetCalibration(motorSensor, &calibration);
+        if (state == CALIB_DONE) {
+            Sensor_SetEncoder(motorSensor, calibration.edgesPerRev,
+                              motorEncoder.circumferenceM);
+        }
+        if (state == CALIB_DONE || state == CALIB_FAILED) {
+            Sensor_CancelCalibration();
+        }
+    }
+#endif
+
+    /* Check engine light - trigger once at 14k RPM, then stay ON
+     * permanently. Latched from the window rate, the settled reading,
+     * not the per-edge tracker behind the readouts. */
+    if (!checkEngineTriggered) {
+        SensorSnapshot snap;
+        Sensor_GetSnapshot(motorSensor, &snap);
+        if (snap.windowRpm > 14000.0f) {
+            checkEngineTriggered = 1;
+        }
     }
 }
 
-void DisplayTimer_Init(uint32_t sysClock)
+/* Latest sensor snapshot into the display readings */
+void SampleSensor(void)
 {
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER1);
-    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER1)) {}
+    SensorSnapshot snap;
 
-    TimerConfigure(DISPLAY_TIMER_BASE, TIMER_CFG_PERIODIC);
-    uint32_t loadValue = (sysClock / 10) - 1; /* 100ms period = 10Hz */
-    TimerLoadSet(DISPLAY_TIMER_BASE, TIMER_A, loadValue);
+    Sensor_GetSnapshot(motorSensor, &snap);
 
-    IntRegister(DISPLAY_TIMER_INT, Timer1IntHandler);
-    TimerIntEnable(DISPLAY_TIMER_BASE, TIMER_TIMA_TIMEOUT);
-    IntEnable(DISPLAY_TIMER_INT);
+    /* Convert to integers for display */
+    rpmValue = (uint32_t)snap.rpm;
+    alarmRpmValue = (uint32_t)snap.windowRpm;
+    kmhValue = (uint32_t)(snap.speedKmh * 7.0f); /* Scale KMH by 7x for display */
+    odoDecimeters = (uint64_t)(snap.distanceM * 10.0f); /* Convert meters to decimeters */
+    isForward = (snap.direction == DIR_FORWARD) ? 1 : 0;
+}
 
-    TimerEnable(DISPLAY_TIMER_BASE, TIMER_A);
+/* Bar graph, gear letter and warning lights */
+void DashboardTask(void)
+{
+    SampleSensor();
+
+    /* Update speed bars (always update for smooth animation) */
+    TRACE_BEGIN_EVENT(TRACE_SPEED_BARS);
+    UpdateSpeedBars(rpmValue, shadowArray, pictureArray, startUp);
+    TRACE_END_EVENT(TRACE_SPEED_BARS, DrawQueue_Depth());
+
+    /* Clear startup flag after first update */
+    if (startUp) {
+        startUp = 0;
+    }
+
+    /* Update direction gear indicator when direction changes */
+    if (isForward != lastDirection) {
+        /* Only commit once the letter is queued; retry next period */
+        TRACE_BEGIN_EVENT(TRACE_DIRECTION_GEAR);
+        if (UpdateDirectionGear(isForward))
+            lastDirection = isForward;
+        TRACE_END_EVENT(TRACE_DIRECTION_GEAR, DrawQueue_Depth());
+    }
+
+    /* Warning lights management */
+    /* 100ms period counter for 1s interval flashing (10 runs = 1 second) */
+    warningFlashCounter++;
+    if (warningFlashCounter >= 1000 / DASHBOARD_PERIOD_MS) {
+        warningFlashCounter = 0;
+        warningFlashState = !warningFlashState; /* Toggle every 1 second */
+    }
+
+    /* Build error code bitfield:
+     * Bit 0 (0x01): Water temperature - flashes at 1s interval when RPM > 14000
+     * Bit 1 (0x02): ABS - always ON
+     * Bit 2 (0x04): Battery - flashes at 1s interval when RPM > 14000
+     * Bit 3 (0x08): Check engine - OFF initially, turns ON permanently after 14k RPM hit once
+     */
+    uint8_t errorCode = 0x00;
+
+    if (checkEngineTriggered) {
+        errorCode |= 0x08;
+    }
+
+    /* ABS light - always ON */
+    errorCode |= 0x02;
+
+    /* Water temp and battery - flash at 1s interval when RPM > 14000
+     * (window rate, as the check engine latch) */
+    if (alarmRpmValue > 14000) {
+        if (warningFlashState) {
+            errorCode |= 0x01; /* Water temp ON */
+            errorCode |= 0x04; /* Battery ON */
+        }
+        /* else: both OFF (flashing effect) */
+    }
+
+    /* Update warning lights */
+    TRACE_BEGIN_EVENT(TRACE_WARNING_LIGHTS);
+    UpdateWarningLights(errorCode);
+    TRACE_END_EVENT(TRACE_WARNING_LIGHTS, DrawQueue_Depth());
 }
 
-void Button_Init(void)
+/* RPM (5 digits max = 99999) and KMH readouts with the needle */
+void ReadoutTask(void)
 {
-    /* Enable Port J */
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOJ);
-    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOJ)) {}
+    SampleSensor();
 
-    /* Configure PJ0 as input with pull-up (button connects to ground when pressed) */
-    GPIOPinTypeGPIOInput(GPIO_PORTJ_BASE, GPIO_PIN_0);
-    GPIOPadConfigSet(GPIO_PORTJ_BASE, GPIO_PIN_0, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
+    TRACE_BEGIN_EVENT(TRACE_RPM_DISPLAY);
+    UpdateRPMDisplay(rpmValue);
+    TRACE_END_EVENT(TRACE_RPM_DISPLAY, DrawQueue_Depth());
+
+    TRACE_BEGIN_EVENT(TRACE_KMH_DISPLAY);
+    UpdateKMHDisplay(kmhValue);
+    TRACE_END_EVENT(TRACE_KMH_DISPLAY, DrawQueue_Depth());
+}
+
+#if RPM_STRIPCHART_ENABLE
+/* Strip chart: one scrolled row per sample */
+void StripChartTask(void)
+{
+    SampleSensor();
+
+    TRACE_BEGIN_EVENT(TRACE_STRIPCHART);
+    StripChart_Push(rpmValue);
+    TRACE_END_EVENT(TRACE_STRIPCHART, DrawQueue_Depth());
+}
+#endif
 
-    /* Configure interrupt on falling edge (button press) */
-    GPIOIntTypeSet(GPIO_PORTJ_BASE, GPIO_PIN_0, GPIO_FALLING_EDGE);
+/* ODO display with decimal point, once per second */
+void OdoTask(void)
+{
+    uint64_t shown;
 
-    /* Clear any pending interrupts */
-    GPIOIntClear(GPIO_PORTJ_BASE, GPIO_PIN_0);
+    SampleSensor();
+    shown = odoDecimeters;
 
-    /* Enable GPIO interrupt for the pin */
-    GPIOIntEnable(GPIO_PORTJ_BASE, GPIO_PIN_0);
+    if (odoView == ODO_VIEW_TRIP)
+        shown = (shown > tripStartDecimeters) ? shown - tripStartDecimeters : 0;
 
-    /* Register ISR with NVIC */
-    IntRegister(INT_GPIOJ, GPIOPortJIntHandler);
+    TRACE_BEGIN_EVENT(TRACE_ODO_DISPLAY);
+    UpdateODODisplay(shown);
+    TRACE_END_EVENT(TRACE_ODO_DISPLAY, DrawQueue_Depth());
+}
 
-    /* Enable interrupt in NVIC */
-    IntEnable(INT_GPIOJ);
+void Tasks_Init(void)
+{
+    Input_Init(PRIO_INPUT);
+    sensorTask = Sched_AddPeriodic("sensor", SensorTask, SENSOR_PERIOD_MS, SENSOR_PERIOD_MS,
+                                   SENSOR_DEADLINE_MS, PRIO_SENSOR);
+    dashboardTask = Sched_AddPeriodic("dashboard", DashboardTask, DASHBOARD_PERIOD_MS,
+                                      DASHBOARD_PERIOD_MS, DASHBOARD_DEADLINE_MS,
+                                      PRIO_DASHBOARD);
+    Sched_AddPeriodic("readout", ReadoutTask, READOUT_PERIOD_MS, READOUT_PERIOD_MS,
+                      READOUT_DEADLINE_MS, PRIO_READOUT);
+#if RPM_STRIPCHART_ENABLE
+    Sched_AddPeriodic("stripchart", StripChartTask, RPM_STRIPCHART_SAMPLE_MS,
+                      RPM_STRIPCHART_SAMPLE_MS, READOUT_DEADLINE_MS, PRIO_READOUT);
+#endif
+    Sched_AddPeriodic("odo", OdoTask, ODO_PERIOD_MS, ODO_PERIOD_MS,
+                      ODO_DEADLINE_MS, PRIO_ODO);
 }
 
 int main(void)
 {
     /* Initialize system clock to 120 MHz */
     sysClock = SysCtlClockFreqSet(SYSCTL_OSC_INT | SYSCTL_USE_PLL | SYSCTL_CFG_VCO_480, 120000000);
+    Cycles_Init();
+    TRACE_START(sysClock);
 
     /* Initialize display */
     init_ports_display();
     configure_display_controller_large();
+#if COST_CALIBRATE
+    /* Measure the host cost model's operations (profile/costmodel.h) */
+    CostCal_Run();
+#endif
    // printf("Display initialized\n");
 
     /* Initialize speedometer display with background and static elements */
     InitSpeedometerDisplay();
+    bootToFirstFrameCycles = Cycles_Now();
+
+#if RPM_STRIPCHART_ENABLE
+    StripChart_Init(RPM_STRIPCHART_TOP, RPM_STRIPCHART_HEIGHT, 20, 760,
+                    20000, 14000, ORANGE, BLACK, BURNT_ORANGE);
+#endif
     //printf("Speedometer display ready\n");
 
     /*
@@ -133,128 +394,45 @@ int main(void)
      */
     IntMasterEnable();
 
-    /* Initialize sensor (sets up GPIO per-pin interrupts for Port P) */
-    Sensor_Init();
-
-    /* Initialize display update timer */
-    DisplayTimer_Init(sysClock);
-
-    /* Initialize reset button (PJ0) */
-    Button_Init();
+    /* Initialize sensor timebase, then the motor encoder (sets up GPIO
+     * per-pin interrupts for Port P) */
+    Sensor_Init(sysClock);
+    motorSensor = Sensor_AddChannel(&motorEncoder);
+    /* Per-edge tracker for the readouts: 7-17 ms to follow a step where
+     * the 100 ms window took 300, under 1% overshoot
+     * (tools/estimator_bench.c). The warning lights keep to the window
+     * rate (snap.windowRpm). */
+    Sensor_SetEstimator(motorSensor, SENSOR_ESTIMATOR_TRACKER);
+    Sensor_SetRPMThresholdHook(motorSensor, SHIFT_LIGHT_RPM, SHIFT_LIGHT_HYSTERESIS_RPM,
+                               ShiftLightHook);
+#if MOTOR_AUTO_CALIBRATE
+    Sensor_StartCalibration(motorSensor);
+#endif
+
+    /* Scheduler tasks, then the button (PJ0) that feeds the input task */
+    Tasks_Init();
+    Input_AddButton("PJ0", SYSCTL_PERIPH_GPIOJ, GPIO_PORTJ_BASE, GPIO_PIN_0, INT_GPIOJ,
+                    ButtonHandler);
+
+    /* From here on the draw queue interrupt owns the display bus */
+#if DISPLAY_BUS_DMA
+    BusDma_Init(sysClock);
+    Bus_Select(&busDma);
+#endif
+    DrawQueue_Start(sysClock);
 
     //printf("System ready - spin motor to measure speed\n");
     //printf("=============================================\n");
 
-    /* Main loop */
+    /* Periodic task releases from here on */
+    Sched_Start(sysClock);
+
+    /* Main loop: run released tasks to completion, then sleep until the
+     * next interrupt (sensor edge, button, scheduler or drain timer) */
     while(1)
     {
-        /* Handle button press for reset */
-        if(buttonPressed) {
-            buttonPressed = 0;
-
-            /* Reset odometer */
-            Sensor_ResetDistance();
-
-            /* Reset check engine light */
-            checkEngineTriggered = 0;
-
-            /* Brief delay to debounce */
-            SysCtlDelay(sysClock / 30); /* ~100ms debounce */
-        }
-
-        /* Update display periodically */
-        if(displayUpdate) {
-            displayUpdate = 0;
-
-            /* Update speed calculation (only when display updates) */
-            /* IMPORTANT: Call Sensor_GetSpeed() FIRST - it calculates both speed and RPM */
-            float speed_kmh = Sensor_GetSpeed();
-            float rpm = Sensor_GetRPM();
-            float distance_m = Sensor_GetDistance();
-            RotationDirection dir = Sensor_GetDirection();
-
-            /* Convert to integers for display */
-            uint32_t rpm_int = (uint32_t)rpm;
-            uint32_t kmh_int = (uint32_t)(speed_kmh * 7.0f); /* Scale KMH by 7x for display */
-            uint64_t odo_decimeters = (uint64_t)(distance_m * 10.0f); /* Convert meters to decimeters */
-
-            /* Update speed bars (always update for smooth animation) */
-            UpdateSpeedBars(rpm_int, shadowArray, pictureArray, startUp);
-
-            /* Clear startup flag after first update */
-            if (startUp) {
-                startUp = 0;
-            }
-
-            /* Update RPM digital display every ~200ms (every other display update) */
-            rpmDisplayCounter++;
-            if (rpmDisplayCounter >= 2) {
-                rpmDisplayCounter = 0;
-                UpdateRPMDisplay(rpm_int);
-
-                /* Update KMH display at same rate as RPM */
-                UpdateKMHDisplay(kmh_int);
-            }
-
-            /* Update ODO display every 1s (10 * 100ms = 1000ms) */
-            odoDisplayCounter++;
-            if (odoDisplayCounter >= 10) {
-                odoDisplayCounter = 0;
-                UpdateODODisplay(odo_decimeters);
-            }
-
-            /* Update direction gear indicator when direction changes */
-            uint8_t isForward = (dir == DIR_FORWARD) ? 1 : 0;
-            if (isForward != lastDirection) {
-                lastDirection = isForward;
-                UpdateDirectionGear(isForward);
-            }
-
-            /* Warning lights management */
-            /* 100ms tick counter for 1s interval flashing (10 ticks = 1 second) */
-            warningFlashCounter++;
-            if (warningFlashCounter >= 10) {
-                warningFlashCounter = 0;
-                warningFlashState = !warningFlashState; /* Toggle every 1 second */
-            }
-
-            /* Build error code bitfield:
-             * Bit 0 (0x01): Water temperature - flashes at 1s interval when RPM > 14000
-             * Bit 1 (0x02): ABS - always ON
-             * Bit 2 (0x04): Battery - flashes at 1s interval when RPM > 14000
-             * Bit 3 (0x08): Check engine - OFF initially, turns ON permanently after 14k RPM hit once
-             */
-            uint8_t errorCode = 0x00;
-
-            /* Check engine light - trigger once at 14k RPM, then stay ON permanently */
-            if (rpm_int > 14000 && !checkEngineTriggered) {
-                checkEngineTriggered = 1;
-            }
-            if (checkEngineTriggered) {
-                errorCode |= 0x08;
-            }
-
-            /* ABS light - always ON */
-            errorCode |= 0x02;
-
-            /* Water temp and battery - flash at 1s interval when RPM > 14000 */
-            if (rpm_int > 14000) {
-                if (warningFlashState) {
-                    errorCode |= 0x01; /* Water temp ON */
-                    errorCode |= 0x04; /* Battery ON */
-                }
-                /* else: both OFF (flashing effect) */
-            }
-
-            /* Update warning lights */
-            UpdateWarningLights(errorCode);
-
-            /* Print to console for debugging */
-            const char* dir_str = (dir == DIR_FORWARD) ? "FWD" :
-                                  (dir == DIR_REVERSE) ? "REV" : "STOP";
-            //printf("RPM: %6.1f, Speed: %6.2f km/h [%s], Distance: %7.2f m, Edges: %lu\n",
-            //       rpm, speed_kmh, dir_str, distance_m,
-            //       (unsigned long)Sensor_GetEdgeCount());
-        }
+        MAIN_LOOP_HOOK();
+        Sched_Dispatch();
+        Sched_Idle();
     }
 }
@@ -0,0 +1,160 @@
+/**
+ * costcal.c - On-target calibration of the cost model
+ *
+ * Every operation runs COSTCAL_REPEATS times unrolled between two cycle
+ * counter reads; the cost of the reads themselves (an empty block) is
+ * subtracted. Arithmetic is chained through its own result so the
+ * compiler can neither hoist nor overlap it.
+ */
+
+#include "costcal.h"
+
+#if COST_CALIBRATE
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cycles.h"
+#include "inc/hw_types.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_nvic.h"
+#include "inc/tm4c1294ncpdt.h"
+#include <driverlib/interrupt.h>
+#include "display/display.h"
+#include "display/bus.h"
+
+#define COSTCAL_INT             INT_TIMER2A     /* unused by the firmware */
+#define COSTCAL_ISR_RUNS        8
+
+#define R4(x)                   x x x x
+#define R16(x)                  R4(R4(x))
+#define R64(x)                  R4(R16(x))
+
+#if COSTCAL_REPEATS != 64
+#error "the timed blocks are unrolled for COSTCAL_REPEATS 64"
+#endif
+
+extern const int16_t sin_lut[723];      // display.c
+
+volatile CostCalibration costCalibration;
+
+/* Inputs the compiler cannot see through */
+static volatile uint32_t seedU = 0xFFFFFFF0u, divisorU = 3;
+static volatile float seedF = 1.0001f, factorF = 0.9999f;
+static volatile double seedD = 1.0001, factorD = 0.9999;
+static volatile uint32_t sink;
+
+static uint32_t overhead;
+static volatile uint32_t isrStamp;
+
+static void costCalIntHandler(void)
+{
+    isrStamp = Cycles_Now();
+}
+
+// Cycles per operation x16 from a timed block of COSTCAL_REPEATS operations
+static uint32_t perOp(uint32_t cycles)
+{
+    cycles = cycles > overhead ? cycles - overhead : 0;
+    return (cycles * 16 + COSTCAL_REPEATS / 2) / COSTCAL_REPEATS;
+}
+
+void CostCal_Run(void)
+{
+    static uint8_t bytes[COSTCAL_REPEATS];
+    uint32_t t0, t1, i;
+    uint32_t u, d, entrySum = 0, exitSum = 0;
+    int32_t acc = 0;
+    float f, g;
+    double x, y;
+    bool wasMasked;
+
+    costCalibration.done = 0;
+
+    t0 = Cycles_Now();
+    t1 = Cycles_Now();
+    overhead = t1 - t0;
+
+    // Port L at idle: the stores change nothing on the bus
+    t0 = Cycles_Now();
+    R64(GPIO_PORTL_DATA_R = 0x1F;)
+    t1 = Cycles_Now();
+    costCalibration.gpioStore = perOp(t1 - t0);
+
+    u = 0;
+    t0 = Cycles_Now();
+    R64(u += GPIO_PORTL_DATA_R;)
+    t1 = Cycles_Now();
+    sink = u;
+    costCalibration.gpioLoad = perOp(t1 - t0);
+
+    t0 = Cycles_Now();
+    R64(acc += sin_lut[acc & 511];)
+    t1 = Cycles_Now();
+    sink = (uint32_t)acc;
+    costCalibration.tableLookup = perOp(t1 - t0);
+
+    // SSD1963 NOP (0x00), then parameters it ignores
+    t0 = Cycles_Now();
+    R64(displayBus->writeCommand(0x00);)
+    t1 = Cycles_Now();
+    costCalibration.busCall = perOp(t1 - t0) - 3 * costCalibration.gpioStore;
+
+    t0 = Cycles_Now();
+    displayBus->writeData(bytes, COSTCAL_REPEATS);
+    t1 = Cycles_Now();
+    costCalibration.bitbangByte = perOp(t1 - t0);
+
+    u = seedU;
+    d = divisorU;
+    t0 = Cycles_Now();
+    R64(u = u / d + 0xF0000000u;)
+    t1 = Cycles_Now();
+    sink = u;
+    costCalibration.intDiv = perOp(t1 - t0);
+
+    f = seedF;
+    g = factorF;
+    t0 = Cycles_Now();
+    R64(f = f * g;)
+    t1 = Cycles_Now();
+    sink = (uint32_t)f;
+    costCalibration.floatOp = perOp(t1 - t0);
+
+    f = seedF;
+    t0 = Cycles_Now();
+    R64(f = g / f;)
+    t1 = Cycles_Now();
+    sink = (uint32_t)f;
+    costCalibration.floatDiv = perOp(t1 - t0);
+
+    x = seedD;
+    y = factorD;
+    t0 = Cycles_Now();
+    R64(x = x * y;)
+    t1 = Cycles_Now();
+    sink = (uint32_t)x;
+    costCalibration.doubleOp = perOp(t1 - t0);
+
+    // Exception entry: software trigger to the first instruction of the
+    // handler; exit: handler stamp to the instruction after the trigger
+    IntRegister(COSTCAL_INT, costCalIntHandler);
+    IntEnable(COSTCAL_INT);
+    wasMasked = IntMasterEnable();
+    for (i = 0; i < COSTCAL_ISR_RUNS; i++) {
+        t0 = Cycles_Now();
+        HWREG(NVIC_SW_TRIG) = COSTCAL_INT - 16;
+        t1 = Cycles_Now();
+        entrySum += isrStamp - t0 - overhead;
+        exitSum += t1 - isrStamp - overhead;
+    }
+    if (wasMasked)
+        IntMasterDisable();
+    IntDisable(COSTCAL_INT);
+    IntUnregister(COSTCAL_INT);
+    costCalibration.isrEntry = entrySum * 16 / COSTCAL_ISR_RUNS;
+    costCalibration.isrExit = exitSum * 16 / COSTCAL_ISR_RUNS;
+
+    costCalibration.done = 1;
+}
+
+#endif /* COST_CALIBRATE */
@@ -0,0 +1,48 @@
+/**
+ * costcal.h - One-shot on-target calibration of the cost model
+ *
+ * CostCal_Run() times each operation of profile/costmodel.h with the DWT
+ * cycle counter and leaves the results in costCalibration, in sixteenths
+ * of a cycle per operation. Build once with COST_CALIBRATE=1 predefined, halt on the
+ * board after main() has called it, read costCalibration in the CCS
+ * Expressions view and copy the figures into costmodel.h.
+ *
+ * Needs the display ports initialised (it strobes NOP commands on the bus)
+ * and Timer2A's interrupt free (it measures exception entry and exit on it).
+ */
+
+#ifndef COSTCAL_H
+#define COSTCAL_H
+
+#include <stdint.h>
+
+#ifndef COST_CALIBRATE
+#define COST_CALIBRATE          0
+#endif
+
+#define COSTCAL_REPEATS         64      /* operations per timed block */
+
+/* Cycles per operation, fixed point x16 (e.g. 72 = 4.5 cycles) */
+typedef struct {
+    uint32_t gpioStore;         // COST_GPIO_STORE
+    uint32_t gpioLoad;          // COST_GPIO_LOAD
+    uint32_t tableLookup;       // COST_TABLE_LOOKUP
+    uint32_t busCall;           // COST_BUS_CALL (write_command minus its stores)
+    uint32_t bitbangByte;       // COST_BITBANG_BYTE (write_data per byte)
+    uint32_t intDiv;            // COST_INT_DIV
+    uint32_t floatOp;           // COST_FLOAT_OP
+    uint32_t floatDiv;          // COST_FLOAT_DIV
+    uint32_t doubleOp;          // COST_DOUBLE_OP
+    uint32_t isrEntry;          // COST_ISR_ENTRY
+    uint32_t isrExit;           // COST_ISR_EXIT
+    uint32_t done;              // 1 once the run is complete
+} CostCalibration;
+
+extern volatile CostCalibration costCalibration;
+
+/**
+ * Measure every operation; takes well under a millisecond
+ */
+void CostCal_Run(void);
+
+#endif /* COSTCAL_H */
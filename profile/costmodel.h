@@ -0,0 +1,65 @@
+/**
+ * costmodel.h - Target cycle cost of counted operations
+ *
+ * The host tools count operations, not time: GPIO stores on the display
+ * bus, driverlib calls, table lookups, divides, float and soft-double
+ * arithmetic, interrupt entry and exit. Multiplying the counts by these
+ * costs projects cycles on the TM4C1294 at COST_CPU_HZ, so the simulator
+ * (sim/) and tools/render_bench.c can report target time without the
+ * board.
+ *
+ * Calibration: build with COST_CALIBRATE=1, run past CostCal_Run() in
+ * main() and read costCalibration in the debugger (profile/costcal.h).
+ * Copy the per-operation figures here. One measurement per
+ * board revision or clock/flash wait state change is enough. Until then
+ * the values below are Cortex-M4 TRM timings plus the 4-cycle GPIO store
+ * the tear-sync budget (display/tearsync.h) has always assumed.
+ *
+ * Compute-heavy firmware code marks its cost with COST_CHARGE(); on the
+ * target the macro is empty, in HOST_BUILD it is a simulator charge point.
+ */
+
+#ifndef COSTMODEL_H
+#define COSTMODEL_H
+
+#include <stdint.h>
+
+#define COST_CPU_HZ             120000000
+
+/* Memory and peripherals (cycles per operation) */
+#define COST_GPIO_STORE         4       /* AHB GPIO data store, back to back */
+#define COST_GPIO_LOAD          4
+#define COST_TABLE_LOOKUP       3       /* const table in flash, index computed */
+#define COST_LOOP_ITER          2       /* compare, branch, pointer increment */
+#define COST_LINE_STEP          16      /* Bresenham step, two span plots */
+
+/* Calls */
+#define COST_BUS_CALL           10      /* call through displayBus incl. return */
+#define COST_DRIVERLIB_CALL     20      /* driverlib call incl. register access */
+
+/* Arithmetic */
+#define COST_INT_DIV            7       /* UDIV/SDIV, 2..12 data dependent */
+#define COST_FLOAT_OP           1       /* FPU add/sub/mul, int <-> float */
+#define COST_FLOAT_DIV          14      /* VDIV.F32 */
+#define COST_DOUBLE_OP          60      /* soft-float double mul/add */
+
+/* Exceptions */
+#define COST_ISR_ENTRY          12      /* stacking, vector fetch */
+#define COST_ISR_EXIT           10      /* unstacking */
+
+/* Derived */
+#define COST_BITBANG_BYTE       (3 * COST_GPIO_STORE + COST_LOOP_ITER)  /* write_data() */
+#define COST_BITBANG_PIXEL      (9 * COST_GPIO_STORE)                   /* 888 fill, unrolled */
+
+/* Cycles to microseconds / milliseconds on the target */
+#define COST_US(cycles)         ((double)(cycles) * 1e6 / COST_CPU_HZ)
+#define COST_MS(cycles)         ((double)(cycles) * 1e3 / COST_CPU_HZ)
+
+#ifdef HOST_BUILD
+void Sim_Charge(uint32_t cycles);
+#define COST_CHARGE(cycles)     Sim_Charge(cycles)
+#else
+#define COST_CHARGE(cycles)     ((void)0)
+#endif
+
+#endif /* COSTMODEL_H */
@@ -0,0 +1,40 @@
+/**
+ * cycles.h - Cortex-M4 DWT cycle counter access
+ *
+ * CYCCNT counts CPU clock cycles (120 MHz after SysCtlClockFreqSet) and
+ * wraps every ~35.8 s. Differences of two readings are valid across one
+ * wrap as long as they are computed in uint32_t.
+ */
+
+#ifndef CYCLES_H
+#define CYCLES_H
+
+#include <stdint.h>
+#include "inc/hw_types.h"
+
+/* Core debug / DWT registers (not covered by the TivaWare hw_*.h headers) */
+#define CORE_DEMCR          0xE000EDFC
+#define CORE_DEMCR_TRCENA   0x01000000
+#define DWT_CTRL            0xE0001000
+#define DWT_CTRL_CYCCNTENA  0x00000001
+#define DWT_CYCCNT          0xE0001004
+
+/**
+ * Enable and zero the cycle counter
+ */
+static inline void Cycles_Init(void)
+{
+    HWREG(CORE_DEMCR) |= CORE_DEMCR_TRCENA;
+    HWREG(DWT_CYCCNT) = 0;
+    HWREG(DWT_CTRL) |= DWT_CTRL_CYCCNTENA;
+}
+
+/**
+ * Current cycle count
+ */
+static inline uint32_t Cycles_Now(void)
+{
+    return HWREG(DWT_CYCCNT);
+}
+
+#endif /* CYCLES_H */
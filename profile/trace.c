@@ -0,0 +1,30 @@
+/**
+ * trace.c - Timeline trace ring buffer
+ */
+
+#include "trace.h"
+
+#if TRACE_ENABLE
+
+#include <stdint.h>
+#include <string.h>
+
+TraceBuffer traceBuffer;
+
+void Trace_Start(uint32_t cpuHz)
+{
+    traceBuffer.frozen = 1;
+    memset(traceBuffer.events, 0, sizeof(traceBuffer.events));
+    traceBuffer.magic = TRACE_MAGIC;
+    traceBuffer.cpuHz = cpuHz;
+    traceBuffer.capacity = TRACE_EVENTS;
+    traceBuffer.count = 0;
+    traceBuffer.frozen = 0;
+}
+
+void Trace_Freeze(void)
+{
+    traceBuffer.frozen = 1;
+}
+
+#endif /* TRACE_ENABLE */
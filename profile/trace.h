@@ -0,0 +1,148 @@
+/**
+ * trace.h - Timeline trace of ISRs and main loop stages
+ *
+ * A ring of begin/end/instant events stamped with the DWT cycle counter.
+ * Recording is inline: claim a slot with interrupts masked, two stores,
+ * done (about a dozen cycles). The newest TRACE_EVENTS events are kept,
+ * so after an overrun the ring holds what led up to it. Trace_Freeze()
+ * stops recording to preserve that history until it is read out.
+ *
+ * Read-out: save traceBuffer (sizeof(TraceBuffer) bytes from its address,
+ * e.g. CCS Memory Browser -> Save Memory, raw binary) or let the host
+ * simulator write it (tachosim -T), then convert with tools/trace2json.c
+ * and open the JSON in chrome://tracing or ui.perfetto.dev.
+ *
+ * Off by default; with TRACE_ENABLE 0 every TRACE_* macro is empty.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE        0
+#endif
+
+#define TRACE_EVENTS        2048    /* power of two; 8 bytes each */
+#define TRACE_MAGIC         0x54524331  /* "TRC1" */
+
+/* Event kinds */
+#define TRACE_BEGIN         0
+#define TRACE_END           1
+#define TRACE_INSTANT       2
+
+/*
+ * Event IDs: TRACE_ID(symbol, name, track). Events on one track must
+ * nest; every ISR gets its own track so preemption shows as stacking.
+ */
+#define TRACE_TRACK_MAIN    0
+#define TRACE_TRACK_SENSOR  1
+#define TRACE_TRACK_SCHED   2
+#define TRACE_TRACK_BUTTON  3
+#define TRACE_TRACK_DRAIN   4
+
+#define TRACE_IDS(TRACE_ID) \
+    TRACE_ID(TRACE_SENSOR_EDGE,     "sensor edge",      TRACE_TRACK_SENSOR) \
+    TRACE_ID(TRACE_RELEASE,         "task release",     TRACE_TRACK_SCHED)  \
+    TRACE_ID(TRACE_OVERRUN,         "task overrun",     TRACE_TRACK_SCHED)  \
+    TRACE_ID(TRACE_BUTTON_IRQ,      "button irq",       TRACE_TRACK_BUTTON) \
+    TRACE_ID(TRACE_DRAIN,           "drain",            TRACE_TRACK_DRAIN)  \
+    TRACE_ID(TRACE_FASTLANE,        "fast lane",        TRACE_TRACK_DRAIN)  \
+    TRACE_ID(TRACE_SYNC_HOLD,       "sync hold",        TRACE_TRACK_DRAIN)  \
+    TRACE_ID(TRACE_QUEUE_FULL,      "queue overflow",   TRACE_TRACK_MAIN)   \
+    TRACE_ID(TRACE_BUTTON,          "button reset",     TRACE_TRACK_MAIN)   \
+    TRACE_ID(TRACE_TASK,            "task",             TRACE_TRACK_MAIN)   \
+    TRACE_ID(TRACE_DEADLINE_MISS,   "deadline miss",    TRACE_TRACK_MAIN)   \
+    TRACE_ID(TRACE_SENSOR_PROCESS,  "Sensor_Process",   TRACE_TRACK_MAIN)   \
+    TRACE_ID(TRACE_SPEED_BARS,      "UpdateSpeedBars",  TRACE_TRACK_MAIN)   \
+    TRACE_ID(TRACE_RPM_DISPLAY,     "UpdateRPMDisplay", TRACE_TRACK_MAIN)   \
+    TRACE_ID(TRACE_KMH_DISPLAY,     "UpdateKMHDisplay", TRACE_TRACK_MAIN)   \
+    TRACE_ID(TRACE_STRIPCHART,      "StripChart_Push",  TRACE_TRACK_MAIN)   \
+    TRACE_ID(TRACE_ODO_DISPLAY,     "UpdateODODisplay", TRACE_TRACK_MAIN)   \
+    TRACE_ID(TRACE_DIRECTION_GEAR,  "UpdateDirectionGear", TRACE_TRACK_MAIN) \
+    TRACE_ID(TRACE_WARNING_LIGHTS,  "UpdateWarningLights", TRACE_TRACK_MAIN)
+
+#define TRACE_ID_ENUM(symbol, name, track) symbol,
+typedef enum {
+    TRACE_IDS(TRACE_ID_ENUM)
+    TRACE_ID_COUNT
+} TraceId;
+#undef TRACE_ID_ENUM
+
+typedef struct {
+    uint32_t cycles;        // DWT_CYCCNT at the event
+    uint32_t info;          // kind | id << 8 | arg << 16
+} TraceEvent;
+
+/* Memory image read by tools/trace2json.c (little endian, as on target) */
+typedef struct {
+    uint32_t magic;
+    uint32_t cpuHz;
+    uint32_t capacity;      // TRACE_EVENTS
+    volatile uint32_t count;    // events written since Trace_Start(); slot = count % capacity
+    volatile uint32_t frozen;
+    TraceEvent events[TRACE_EVENTS];
+} TraceBuffer;
+
+extern TraceBuffer traceBuffer;
+
+/**
+ * Clear the ring and start recording. cpuHz is stored for the converter.
+ */
+void Trace_Start(uint32_t cpuHz);
+
+/**
+ * Stop recording (keeps the ring as is). Trace_Start() resumes.
+ */
+void Trace_Freeze(void);
+
+#if TRACE_ENABLE
+
+#include "profile/cycles.h"
+
+/* PRIMASK save/mask/restore without a driverlib call */
+#if defined(HOST_BUILD)
+#include <driverlib/interrupt.h>
+#define TRACE_LOCK()        bool traceMasked = IntMasterDisable()
+#define TRACE_UNLOCK()      do { if (!traceMasked) IntMasterEnable(); } while (0)
+#elif defined(__TI_ARM__)
+#define TRACE_LOCK()        unsigned int traceMasked = _disable_IRQ()
+#define TRACE_UNLOCK()      _restore_interrupts(traceMasked)
+#else
+#define TRACE_LOCK()        uint32_t traceMasked; \
+                            __asm volatile ("mrs %0, primask\n cpsid i" : "=r" (traceMasked) :: "memory")
+#define TRACE_UNLOCK()      __asm volatile ("msr primask, %0" :: "r" (traceMasked) : "memory")
+#endif
+
+static inline void Trace_Record(uint32_t kind, uint32_t id, uint32_t arg)
+{
+    TRACE_LOCK();
+    if (!traceBuffer.frozen) {
+        TraceEvent *e = &traceBuffer.events[traceBuffer.count & (TRACE_EVENTS - 1)];
+        e->cycles = Cycles_Now();
+        e->info = kind | (id << 8) | (arg << 16);
+        traceBuffer.count++;
+    }
+    TRACE_UNLOCK();
+}
+
+#define TRACE_BEGIN_EVENT(id)       Trace_Record(TRACE_BEGIN, (id), 0)
+#define TRACE_END_EVENT(id, arg)    Trace_Record(TRACE_END, (id), (uint16_t)(arg))
+#define TRACE_INSTANT_EVENT(id, arg) Trace_Record(TRACE_INSTANT, (id), (uint16_t)(arg))
+#define TRACE_START(hz)             Trace_Start(hz)
+#define TRACE_FREEZE()              Trace_Freeze()
+
+#else
+
+/* sizeof: arguments are not evaluated, but still count as used */
+#define TRACE_BEGIN_EVENT(id)       ((void)0)
+#define TRACE_END_EVENT(id, arg)    ((void)sizeof(arg))
+#define TRACE_INSTANT_EVENT(id, arg) ((void)sizeof(arg))
+#define TRACE_START(hz)             ((void)0)
+#define TRACE_FREEZE()              ((void)0)
+
+#endif /* TRACE_ENABLE */
+
+#endif /* TRACE_H */
@@ -0,0 +1,377 @@
+/**
+ * sched.c - Cooperative run-to-completion task scheduler
+ */
+
+#include "sched.h"
+#include "profile/cycles.h"
+#include "profile/trace.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <inc/hw_memmap.h>
+#include <inc/hw_ints.h>
+#include <driverlib/sysctl.h>
+#include <driverlib/interrupt.h>
+#include <driverlib/timer.h>
+
+#define SCHED_TIMER_BASE        TIMER1_BASE
+#define SCHED_TIMER_INT         INT_TIMER1A
+
+#define MS_TO_TICKS(ms)         ((uint32_t)(ms) * SCHED_TICK_HZ / 1000)
+
+static SchedTask tasks[SCHED_MAX_TASKS];
+static uint8_t taskCount;
+static volatile uint8_t readyCount;
+
+/* Tickless time base: the timer runs one shot per gap between releases */
+static uint32_t tickCycles;             // timer cycles per tick, 0 = not started
+static volatile uint32_t shotStart;     // tick the running shot began at
+static volatile uint32_t shotTicks;     // its length
+
+/* Idle accounting (main loop only) */
+static SchedLoad load;
+static uint32_t lastClock;              // clockNow() at the last sleep
+static uint32_t lastCycles;             // CYCCNT at the last sleep
+
+// ============================================
+// Setup
+// ============================================
+
+static uint8_t addTask(const char *name, void (*run)(void), uint32_t period,
+                       uint32_t phase, uint32_t deadline, uint8_t priority)
+{
+    SchedTask *t;
+
+    if (taskCount == SCHED_MAX_TASKS)
+        return SCHED_NONE;
+    t = &tasks[taskCount];
+    t->name = name;
+    t->run = run;
+    t->period = period;
+    t->deadline = deadline;
+    t->priority = priority;
+    t->nextRelease = phase;
+    return taskCount++;
+}
+
+uint8_t Sched_AddPeriodic(const char *name, void (*run)(void), uint32_t periodMs,
+                          uint32_t phaseMs, uint32_t deadlineMs, uint8_t priority)
+{
+    uint32_t period = MS_TO_TICKS(periodMs);
+
+    if (period == 0)
+        return SCHED_NONE;
+    return addTask(name, run, period, MS_TO_TICKS(phaseMs), MS_TO_TICKS(deadlineMs), priority);
+}
+
+uint8_t Sched_AddEvent(const char *name, void (*run)(void), uint32_t deadlineMs,
+                       uint8_t priority)
+{
+    return addTask(name, run, 0, 0, MS_TO_TICKS(deadlineMs), priority);
+}
+
+// ============================================
+// Time base
+// ============================================
+
+// Cycles into the running shot. Caller masks interrupts or runs at
+// interrupt level.
+static uint32_t shotElapsed(void)
+{
+    // Expired, handler not run yet: the one-shot has stopped at the end
+    if (TimerIntStatus(SCHED_TIMER_BASE, false) & TIMER_TIMA_TIMEOUT)
+        return shotTicks * tickCycles;
+    return shotTicks * tickCycles - 1 - TimerValueGet(SCHED_TIMER_BASE, TIMER_A);
+}
+
+// Same conditions as shotElapsed()
+static uint32_t now(void)
+{
+    if (!tickCycles)
+        return 0;
+    return shotStart + shotElapsed() / tickCycles;
+}
+
+// Timer cycles since Sched_Start(), modulo 2^32; same conditions
+static uint32_t clockNow(void)
+{
+    return shotStart * tickCycles + shotElapsed();
+}
+
+// Ticks from `at` to the earliest periodic or delayed release
+static uint32_t nextShot(uint32_t at)
+{
+    uint32_t next = SCHED_MAX_SHOT_TICKS;
+    uint8_t i;
+
+    for (i = 0; i < taskCount; i++) {
+        int32_t left = (int32_t)(tasks[i].nextRelease - at);
+        if (!tasks[i].period && !tasks[i].delayed)
+            continue;
+        if (left < 1)
+            left = 1;
+        if ((uint32_t)left < next)
+            next = (uint32_t)left;
+    }
+    return next;
+}
+
+static void arm(uint32_t start, uint32_t length)
+{
+    shotStart = start;
+    shotTicks = length;
+    TimerLoadSet(SCHED_TIMER_BASE, TIMER_A, length * tickCycles - 1);
+    TimerEnable(SCHED_TIMER_BASE, TIMER_A);
+}
+
+// End the running shot `length` ticks after its start instead, keeping
+// the time already elapsed. Caller masks interrupts.
+static void shorten(uint32_t length)
+{
+    uint32_t elapsed = shotElapsed();
+
+    TimerDisable(SCHED_TIMER_BASE, TIMER_A);
+    // Expired meanwhile: the pending handler arms the next shot
+    if (TimerIntStatus(SCHED_TIMER_BASE, false) & TIMER_TIMA_TIMEOUT)
+        return;
+    shotTicks = length;
+    TimerLoadSet(SCHED_TIMER_BASE, TIMER_A, length * tickCycles - 1 - elapsed);
+    TimerEnable(SCHED_TIMER_BASE, TIMER_A);
+}
+
+// ============================================
+// Release (interrupt context)
+// ============================================
+
+// Caller masks interrupts or runs at interrupt level
+static void release(uint8_t id, uint32_t now)
+{
+    SchedTask *t = &tasks[id];
+
+    if (t->ready) {
+        // Periodic: the previous release never ran. Event: merge.
+        if (t->period) {
+            t->overruns++;
+            t->misses++;
+            TRACE_INSTANT_EVENT(TRACE_OVERRUN, id);
+#if TRACE_ENABLE && SCHED_TRACE_FREEZE_ON_MISS
+            TRACE_FREEZE();
+#endif
+            t->release = now;
+        }
+        return;
+    }
+    t->release = now;
+    t->ready = 1;
+    readyCount++;
+    TRACE_INSTANT_EVENT(TRACE_RELEASE, id);
+}
+
+void SchedTimerIntHandler(void)
+{
+    uint32_t at;
+    uint8_t i;
+
+    TimerIntClear(SCHED_TIMER_BASE, TIMER_TIMA_TIMEOUT);
+    at = shotStart + shotTicks;
+
+    for (i = 0; i < taskCount; i++) {
+        SchedTask *t = &tasks[i];
+        if ((t->period || t->delayed) && (int32_t)(at - t->nextRelease) >= 0) {
+            if (t->period)
+                t->nextRelease += t->period;
+            t->delayed = 0;
+            release(i, at);
+        }
+    }
+
+    // Sleep through to the next release. The handler's latency is lost
+    // per shot, so scheduler time runs a few ppm slow; nothing measured
+    // depends on it (edge timing has its own timer).
+    arm(at, nextShot(at));
+}
+
+void Sched_Post(uint8_t id)
+{
+    bool wasMasked;
+
+    if (id >= taskCount)
+        return;
+    wasMasked = IntMasterDisable();
+    release(id, now());
+    if (!wasMasked)
+        IntMasterEnable();
+}
+
+void Sched_PostAfter(uint8_t id, uint32_t delayMs)
+{
+    uint32_t delay = MS_TO_TICKS(delayMs);
+    uint32_t due;
+    SchedTask *t;
+    bool wasMasked;
+
+    if (id >= taskCount || tasks[id].period)
+        return;
+    if (delay == 0) {
+        Sched_Post(id);
+        return;
+    }
+    t = &tasks[id];
+    wasMasked = IntMasterDisable();
+    due = now() + delay;
+    if (!t->delayed || (int32_t)(due - t->nextRelease) < 0) {
+        t->nextRelease = due;
+        t->delayed = 1;
+        // Before the running shot ends: cut it short
+        if (tickCycles && (int32_t)(due - (shotStart + shotTicks)) < 0)
+            shorten(due - shotStart);
+    }
+    if (!wasMasked)
+        IntMasterEnable();
+}
+
+void Sched_Start(uint32_t sysClock)
+{
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER1);
+    while(!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER1)) {}
+
+    TimerConfigure(SCHED_TIMER_BASE, TIMER_CFG_ONE_SHOT);
+    tickCycles = sysClock / SCHED_TICK_HZ;
+
+    IntRegister(SCHED_TIMER_INT, SchedTimerIntHandler);
+    TimerIntEnable(SCHED_TIMER_BASE, TIMER_TIMA_TIMEOUT);
+    IntEnable(SCHED_TIMER_INT);
+
+    lastCycles = Cycles_Now();
+    arm(0, nextShot(0));
+}
+
+// ============================================
+// Dispatch (main loop)
+// ============================================
+
+// Highest priority, then earliest absolute deadline
+static uint8_t pickReady(void)
+{
+    uint8_t best = SCHED_NONE;
+    uint32_t bestDue = 0;
+    uint32_t at = shotStart;    // only differences count: any tick nearby does
+    uint8_t i;
+
+    for (i = 0; i < taskCount; i++) {
+        const SchedTask *t = &tasks[i];
+        uint32_t due;
+
+        if (!t->ready)
+            continue;
+        // Time left, so ordering survives the tick counter wrapping
+        due = t->release + t->deadline - at;
+        if (best == SCHED_NONE || t->priority < tasks[best].priority ||
+            (t->priority == tasks[best].priority && (int32_t)(due - bestDue) < 0)) {
+            best = i;
+            bestDue = due;
+        }
+    }
+    return best;
+}
+
+uint32_t Sched_Dispatch(void)
+{
+    uint32_t runs = 0;
+
+    while (readyCount) {
+        SchedTask *t;
+        uint32_t released, start, cycles;
+        uint8_t id;
+        bool wasMasked;
+
+        wasMasked = IntMasterDisable();
+        id = pickReady();
+        t = &tasks[id];
+        released = t->release;
+        t->ready = 0;
+        readyCount--;
+        if (!wasMasked)
+            IntMasterEnable();
+
+        TRACE_BEGIN_EVENT(TRACE_TASK);
+        start = Cycles_Now();
+        t->run();
+        cycles = Cycles_Now() - start;
+        TRACE_END_EVENT(TRACE_TASK, id);
+
+        t->runs++;
+        t->cyclesSum += cycles;
+        if (cycles > t->cyclesMax)
+            t->cyclesMax = cycles;
+        if (Sched_Now() - released > t->deadline) {
+            t->misses++;
+            TRACE_INSTANT_EVENT(TRACE_DEADLINE_MISS, id);
+#if TRACE_ENABLE && SCHED_TRACE_FREEZE_ON_MISS
+            TRACE_FREEZE();
+#endif
+        }
+        runs++;
+    }
+    return runs;
+}
+
+void Sched_Idle(void)
+{
+    bool wasMasked = IntMasterDisable();
+
+    // Checked with interrupts masked: a release from here on leaves its
+    // interrupt pending, and WFI returns on a pending interrupt even when
+    // masked. The handler runs once interrupts are unmasked below.
+    if (readyCount == 0 && tickCycles) {
+        // The core clock, and CYCCNT with it, stops in sleep: the cycle
+        // counter advances by the time awake, the timer by all of it
+        uint32_t clock = clockNow();
+        uint32_t cycles = Cycles_Now();
+        uint32_t elapsed = clock - lastClock;
+        uint32_t awake = cycles - lastCycles;
+
+        // The timer loses each shot's re-arm latency; never go negative
+        if (awake > elapsed)
+            awake = elapsed;
+        load.busyCycles += awake;
+        load.idleCycles += elapsed - awake;
+        lastClock = clock;
+        lastCycles = cycles;
+#if !TRACE_ENABLE
+        load.sleeps++;
+        SysCtlSleep();
+#endif
+    }
+    if (!wasMasked)
+        IntMasterEnable();
+}
+
+// ============================================
+// Status
+// ============================================
+
+bool Sched_Pending(void)
+{
+    return readyCount != 0;
+}
+
+uint32_t Sched_Now(void)
+{
+    bool wasMasked = IntMasterDisable();
+    uint32_t ticks = now();
+
+    if (!wasMasked)
+        IntMasterEnable();
+    return ticks;
+}
+
+const SchedLoad *Sched_GetLoad(void)
+{
+    return &load;
+}
+
+const SchedTask *Sched_GetTask(uint8_t id)
+{
+    return id < taskCount ? &tasks[id] : NULL;
+}
@@ -0,0 +1,133 @@
+/**
+ * sched.h - Cooperative run-to-completion task scheduler
+ *
+ * Time counts in ticks of 1/SCHED_TICK_HZ, but the timer (Timer1A) is
+ * tickless: it runs one-shot to the next periodic release instead of
+ * interrupting every tick. Interrupt handlers release event tasks with
+ * Sched_Post(), now or after a delay (Sched_PostAfter()). The main loop calls Sched_Dispatch(), which runs ready
+ * tasks to completion, highest priority first and earliest deadline
+ * first within a priority, until none is ready, then Sched_Idle(), which
+ * sleeps until the next interrupt. A task never preempts another;
+ * interrupts preempt all.
+ *
+ * Per task the scheduler keeps runs, worst and total run time (DWT
+ * cycles, interrupts included) and deadline misses. A miss is a run that
+ * completes more than `deadline` ticks after its release, or a periodic
+ * release that finds the previous one still waiting (an overrun: the two
+ * merge into one run, timed from the newer release). The statistics live
+ * in the task table for the debugger and are read on the host through
+ * Sched_GetTask(). Sched_GetLoad() splits the time since Sched_Start()
+ * into busy and asleep.
+ */
+
+#ifndef SCHED_H
+#define SCHED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SCHED_TICK_HZ           1000
+#define SCHED_MAX_TASKS         8
+#define SCHED_NONE              0xFF    /* Sched_Add*() table full */
+#define SCHED_MAX_SHOT_TICKS    1000    /* longest timer shot (no periodic task due) */
+
+/* With TRACE_ENABLE: stop the trace at the first deadline miss so the
+ * ring keeps what led up to it (see profile/trace.h) */
+#define SCHED_TRACE_FREEZE_ON_MISS  1
+
+typedef struct {
+    const char *name;
+    void (*run)(void);
+    uint32_t period;            // ticks, 0 = event task
+    uint32_t deadline;          // ticks after release
+    uint8_t priority;           // 0 = highest
+
+    volatile uint8_t ready;
+    volatile uint32_t release;  // tick of the pending release
+    uint32_t nextRelease;       // tick of the next periodic or delayed release
+    volatile uint8_t delayed;   // event: a Sched_PostAfter() release is pending
+
+    uint32_t runs;
+    uint32_t misses;
+    uint32_t overruns;          // releases dropped (also counted as misses)
+    uint32_t cyclesMax;
+    uint64_t cyclesSum;
+} SchedTask;
+
+/* Time since Sched_Start() in system clock cycles, up to the last sleep.
+ * Busy is the core awake (tasks and interrupts alike), idle asleep. */
+typedef struct {
+    uint64_t busyCycles;
+    uint64_t idleCycles;
+    uint32_t sleeps;
+} SchedLoad;
+
+/**
+ * Add a periodic task, first released at tick `phase`. Returns the task
+ * id or SCHED_NONE. Call before Sched_Start().
+ */
+uint8_t Sched_AddPeriodic(const char *name, void (*run)(void), uint32_t periodMs,
+                          uint32_t phaseMs, uint32_t deadlineMs, uint8_t priority);
+
+/**
+ * Add an event task released by Sched_Post(). Returns the task id or
+ * SCHED_NONE. Call before Sched_Start().
+ */
+uint8_t Sched_AddEvent(const char *name, void (*run)(void), uint32_t deadlineMs,
+                       uint8_t priority);
+
+/**
+ * Start the tick timer (Timer1A)
+ */
+void Sched_Start(uint32_t sysClock);
+
+/**
+ * Release an event task (interrupt safe). A post while the task is still
+ * ready merges with the pending release.
+ */
+void Sched_Post(uint8_t id);
+
+/**
+ * Release an event task `delayMs` from now (interrupt safe, 1 tick
+ * resolution). One delayed release per task, the earliest asked for: a
+ * post due before the pending release moves it earlier, a post due at
+ * or after it is dropped. A task with several timeouts re-posts the
+ * next one each time it runs.
+ */
+void Sched_PostAfter(uint8_t id, uint32_t delayMs);
+
+/**
+ * Run ready tasks until none is ready. Returns the number of runs.
+ */
+uint32_t Sched_Dispatch(void);
+
+/**
+ * Sleep (WFI) until the next interrupt if no task is ready; return at
+ * once otherwise. Call after Sched_Dispatch(). Every interrupt wakes the
+ * core; peripheral clocks keep running in sleep. CYCCNT stops while
+ * asleep, so with TRACE_ENABLE, whose timestamps it provides, the call
+ * returns without sleeping.
+ */
+void Sched_Idle(void);
+
+/**
+ * True if any task is ready
+ */
+bool Sched_Pending(void);
+
+/**
+ * Ticks since Sched_Start()
+ */
+uint32_t Sched_Now(void);
+
+/**
+ * Busy and idle time so far
+ */
+const SchedLoad *Sched_GetLoad(void);
+
+/**
+ * Task table entry for statistics, NULL past the last task
+ */
+const SchedTask *Sched_GetTask(uint8_t id);
+
+#endif /* SCHED_H */
@@ -0,0 +1,44 @@
+/**
+ * gpio.h - Simulator stand-in for the TivaWare header
+ */
+
+#ifndef GPIO_H
+#define GPIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define GPIO_PIN_0              0x00000001
+#define GPIO_PIN_1              0x00000002
+#define GPIO_PIN_2              0x00000004
+#define GPIO_PIN_3              0x00000008
+#define GPIO_PIN_4              0x00000010
+#define GPIO_PIN_5              0x00000020
+#define GPIO_PIN_6              0x00000040
+#define GPIO_PIN_7              0x00000080
+
+#define GPIO_FALLING_EDGE       0x00000000
+#define GPIO_RISING_EDGE        0x00000004
+#define GPIO_BOTH_EDGES         0x00000001
+#define GPIO_LOW_LEVEL          0x00000002
+#define GPIO_HIGH_LEVEL         0x00000006
+
+#define GPIO_STRENGTH_2MA       0x00000001
+#define GPIO_STRENGTH_4MA       0x00000002
+#define GPIO_STRENGTH_8MA       0x00000066
+#define GPIO_PIN_TYPE_STD       0x00000008
+#define GPIO_PIN_TYPE_STD_WPU   0x0000000A
+#define GPIO_PIN_TYPE_STD_WPD   0x0000000C
+
+void GPIOPinTypeGPIOInput(uint32_t port, uint8_t pins);
+void GPIOPinTypeGPIOOutput(uint32_t port, uint8_t pins);
+void GPIOPadConfigSet(uint32_t port, uint8_t pins, uint32_t strength, uint32_t padType);
+int32_t GPIOPinRead(uint32_t port, uint8_t pins);
+void GPIOPinWrite(uint32_t port, uint8_t pins, uint8_t val);
+void GPIOIntTypeSet(uint32_t port, uint8_t pins, uint32_t intType);
+void GPIOIntEnable(uint32_t port, uint32_t intFlags);
+void GPIOIntDisable(uint32_t port, uint32_t intFlags);
+uint32_t GPIOIntStatus(uint32_t port, bool masked);
+void GPIOIntClear(uint32_t port, uint32_t intFlags);
+
+#endif /* GPIO_H */
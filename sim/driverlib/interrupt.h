@@ -0,0 +1,19 @@
+/**
+ * interrupt.h - Simulator stand-in for the TivaWare header
+ */
+
+#ifndef INTERRUPT_H
+#define INTERRUPT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void IntRegister(uint32_t interrupt, void (*handler)(void));
+void IntPrioritySet(uint32_t interrupt, uint8_t priority);
+void IntEnable(uint32_t interrupt);
+void IntDisable(uint32_t interrupt);
+void IntPendSet(uint32_t interrupt);
+bool IntMasterEnable(void);
+bool IntMasterDisable(void);
+
+#endif /* INTERRUPT_H */
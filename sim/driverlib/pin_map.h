@@ -0,0 +1,8 @@
+/**
+ * pin_map.h - Simulator stand-in for the TivaWare header (no pin muxing)
+ */
+
+#ifndef PIN_MAP_H
+#define PIN_MAP_H
+
+#endif /* PIN_MAP_H */
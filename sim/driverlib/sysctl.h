@@ -0,0 +1,33 @@
+/**
+ * sysctl.h - Simulator stand-in for the TivaWare header
+ */
+
+#ifndef SYSCTL_H
+#define SYSCTL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SYSCTL_OSC_INT          0x00000010
+#define SYSCTL_USE_PLL          0x00000000
+#define SYSCTL_CFG_VCO_480      0xF1000000
+
+#define SYSCTL_PERIPH_TIMER0    0xF0000400
+#define SYSCTL_PERIPH_TIMER1    0xF0000401
+#define SYSCTL_PERIPH_TIMER2    0xF0000402
+#define SYSCTL_PERIPH_TIMER3    0xF0000403
+#define SYSCTL_PERIPH_TIMER4    0xF0000404
+#define SYSCTL_PERIPH_TIMER5    0xF0000405
+#define SYSCTL_PERIPH_GPIOJ     0xF0000808
+#define SYSCTL_PERIPH_GPIOK     0xF0000809
+#define SYSCTL_PERIPH_GPIOL     0xF000080A
+#define SYSCTL_PERIPH_GPIOM     0xF000080B
+#define SYSCTL_PERIPH_GPIOP     0xF000080D
+
+uint32_t SysCtlClockFreqSet(uint32_t config, uint32_t sysClock);
+void SysCtlDelay(uint32_t count);
+void SysCtlPeripheralEnable(uint32_t peripheral);
+bool SysCtlPeripheralReady(uint32_t peripheral);
+void SysCtlSleep(void);
+
+#endif /* SYSCTL_H */
@@ -0,0 +1,34 @@
+/**
+ * timer.h - Simulator stand-in for the TivaWare header
+ *
+ * Full-width periodic (down-counting) and one-shot modes only.
+ */
+
+#ifndef TIMER_H
+#define TIMER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TIMER_A                 0x000000FF
+#define TIMER_B                 0x0000FF00
+#define TIMER_BOTH              0x0000FFFF
+
+#define TIMER_CFG_ONE_SHOT      0x00000021
+#define TIMER_CFG_PERIODIC      0x00000022
+
+#define TIMER_TIMA_TIMEOUT      0x00000001
+#define TIMER_TIMB_TIMEOUT      0x00000100
+
+void TimerConfigure(uint32_t base, uint32_t config);
+void TimerLoadSet(uint32_t base, uint32_t timer, uint32_t value);
+uint32_t TimerLoadGet(uint32_t base, uint32_t timer);
+void TimerEnable(uint32_t base, uint32_t timer);
+void TimerDisable(uint32_t base, uint32_t timer);
+uint32_t TimerValueGet(uint32_t base, uint32_t timer);
+void TimerIntEnable(uint32_t base, uint32_t intFlags);
+void TimerIntDisable(uint32_t base, uint32_t intFlags);
+void TimerIntClear(uint32_t base, uint32_t intFlags);
+uint32_t TimerIntStatus(uint32_t base, bool masked);
+
+#endif /* TIMER_H */
@@ -0,0 +1,287 @@
+/**
+ * driverlib_mock.c - TivaWare driverlib calls used by the firmware,
+ * implemented on the simulated peripherals
+ *
+ * Each call is a charge point of SIM_DRIVERLIB_CYCLES. State changes are
+ * applied before the charge, so e.g. IntMasterEnable() lets a pending
+ * interrupt in right away, like the real CPSIE.
+ */
+
+#ifdef HOST_BUILD
+
+#include "sim.h"
+#include "sim_hw.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/gpio.h"
+#include "driverlib/timer.h"
+#include "driverlib/interrupt.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// ============================================
+// SysCtl
+// ============================================
+
+uint32_t SysCtlClockFreqSet(uint32_t config, uint32_t sysClock)
+{
+    (void)config;
+    (void)sysClock;
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+    return SIM_CPU_HZ;
+}
+
+void SysCtlDelay(uint32_t count)
+{
+    // 3 cycles per loop iteration
+    Sim_Charge(3 * count);
+}
+
+void SysCtlPeripheralEnable(uint32_t peripheral)
+{
+    (void)peripheral;
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+bool SysCtlPeripheralReady(uint32_t peripheral)
+{
+    (void)peripheral;
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+    return true;
+}
+
+void SysCtlSleep(void)
+{
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+    Sim_Sleep();
+}
+
+// ============================================
+// GPIO
+// ============================================
+
+void GPIOPinTypeGPIOInput(uint32_t port, uint8_t pins)
+{
+    Sim_Port(port)->dir &= ~(uint32_t)pins;
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+void GPIOPinTypeGPIOOutput(uint32_t port, uint8_t pins)
+{
+    Sim_Port(port)->dir |= pins;
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+void GPIOPadConfigSet(uint32_t port, uint8_t pins, uint32_t strength, uint32_t padType)
+{
+    (void)port;
+    (void)pins;
+    (void)strength;
+    (void)padType;
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+int32_t GPIOPinRead(uint32_t port, uint8_t pins)
+{
+    SimGpio *p = Sim_Port(port);
+
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+    return (int32_t)(((p->level & ~p->dir) | (p->data & p->dir)) & pins);
+}
+
+void GPIOPinWrite(uint32_t port, uint8_t pins, uint8_t val)
+{
+    SimGpio *p = Sim_Port(port);
+
+    p->data = (p->data & ~(uint32_t)pins) | (val & pins);
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+void GPIOIntTypeSet(uint32_t port, uint8_t pins, uint32_t intType)
+{
+    SimGpio *p = Sim_Port(port);
+
+    p->both &= ~(uint32_t)pins;
+    p->rising &= ~(uint32_t)pins;
+    if (intType == GPIO_BOTH_EDGES)
+        p->both |= pins;
+    else if (intType == GPIO_RISING_EDGE)
+        p->rising |= pins;
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+void GPIOIntEnable(uint32_t port, uint32_t intFlags)
+{
+    Sim_Port(port)->im |= intFlags;
+    Sim_SourcesChanged();
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+void GPIOIntDisable(uint32_t port, uint32_t intFlags)
+{
+    Sim_Port(port)->im &= ~intFlags;
+    Sim_SourcesChanged();
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+uint32_t GPIOIntStatus(uint32_t port, bool masked)
+{
+    SimGpio *p = Sim_Port(port);
+
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+    return masked ? (p->ris & p->im) : p->ris;
+}
+
+void GPIOIntClear(uint32_t port, uint32_t intFlags)
+{
+    Sim_Port(port)->ris &= ~intFlags;
+    Sim_SourcesChanged();
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+// ============================================
+// Timer (full-width modes)
+// ============================================
+
+void TimerConfigure(uint32_t base, uint32_t config)
+{
+    SimTimer *t = Sim_Timer(base);
+
+    t->enabled = false;
+    t->periodic = (config == TIMER_CFG_PERIODIC);
+    t->load = 0xFFFFFFFF;
+    Sim_Reschedule();
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+void TimerLoadSet(uint32_t base, uint32_t timer, uint32_t value)
+{
+    SimTimer *t = Sim_Timer(base);
+
+    (void)timer;
+    t->load = value;
+    // Writing the load register of a running timer reloads it at timeout
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+uint32_t TimerLoadGet(uint32_t base, uint32_t timer)
+{
+    (void)timer;
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+    return Sim_Timer(base)->load;
+}
+
+void TimerEnable(uint32_t base, uint32_t timer)
+{
+    SimTimer *t = Sim_Timer(base);
+
+    (void)timer;
+    if (!t->enabled) {
+        t->enabled = true;
+        t->start = Sim_Now();
+        t->next = t->start + (uint64_t)t->load + 1;
+        Sim_Reschedule();
+    }
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+void TimerDisable(uint32_t base, uint32_t timer)
+{
+    (void)timer;
+    Sim_Timer(base)->enabled = false;
+    Sim_Reschedule();
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+uint32_t TimerValueGet(uint32_t base, uint32_t timer)
+{
+    SimTimer *t = Sim_Timer(base);
+    uint32_t value;
+
+    (void)timer;
+    if (!t->enabled)
+        value = t->load;
+    else
+        value = t->load - (uint32_t)((Sim_Now() - t->start) % ((uint64_t)t->load + 1));
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+    return value;
+}
+
+void TimerIntEnable(uint32_t base, uint32_t intFlags)
+{
+    Sim_Timer(base)->im |= intFlags;
+    Sim_SourcesChanged();
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+void TimerIntDisable(uint32_t base, uint32_t intFlags)
+{
+    Sim_Timer(base)->im &= ~intFlags;
+    Sim_SourcesChanged();
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+void TimerIntClear(uint32_t base, uint32_t intFlags)
+{
+    Sim_Timer(base)->ris &= ~intFlags;
+    Sim_SourcesChanged();
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+uint32_t TimerIntStatus(uint32_t base, bool masked)
+{
+    SimTimer *t = Sim_Timer(base);
+
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+    return masked ? (t->ris & t->im) : t->ris;
+}
+
+// ============================================
+// Interrupt controller
+// ============================================
+
+void IntRegister(uint32_t interrupt, void (*handler)(void))
+{
+    Sim_IntRegister(interrupt, handler);
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+void IntPrioritySet(uint32_t interrupt, uint8_t priority)
+{
+    Sim_IntPriority(interrupt, priority);
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+void IntEnable(uint32_t interrupt)
+{
+    Sim_IntEnable(interrupt, true);
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+void IntDisable(uint32_t interrupt)
+{
+    Sim_IntEnable(interrupt, false);
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+void IntPendSet(uint32_t interrupt)
+{
+    Sim_IntPend(interrupt);
+    Sim_Charge(SIM_DRIVERLIB_CYCLES);
+}
+
+bool IntMasterEnable(void)
+{
+    bool wasMasked = Sim_IntMaster(true);
+    Sim_Charge(2);
+    return wasMasked;
+}
+
+bool IntMasterDisable(void)
+{
+    bool wasMasked = Sim_IntMaster(false);
+    Sim_Charge(2);
+    return wasMasked;
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,11 @@
+/**
+ * hw_gpio.h - Simulator stand-in for the TivaWare header
+ */
+
+#ifndef HW_GPIO_H
+#define HW_GPIO_H
+
+#define GPIO_O_DATA         0x00000000
+#define GPIO_O_DIR          0x00000400
+
+#endif /* HW_GPIO_H */
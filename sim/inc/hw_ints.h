@@ -0,0 +1,28 @@
+/**
+ * hw_ints.h - Simulator stand-in for the TivaWare header
+ *
+ * Interrupt numbers (vector table index) of the TM4C1294.
+ */
+
+#ifndef HW_INTS_H
+#define HW_INTS_H
+
+#define INT_TIMER0A         35
+#define INT_TIMER0B         36
+#define INT_TIMER1A         37
+#define INT_TIMER1B         38
+#define INT_TIMER2A         39
+#define INT_TIMER2B         40
+#define INT_TIMER3A         51
+#define INT_TIMER3B         52
+#define INT_GPIOJ           67
+#define INT_TIMER4A         86
+#define INT_TIMER4B         87
+#define INT_TIMER5A         88
+#define INT_TIMER5B         89
+#define INT_GPIOP0          92
+#define INT_GPIOP1          93
+
+#define NUM_INTERRUPTS      130
+
+#endif /* HW_INTS_H */
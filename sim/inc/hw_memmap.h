@@ -0,0 +1,23 @@
+/**
+ * hw_memmap.h - Simulator stand-in for the TivaWare header
+ *
+ * Only the peripherals the firmware uses; values match the TM4C1294.
+ */
+
+#ifndef HW_MEMMAP_H
+#define HW_MEMMAP_H
+
+#define TIMER0_BASE         0x40030000
+#define TIMER1_BASE         0x40031000
+#define TIMER2_BASE         0x40032000
+#define TIMER3_BASE         0x40033000
+#define TIMER4_BASE         0x40034000
+#define TIMER5_BASE         0x40035000
+#define GPIO_PORTJ_BASE     0x40060000
+#define GPIO_PORTK_BASE     0x40061000
+#define GPIO_PORTL_BASE     0x40062000
+#define GPIO_PORTM_BASE     0x40063000
+#define GPIO_PORTN_BASE     0x40064000
+#define GPIO_PORTP_BASE     0x40065000
+
+#endif /* HW_MEMMAP_H */
@@ -0,0 +1,17 @@
+/**
+ * hw_types.h - Simulator stand-in for the TivaWare header
+ *
+ * Register accesses through HWREG() go to sim/sim.c instead of memory.
+ */
+
+#ifndef HW_TYPES_H
+#define HW_TYPES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+volatile uint32_t *Sim_HwReg(uint32_t addr);
+
+#define HWREG(x)    (*Sim_HwReg(x))
+
+#endif /* HW_TYPES_H */
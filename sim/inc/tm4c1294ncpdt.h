@@ -0,0 +1,22 @@
+/**
+ * tm4c1294ncpdt.h - Simulator stand-in for the TivaWare header
+ *
+ * Direct GPIO register accesses are charged and decoded by sim/sim.c
+ * (display bus strobes, scanline reads).
+ */
+
+#ifndef TM4C1294NCPDT_H
+#define TM4C1294NCPDT_H
+
+#include <stdint.h>
+#include "hw_memmap.h"
+#include "hw_gpio.h"
+
+volatile uint32_t *Sim_GpioReg(uint32_t base, uint32_t offset);
+
+#define GPIO_PORTK_DATA_R   (*Sim_GpioReg(GPIO_PORTK_BASE, GPIO_O_DATA))
+#define GPIO_PORTL_DATA_R   (*Sim_GpioReg(GPIO_PORTL_BASE, GPIO_O_DATA))
+#define GPIO_PORTM_DATA_R   (*Sim_GpioReg(GPIO_PORTM_BASE, GPIO_O_DATA))
+#define GPIO_PORTM_DIR_R    (*Sim_GpioReg(GPIO_PORTM_BASE, GPIO_O_DIR))
+
+#endif /* TM4C1294NCPDT_H */
@@ -0,0 +1,607 @@
+/**
+ * sim.c - Discrete-event simulation runtime: clock, NVIC, registers
+ *
+ * Time only moves at charge points. Sim_Charge() advances the clock to
+ * the next due event at most, runs it, and takes every pending interrupt
+ * whose priority beats the running context before the rest of the charge
+ * is spent - so an interrupt preempts the code at the first charge point
+ * after it pends, and nested preemption falls out of the C call stack.
+ */
+
+#ifdef HOST_BUILD
+
+#include "sim.h"
+#include "sim_hw.h"
+#include "stimulus.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_gpio.h"
+#include "driverlib/timer.h"
+#include "profile/cycles.h"
+#include "tearsync.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <setjmp.h>
+#include <math.h>
+
+#define THREAD_PRIORITY         8       /* below every 3-bit NVIC level */
+
+typedef struct {
+    void (*handler)(void);
+    const char *name;
+    uint8_t priority;
+    bool enabled;
+    bool pending;
+    uint64_t pendTime;
+    uint32_t count;
+    uint32_t overruns;          // pended again while still pending
+    uint64_t latencySum;
+    uint32_t latencyMax;
+    uint64_t cycles;            // exclusive of nested interrupts
+} SimIrq;
+
+SimGpio simGpio[SIM_PORTS];
+SimTimer simTimer[SIM_TIMERS];
+
+static uint64_t now;
+static uint64_t nextEvent;
+static uint64_t stopTime;
+static jmp_buf stopJump;
+
+static SimIrq irqs[NUM_INTERRUPTS];
+static bool primask = false;            // PRIMASK is clear out of reset
+static uint8_t runPriority = THREAD_PRIORITY;
+static bool irqReady;                   // a pending interrupt beats runPriority
+static uint64_t nestedCycles;           // ISR time inside the current ISR
+
+/* Main loop */
+static uint64_t loopStart;
+static uint64_t loopIterations;
+static uint64_t loopMax;
+static uint64_t loopSlept;              // asleep during the current pass
+static uint64_t idleCycles;
+static uint32_t sleeps;
+
+/* Watched work tick */
+static uint32_t tickIrq = NUM_INTERRUPTS;
+static bool (*tickRaised)(void);
+static bool tickOpen;
+static uint64_t tickTime;
+static uint32_t tickResponses;
+static uint64_t responseMin = UINT64_MAX, responseMax;
+static double responseSum, responseSq;
+
+/* Watched frame: tick -> main loop work done -> draw queue drained */
+static uint16_t (*framePending)(void);
+static bool frameOpen, frameWorkOpen;
+static uint64_t frameTick, frameWorkStart;
+static uint32_t frames, frameWorks, framesOverlapped;
+static uint64_t frameSum, frameMax, frameWorkSum, frameWorkMax;
+
+/* Display bus decoder (Port L strobes, Port M data) */
+static volatile uint32_t *lastSlot;
+static uint32_t lastValue;
+static uint32_t lastBase, lastOffset;
+static uint8_t busCommand;
+static uint16_t readLine;
+static uint8_t readIndex;
+static uint64_t busCommands, busTransfers, busReads;
+
+static void runEvents(void);
+static void takeInterrupts(void);
+static void tickTaken(void);
+
+// ============================================
+// Clock
+// ============================================
+
+uint64_t Sim_Now(void)
+{
+    return now;
+}
+
+void Sim_Charge(uint32_t cycles)
+{
+    uint64_t remaining = cycles;
+
+    if (tickOpen && !tickRaised())
+        tickTaken();
+
+    for (;;) {
+        if (irqReady) {
+            takeInterrupts();
+            continue;
+        }
+        if (now + remaining < nextEvent) {
+            now += remaining;
+            return;
+        }
+        remaining -= nextEvent - now;
+        now = nextEvent;
+        runEvents();
+    }
+}
+
+void Sim_Reschedule(void)
+{
+    uint64_t next = stopTime;
+    uint64_t stim = Stim_Next();
+    uint8_t i;
+
+    for (i = 0; i < SIM_TIMERS; i++)
+        if (simTimer[i].enabled && simTimer[i].next < next)
+            next = simTimer[i].next;
+    if (stim < next)
+        next = stim;
+    nextEvent = next;
+}
+
+static void runEvents(void)
+{
+    static const uint32_t timerIrq[SIM_TIMERS] = {
+        INT_TIMER0A, INT_TIMER1A, INT_TIMER2A, INT_TIMER3A, INT_TIMER4A, INT_TIMER5A
+    };
+    uint8_t i;
+
+    if (now >= stopTime)
+        longjmp(stopJump, 1);
+
+    for (i = 0; i < SIM_TIMERS; i++) {
+        SimTimer *t = &simTimer[i];
+        if (!t->enabled || t->next > now)
+            continue;
+        t->ris |= TIMER_TIMA_TIMEOUT;
+        if (t->im & TIMER_TIMA_TIMEOUT)
+            Sim_IntPend(timerIrq[i]);
+        if (t->periodic) {
+            t->start = t->next;
+            t->next += (uint64_t)t->load + 1;
+        } else {
+            t->enabled = false;
+        }
+    }
+    while (Stim_Next() <= now)
+        Stim_Run(now);
+
+    Sim_Reschedule();
+}
+
+// ============================================
+// NVIC
+// ============================================
+
+static void updateReady(void)
+{
+    uint32_t i;
+
+    irqReady = false;
+    if (primask)
+        return;
+    for (i = 0; i < NUM_INTERRUPTS; i++)
+        if (irqs[i].pending && irqs[i].enabled && irqs[i].priority < runPriority) {
+            irqReady = true;
+            return;
+        }
+}
+
+// Peripheral condition behind an interrupt line (level semantics)
+static bool sourceActive(uint32_t irq)
+{
+    switch (irq) {
+    case INT_TIMER0A: case INT_TIMER1A: case INT_TIMER2A:
+    case INT_TIMER3A: case INT_TIMER4A: case INT_TIMER5A: {
+        static const uint32_t bases[] = {
+            TIMER0_BASE, TIMER1_BASE, TIMER2_BASE, TIMER3_BASE, TIMER4_BASE, TIMER5_BASE
+        };
+        uint8_t n = (irq == INT_TIMER0A) ? 0 : (irq == INT_TIMER1A) ? 1 :
+                    (irq == INT_TIMER2A) ? 2 : (irq == INT_TIMER3A) ? 3 :
+                    (irq == INT_TIMER4A) ? 4 : 5;
+        SimTimer *t = Sim_Timer(bases[n]);
+        return (t->ris & t->im & TIMER_TIMA_TIMEOUT) != 0;
+    }
+    case INT_GPIOJ:
+        return (Sim_Port(GPIO_PORTJ_BASE)->ris & Sim_Port(GPIO_PORTJ_BASE)->im) != 0;
+    case INT_GPIOP0:
+        return (Sim_Port(GPIO_PORTP_BASE)->ris & Sim_Port(GPIO_PORTP_BASE)->im & 0x01) != 0;
+    case INT_GPIOP1:
+        return (Sim_Port(GPIO_PORTP_BASE)->ris & Sim_Port(GPIO_PORTP_BASE)->im & 0x02) != 0;
+    }
+    return false;
+}
+
+void Sim_IntRegister(uint32_t irq, void (*handler)(void))
+{
+    irqs[irq].handler = handler;
+}
+
+void Sim_IntPriority(uint32_t irq, uint8_t priority)
+{
+    irqs[irq].priority = priority >> 5;
+    updateReady();
+}
+
+void Sim_IntEnable(uint32_t irq, bool enable)
+{
+    irqs[irq].enabled = enable;
+    if (enable && sourceActive(irq))
+        Sim_IntPend(irq);
+    updateReady();
+}
+
+void Sim_IntPend(uint32_t irq)
+{
+    SimIrq *s = &irqs[irq];
+
+    if (s->pending) {
+        s->overruns++;
+        return;
+    }
+    s->pending = true;
+    s->pendTime = now;
+    if (s->enabled && !primask && s->priority < runPriority)
+        irqReady = true;
+}
+
+bool Sim_IntMaster(bool enable)
+{
+    bool wasMasked = primask;
+
+    primask = !enable;
+    updateReady();
+    return wasMasked;
+}
+
+void Sim_SourcesChanged(void)
+{
+    updateReady();
+}
+
+void Sim_NameIrq(uint32_t irq, const char *name)
+{
+    irqs[irq].name = name;
+}
+
+void Sim_WatchTick(uint32_t irq, bool (*raised)(void))
+{
+    tickIrq = irq;
+    tickRaised = raised;
+}
+
+void Sim_WatchFrame(uint16_t (*pending)(void))
+{
+    framePending = pending;
+}
+
+static void runIsr(uint32_t irq)
+{
+    SimIrq *s = &irqs[irq];
+    uint8_t savedPriority = runPriority;
+    uint64_t savedNested = nestedCycles;
+    uint64_t start = now;
+    uint64_t latency, total;
+    bool flagWasSet;
+
+    s->pending = false;
+    runPriority = s->priority;
+    nestedCycles = 0;
+    updateReady();
+
+    Sim_Charge(SIM_ISR_ENTRY_CYCLES);
+    latency = now - s->pendTime;
+    s->count++;
+    s->latencySum += latency;
+    if (latency > s->latencyMax)
+        s->latencyMax = (uint32_t)latency;
+
+    flagWasSet = irq == tickIrq && tickRaised();
+
+    if (s->handler)
+        s->handler();
+
+    // Raised by this tick: open until the main loop clears the flag
+    if (irq == tickIrq && !flagWasSet && tickRaised()) {
+        tickOpen = true;
+        tickTime = s->pendTime;
+    }
+
+    Sim_Charge(SIM_ISR_EXIT_CYCLES);
+
+    total = now - start;
+    s->cycles += total - nestedCycles;
+    nestedCycles = savedNested + total;
+    runPriority = savedPriority;
+
+    // Level-triggered: still asserted after the handler -> pends again
+    if (sourceActive(irq) && s->enabled)
+        Sim_IntPend(irq);
+    updateReady();
+}
+
+static void takeInterrupts(void)
+{
+    for (;;) {
+        uint32_t i, best = NUM_INTERRUPTS;
+
+        if (primask)
+            break;
+        for (i = 0; i < NUM_INTERRUPTS; i++) {
+            if (!irqs[i].pending || !irqs[i].enabled || irqs[i].priority >= runPriority)
+                continue;
+            // Equal priority: lowest exception number first
+            if (best == NUM_INTERRUPTS || irqs[i].priority < irqs[best].priority)
+                best = i;
+        }
+        if (best == NUM_INTERRUPTS)
+            break;
+        runIsr(best);
+    }
+    updateReady();
+}
+
+// ============================================
+// GPIO inputs
+// ============================================
+
+void Sim_GpioInput(uint32_t base, uint8_t pin, bool high)
+{
+    SimGpio *p = Sim_Port(base);
+    uint32_t mask = 1u << pin;
+    bool wasHigh = (p->level & mask) != 0;
+    bool edge;
+
+    if (wasHigh == high)
+        return;
+    p->level = high ? (p->level | mask) : (p->level & ~mask);
+
+    if (p->both & mask)
+        edge = true;
+    else if (p->rising & mask)
+        edge = high;
+    else
+        edge = !high;
+    if (!edge || !(p->im & mask))
+        return;
+
+    p->edges++;
+    if (p->ris & mask) {
+        p->lost++;
+        return;
+    }
+    p->ris |= mask;
+
+    if (base == GPIO_PORTP_BASE)
+        Sim_IntPend(pin == 0 ? INT_GPIOP0 : INT_GPIOP1);
+    else if (base == GPIO_PORTJ_BASE)
+        Sim_IntPend(INT_GPIOJ);
+}
+
+// ============================================
+// Registers
+// ============================================
+
+// A store is only visible once the firmware has written through the
+// pointer, so each access first looks at what happened to the previous one
+static void commitLast(void)
+{
+    uint32_t value;
+
+    if (!lastSlot)
+        return;
+    value = *lastSlot;
+    lastSlot = NULL;
+    if (value == lastValue || lastBase != GPIO_PORTL_BASE || lastOffset != GPIO_O_DATA)
+        return;
+
+    if (value == 0x11) {
+        busCommand = (uint8_t)Sim_Port(GPIO_PORTM_BASE)->data;
+        busCommands++;
+        if (busCommand == GET_SCANLINE) {
+            readLine = (uint16_t)((now / TEAR_LINE_CYCLES) % TEAR_VT);
+            readIndex = 0;
+        }
+    } else if (value == 0x15) {
+        busTransfers++;
+    }
+}
+
+volatile uint32_t *Sim_GpioReg(uint32_t base, uint32_t offset)
+{
+    SimGpio *p;
+    volatile uint32_t *slot;
+
+    Sim_Charge(SIM_GPIO_ACCESS_CYCLES);
+    commitLast();
+
+    p = Sim_Port(base);
+    slot = (offset == GPIO_O_DIR) ? &p->dir : &p->data;
+
+    // Port M turned around with RD low: the controller drives the bus
+    if (base == GPIO_PORTM_BASE && offset == GPIO_O_DATA && p->dir == 0 &&
+        Sim_Port(GPIO_PORTL_BASE)->data == 0x16) {
+        p->data = (busCommand == GET_SCANLINE && readIndex++ == 0) ? (readLine >> 8) : (readLine & 0xFF);
+        busReads++;
+    }
+
+    lastSlot = slot;
+    lastValue = *slot;
+    lastBase = base;
+    lastOffset = offset;
+    return slot;
+}
+
+volatile uint32_t *Sim_HwReg(uint32_t addr)
+{
+    static volatile uint32_t scratch;
+
+    Sim_Charge(1);
+    // The core clock stops in sleep, and CYCCNT with it
+    if (addr == DWT_CYCCNT)
+        scratch = (uint32_t)(now - idleCycles);
+    return &scratch;
+}
+
+// ============================================
+// Main loop and run control
+// ============================================
+
+// The main loop cleared the tick flag since the last charge point
+static void tickTaken(void)
+{
+    uint64_t response = now - tickTime;
+
+    tickOpen = false;
+    tickResponses++;
+    responseSum += (double)response;
+    responseSq += (double)response * (double)response;
+    if (response < responseMin) responseMin = response;
+    if (response > responseMax) responseMax = response;
+
+    if (framePending) {
+        if (frameOpen)
+            framesOverlapped++;
+        frameOpen = frameWorkOpen = true;
+        frameTick = tickTime;
+        frameWorkStart = now;
+    }
+}
+
+// Back at the top of the main loop: the frame's work is done, and the
+// frame is on the screen once the draw queue has run empty
+static void frameCheck(void)
+{
+    if (frameWorkOpen) {
+        uint64_t work = now - frameWorkStart;
+        frameWorkOpen = false;
+        frameWorks++;
+        frameWorkSum += work;
+        if (work > frameWorkMax)
+            frameWorkMax = work;
+    }
+    if (frameOpen && framePending() == 0) {
+        uint64_t frame = now - frameTick;
+        frameOpen = false;
+        frames++;
+        frameSum += frame;
+        if (frame > frameMax)
+            frameMax = frame;
+    }
+}
+
+void Sim_MainLoop(void)
+{
+    if (framePending)
+        frameCheck();
+
+    if (loopStart) {
+        uint64_t len = now - loopStart - loopSlept;
+        loopIterations++;
+        if (len > loopMax)
+            loopMax = len;
+    }
+
+    Sim_Charge(SIM_LOOP_CYCLES);
+    loopStart = now;
+    loopSlept = 0;
+}
+
+void Sim_Sleep(void)
+{
+    uint64_t start = now;
+    uint32_t i;
+
+    // Going to sleep: the frame's work is done
+    if (framePending)
+        frameCheck();
+
+    // WFI: wake on any enabled interrupt going pending, masked or not
+    for (;;) {
+        for (i = 0; i < NUM_INTERRUPTS; i++)
+            if (irqs[i].pending && irqs[i].enabled)
+                break;
+        if (i < NUM_INTERRUPTS)
+            break;
+        now = nextEvent;
+        runEvents();
+    }
+    idleCycles += now - start;
+    loopSlept += now - start;
+    sleeps++;
+}
+
+void Sim_Run(uint64_t cycles, void (*entry)(void))
+{
+    stopTime = cycles;
+    Sim_Reschedule();
+    if (setjmp(stopJump) == 0)
+        entry();
+    commitLast();
+    now = stopTime;
+}
+
+// ============================================
+// Report
+// ============================================
+
+static double us(uint64_t cycles)
+{
+    return (double)cycles * 1e6 / SIM_CPU_HZ;
+}
+
+uint32_t Sim_Report(void)
+{
+    uint32_t i, lost = 0;
+
+    printf("\n%-14s %4s %9s %11s %11s %9s %7s\n",
+           "interrupt", "prio", "count", "lat mean", "lat max", "overruns", "CPU");
+    for (i = 0; i < NUM_INTERRUPTS; i++) {
+        const SimIrq *s = &irqs[i];
+        char fallback[16];
+        if (!s->handler)
+            continue;
+        snprintf(fallback, sizeof(fallback), "irq %u", i);
+        printf("%-14s %4u %9u %9.2fus %9.2fus %9u %6.2f%%\n",
+               s->name ? s->name : fallback, s->priority << 5, s->count,
+               s->count ? us(s->latencySum) / s->count : 0.0, us(s->latencyMax),
+               s->overruns, 100.0 * s->cycles / now);
+    }
+
+    printf("\nmain loop      %llu passes, longest %.2f ms, asleep %.1f%% in %u sleeps\n",
+           (unsigned long long)loopIterations, us(loopMax) / 1000.0,
+           100.0 * idleCycles / now, sleeps);
+
+    if (tickRaised) {
+        double mean = tickResponses ? responseSum / tickResponses : 0.0;
+        double var = tickResponses ? responseSq / tickResponses - mean * mean : 0.0;
+        printf("work tick      %u served, response %.2f / %.2f / %.2f us "
+               "(min/mean/max), jitter %.2f us rms\n",
+               tickResponses,
+               tickResponses ? us(responseMin) : 0.0, us((uint64_t)mean), us(responseMax),
+               us((uint64_t)sqrt(var > 0.0 ? var : 0.0)));
+    }
+
+    if (framePending) {
+        printf("frame          %u drawn, work %.2f / %.2f ms, tick to drawn %.2f / %.2f ms "
+               "(mean/max), %u overlapped\n",
+               frames, frameWorks ? us(frameWorkSum) / 1000.0 / frameWorks : 0.0,
+               us(frameWorkMax) / 1000.0, frames ? us(frameSum) / 1000.0 / frames : 0.0,
+               us(frameMax) / 1000.0, framesOverlapped);
+    }
+
+    for (i = 0; i < SIM_PORTS; i++) {
+        if (!simGpio[i].edges)
+            continue;
+        printf("GPIO port %c    %u edges while enabled, %u lost (RIS still set)\n",
+               "JKLMNPQ"[i < 7 ? i : 6], simGpio[i].edges, simGpio[i].lost);
+        lost += simGpio[i].lost;
+    }
+
+    printf("display bus    %llu commands, %llu data transfers, %llu reads\n",
+           (unsigned long long)busCommands, (unsigned long long)busTransfers,
+           (unsigned long long)busReads);
+
+    return lost;
+}
+
+#endif /* HOST_BUILD */
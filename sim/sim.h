@@ -0,0 +1,92 @@
+/**
+ * sim.h - Discrete-event simulation runtime for the firmware on Linux
+ *
+ * The unmodified firmware (main.c, Sensor/, display/) is compiled for the
+ * host against the stand-in TivaWare headers in sim/inc and
+ * sim/driverlib. Every register access and driverlib call is a charge
+ * point: it advances a virtual 120 MHz cycle clock, runs peripheral
+ * events that fell due (timer timeouts, encoder edges, button presses)
+ * and lets pending interrupts preempt the running code by NVIC priority,
+ * exactly at that simulated time. Charges come from the target cost
+ * model (profile/costmodel.h): the display bus, which dominates, per GPIO
+ * store, computation where the firmware marks it with COST_CHARGE().
+ *
+ * Build and run from the project root (host gcc, no TivaWare needed):
+ *
+ *     gcc -DHOST_BUILD -Dmain=firmware_main -O2 -Isim -I. -Idisplay \
+ *         sim/sim.c sim/driverlib_mock.c sim/stimulus.c sim/sim_main.c \
+ *         main.c sched/sched.c input/input.c Sensor/Sensor.c Sensor/filter.c \
+ *         Sensor/tracker.c Sensor/calib.c Sensor/poles.c display/display.c \
+ *         display/drawqueue.c display/fastlane.c display/tearsync.c display/bus_gpio.c \
+ *         display/stripchart.c display/assets_rle.c profile/trace.c -lm -o tachosim
+ *     ./tachosim -t 10 -p 0:0,2:15000,6:15000,8:0 -b 3.5
+ *
+ * Add -DTRACE_ENABLE=1 to record the timeline trace (tachosim -T).
+ *
+ * -Dmain=firmware_main lets sim_main.c own the process entry point;
+ * -Isim must come first so the stand-in headers shadow TivaWare.
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "profile/costmodel.h"
+
+#define SIM_CPU_HZ              COST_CPU_HZ
+
+/* Top of every main loop pass: loop statistics and the frame metric */
+#define MAIN_LOOP_HOOK()        Sim_MainLoop()
+
+void Sim_MainLoop(void);
+
+/**
+ * WFI: jump ahead to the next enabled interrupt going pending, PRIMASK
+ * notwithstanding (the SysCtlSleep() mock)
+ */
+void Sim_Sleep(void);
+
+/**
+ * Charge cycles to the running context (thread or ISR); a charge point
+ */
+void Sim_Charge(uint32_t cycles);
+
+/**
+ * Virtual cycle clock
+ */
+uint64_t Sim_Now(void);
+
+/**
+ * Run entry() until the clock reaches `cycles`, then return
+ */
+void Sim_Run(uint64_t cycles, void (*entry)(void));
+
+/**
+ * Treat irq as the periodic work tick of the main loop: a tick after
+ * which raised() turns true starts a work item, and the time from that
+ * tick to raised() turning false again (the main loop took the work) is
+ * the main loop response (jitter) measurement
+ */
+void Sim_WatchTick(uint32_t irq, bool (*raised)(void));
+
+/**
+ * Measure frames of the watched tick: work = tick taken to the next main
+ * loop pass, drawn = tick to the first pass that finds pending() == 0
+ * (e.g. DrawQueue_Depth). Times are target time as far as the cost
+ * model (profile/costmodel.h) is right.
+ */
+void Sim_WatchFrame(uint16_t (*pending)(void));
+
+/**
+ * Name an interrupt in the report
+ */
+void Sim_NameIrq(uint32_t irq, const char *name);
+
+/**
+ * Print interrupt, main loop and bus statistics. Returns the number of
+ * lost GPIO edges (0 = healthy).
+ */
+uint32_t Sim_Report(void);
+
+#endif /* SIM_H */
@@ -0,0 +1,70 @@
+/**
+ * sim_hw.h - Simulated peripheral state shared by the runtime, the
+ * driverlib stand-ins and the stimulus generators
+ */
+
+#ifndef SIM_HW_H
+#define SIM_HW_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "profile/costmodel.h"
+
+/* Cost model (CPU cycles, profile/costmodel.h) */
+#define SIM_GPIO_ACCESS_CYCLES  COST_GPIO_STORE     /* direct register load/store */
+#define SIM_DRIVERLIB_CYCLES    COST_DRIVERLIB_CALL /* driverlib call incl. register access */
+#define SIM_ISR_ENTRY_CYCLES    COST_ISR_ENTRY      /* exception stacking */
+#define SIM_ISR_EXIT_CYCLES     COST_ISR_EXIT       /* unstacking */
+#define SIM_LOOP_CYCLES         8                   /* one idle main loop pass */
+
+#define SIM_PORTS               16      /* GPIO ports J..Q by (base >> 12) & 15 */
+#define SIM_TIMERS              6
+
+typedef struct {
+    uint32_t data;          // output latch / last value read
+    uint32_t dir;
+    uint32_t level;         // input pin levels driven by the stimulus
+    uint32_t both;          // pins interrupting on both edges
+    uint32_t rising;        // pins interrupting on rising edges only
+    uint32_t ris, im;       // raw and masked interrupt status
+    uint32_t edges;         // edges seen while the pin interrupt was enabled
+    uint32_t lost;          // edges that found the pin's RIS still set
+} SimGpio;
+
+typedef struct {
+    bool enabled;
+    bool periodic;
+    uint32_t load;
+    uint64_t start;         // cycle the counter was (re)loaded
+    uint64_t next;          // next timeout
+    uint32_t ris, im;
+} SimTimer;
+
+extern SimGpio simGpio[SIM_PORTS];
+extern SimTimer simTimer[SIM_TIMERS];
+
+static inline SimGpio *Sim_Port(uint32_t base)
+{
+    return &simGpio[(base >> 12) & (SIM_PORTS - 1)];
+}
+
+static inline SimTimer *Sim_Timer(uint32_t base)
+{
+    return &simTimer[(base >> 12) & 0x7];
+}
+
+/* NVIC */
+void Sim_IntRegister(uint32_t irq, void (*handler)(void));
+void Sim_IntPriority(uint32_t irq, uint8_t priority);
+void Sim_IntEnable(uint32_t irq, bool enable);
+void Sim_IntPend(uint32_t irq);
+bool Sim_IntMaster(bool enable);        // returns previous PRIMASK
+
+/* Peripheral state changed: re-check sources and timer schedule */
+void Sim_SourcesChanged(void);
+void Sim_Reschedule(void);
+
+/* Drive an input pin (stimulus); raises RIS on a configured edge */
+void Sim_GpioInput(uint32_t base, uint8_t pin, bool high);
+
+#endif /* SIM_HW_H */
@@ -0,0 +1,209 @@
+/**
+ * sim_main.c - Command line front end of the firmware simulator
+ *
+ *     tachosim [-t seconds] [-r rpm | -p t:rpm,t:rpm,...] [-b t[:hold],...]
+ *
+ *   -t  simulated time (default 5 s, boot included)
+ *   -r  constant wheel rate
+ *   -p  piecewise-linear RPM profile, e.g. 0:0,2:15000,6:15000,8:0
+ *   -b  PJ0 button presses at these times, held `hold` seconds (default
+ *       0.2), e.g. 3:1.5 for a long press
+ *   -T  write the trace ring (profile/trace.h) to this file at the end;
+ *       needs a build with -DTRACE_ENABLE=1 profile/trace.c
+ *
+ * Exit status 1 if a task missed a deadline or a sensor edge was lost,
+ * so sweeps over profiles can be scripted. See sim.h for the build line.
+ */
+
+#ifdef HOST_BUILD
+
+#undef main
+
+#include "sim.h"
+#include "sim_hw.h"
+#include "stimulus.h"
+#include "inc/hw_ints.h"
+#include "Sensor/Sensor.h"
+#include "display/drawqueue.h"
+#include "display/fastlane.h"
+#include "profile/trace.h"
+#include "sched/sched.h"
+#include "input/input.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Firmware side (main.c compiled with -Dmain=firmware_main) */
+int firmware_main(void);
+extern uint8_t dashboardTask;
+extern volatile uint32_t bootToFirstFrameCycles;
+
+static void runFirmware(void)
+{
+    firmware_main();
+}
+
+// The dashboard task opens each 100 ms slot of display work
+static bool dashboardReleased(void)
+{
+    const SchedTask *t = Sched_GetTask(dashboardTask);
+    return t && t->ready;
+}
+
+// Per-task scheduler statistics; returns the deadline misses
+static uint32_t reportTasks(void)
+{
+    const SchedTask *t;
+    uint32_t misses = 0;
+    uint8_t i;
+
+    printf("\n%-14s %4s %7s %8s %7s %7s %9s %10s %10s\n", "task", "prio", "period",
+           "deadline", "runs", "misses", "overruns", "run mean", "run max");
+    for (i = 0; (t = Sched_GetTask(i)) != NULL; i++) {
+        char period[16];
+        if (t->period)
+            snprintf(period, sizeof(period), "%ums", t->period * 1000 / SCHED_TICK_HZ);
+        else
+            snprintf(period, sizeof(period), "event");
+        printf("%-14s %4u %7s %6ums %7u %7u %9u %8.2fus %8.2fus\n", t->name, t->priority,
+               period, t->deadline * 1000 / SCHED_TICK_HZ, t->runs, t->misses, t->overruns,
+               t->runs ? COST_US(t->cyclesSum) / t->runs : 0.0, COST_US(t->cyclesMax));
+        misses += t->misses;
+    }
+
+    // The firmware's own account, to check against the simulator's
+    {
+        const SchedLoad *load = Sched_GetLoad();
+        uint64_t total = load->busyCycles + load->idleCycles;
+        printf("\nscheduler      busy %.1f%%, asleep %.1f%% in %u sleeps\n",
+               total ? 100.0 * load->busyCycles / total : 0.0,
+               total ? 100.0 * load->idleCycles / total : 0.0, load->sleeps);
+    }
+    printf("\n");
+    return misses;
+}
+
+// Gestures per button
+static void reportInput(void)
+{
+    const InputButton *b;
+    uint8_t i;
+
+    for (i = 0; (b = Input_GetButton(i)) != NULL; i++)
+        printf("input %-8s %u presses, %u releases, %u clicks, %u doubles, %u long\n",
+               b->name, b->events[INPUT_PRESS], b->events[INPUT_RELEASE],
+               b->events[INPUT_CLICK], b->events[INPUT_DOUBLE], b->events[INPUT_LONG]);
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-t seconds] [-r rpm | -p t:rpm,...] [-b t[:hold],...] [-T trace.bin]\n", name);
+}
+
+static bool writeTrace(const char *path)
+{
+#if TRACE_ENABLE
+    FILE *f = fopen(path, "wb");
+    bool ok;
+
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    ok = fwrite(&traceBuffer, sizeof(traceBuffer), 1, f) == 1;
+    fclose(f);
+    printf("trace          %u events recorded%s, ring written to %s\n",
+           traceBuffer.count, traceBuffer.frozen ? " (frozen at a deadline miss)" : "", path);
+    return ok;
+#else
+    fprintf(stderr, "-T %s: built without -DTRACE_ENABLE=1\n", path);
+    return false;
+#endif
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = 5.0;
+    const char *traceFile = NULL;
+    char constant[32];
+    uint32_t problems, accepted;
+    int opt;
+
+    Stim_ParseProfile("0:0");
+    while ((opt = getopt(argc, argv, "t:r:p:b:T:")) != -1) {
+        switch (opt) {
+        case 't':
+            seconds = atof(optarg);
+            break;
+        case 'r':
+            snprintf(constant, sizeof(constant), "0:%s", optarg);
+            if (!Stim_ParseProfile(constant)) {
+                usage(argv[0]);
+                return 2;
+            }
+            break;
+        case 'p':
+            if (!Stim_ParseProfile(optarg)) {
+                fprintf(stderr, "bad profile '%s'\n", optarg);
+                return 2;
+            }
+            break;
+        case 'b': {
+            char *s = optarg;
+            while (*s) {
+                char *end;
+                double t = strtod(s, &end);
+                double hold = STIM_PRESS_SECONDS;
+                if (end != s && *end == ':') {
+                    s = end + 1;
+                    hold = strtod(s, &end);
+                }
+                if (end == s || !Stim_AddPress(t, hold)) {
+                    fprintf(stderr, "bad press list '%s'\n", optarg);
+                    return 2;
+                }
+                s = (*end == ',') ? end + 1 : end;
+            }
+            break;
+        }
+        case 'T':
+            traceFile = optarg;
+            break;
+        default:
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    Sim_NameIrq(INT_GPIOP0, "GPIOP0 (S1)");
+    Sim_NameIrq(INT_GPIOP1, "GPIOP1 (S2)");
+    Sim_NameIrq(INT_TIMER0A, "Timer0A drain");
+    Sim_NameIrq(INT_TIMER1A, "Timer1A sched");
+    Sim_NameIrq(INT_GPIOJ, "GPIOJ button");
+    Sim_WatchTick(INT_TIMER1A, dashboardReleased);
+    Sim_WatchFrame(DrawQueue_Depth);
+
+    Sim_Run((uint64_t)(seconds * SIM_CPU_HZ), runFirmware);
+
+    printf("simulated %.3f s at %d MHz\n", seconds, SIM_CPU_HZ / 1000000);
+    printf("boot to first frame %.2f ms\n", bootToFirstFrameCycles * 1000.0 / SIM_CPU_HZ);
+    problems = Sim_Report() + reportTasks();
+
+    accepted = Sensor_GetEdgeCount(0);
+    printf("sensor         %u edges generated (boot included), %u interrupts, %u accepted\n",
+           Stim_Edges(), Sensor_GetInterruptCount(0), accepted);
+    printf("draw queue     high water %u, overflows %u, sync holds %u\n",
+           DrawQueue_HighWater(), DrawQueue_Overflows(), DrawQueue_SyncHolds());
+    printf("fast lane      max edge-to-pixel %.2f us\n",
+           FastLane_GetMaxLatency() * 1e6 / SIM_CPU_HZ);
+    reportInput();
+
+    if (traceFile && !writeTrace(traceFile))
+        return 2;
+    return problems ? 1 : 0;
+}
+
+#endif /* HOST_BUILD */
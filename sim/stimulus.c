@@ -0,0 +1,198 @@
+/**
+ * stimulus.c - Input waveforms for the simulated board
+ */
+
+#ifdef HOST_BUILD
+
+#include "stimulus.h"
+#include "sim.h"
+#include "sim_hw.h"
+#include "inc/hw_memmap.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <math.h>
+
+typedef struct {
+    double seconds;
+    double rpm;
+} RpmPoint;
+
+typedef struct {
+    uint64_t time;
+    bool high;
+} PinChange;
+
+static RpmPoint profile[STIM_MAX_POINTS];
+static uint8_t profileCount;
+
+#define STIM_CHANGES_PER_TRANSITION (2 * STIM_BOUNCES + 1)
+#define STIM_MAX_CHANGES        (2 * STIM_MAX_PRESSES * STIM_CHANGES_PER_TRANSITION)
+
+static PinChange button[STIM_MAX_CHANGES];
+static uint16_t buttonCount;
+static uint16_t buttonNext;
+
+/* Quadrature: (S1 << 1) | S2, forward order 11 -> 01 -> 00 -> 10 */
+static const uint8_t quadStates[4] = { 3, 1, 0, 2 };
+static uint8_t quadIndex;
+static uint64_t edgeTime;
+static bool edgeIsPoll;
+static bool started;
+static uint32_t edges;
+
+bool Stim_ParseProfile(const char *text)
+{
+    const char *s = text;
+
+    profileCount = 0;
+    while (*s) {
+        char *end;
+        if (profileCount >= STIM_MAX_POINTS)
+            return false;
+        profile[profileCount].seconds = strtod(s, &end);
+        if (end == s || *end != ':')
+            return false;
+        s = end + 1;
+        profile[profileCount].rpm = strtod(s, &end);
+        if (end == s)
+            return false;
+        if (profileCount && profile[profileCount].seconds < profile[profileCount - 1].seconds)
+            return false;
+        profileCount++;
+        s = end;
+        if (*s == ',')
+            s++;
+        else if (*s)
+            return false;
+    }
+    return profileCount > 0;
+}
+
+// Keep the change list in time order
+static void addChange(uint64_t time, bool high)
+{
+    uint8_t i;
+
+    button[buttonCount].time = time;
+    button[buttonCount].high = high;
+    buttonCount++;
+    for (i = buttonCount - 1; i > 0 && button[i].time < button[i - 1].time; i--) {
+        PinChange tmp = button[i];
+        button[i] = button[i - 1];
+        button[i - 1] = tmp;
+    }
+}
+
+// Settle at `high` after STIM_BOUNCES round trips back to the old level
+static void addTransition(uint64_t time, bool high)
+{
+    uint8_t i;
+
+    for (i = 0; i < STIM_BOUNCES; i++) {
+        addChange(time, high);
+        addChange(time + STIM_BOUNCE_CYCLES / 2, !high);
+        time += STIM_BOUNCE_CYCLES;
+    }
+    addChange(time, high);
+}
+
+bool Stim_AddPress(double seconds, double holdSeconds)
+{
+    uint64_t t = (uint64_t)(seconds * SIM_CPU_HZ);
+
+    if (buttonCount + 2 * STIM_CHANGES_PER_TRANSITION > STIM_MAX_CHANGES)
+        return false;
+    addTransition(t, false);
+    addTransition(t + (uint64_t)(holdSeconds * SIM_CPU_HZ), true);
+    return true;
+}
+
+uint32_t Stim_Edges(void)
+{
+    return edges;
+}
+
+static double rpmAt(uint64_t cycles)
+{
+    double t = (double)cycles / SIM_CPU_HZ;
+    uint8_t i;
+
+    if (!profileCount)
+        return 0.0;
+    if (t <= profile[0].seconds)
+        return profile[0].rpm;
+    for (i = 1; i < profileCount; i++) {
+        if (t <= profile[i].seconds) {
+            const RpmPoint *a = &profile[i - 1], *b = &profile[i];
+            double span = b->seconds - a->seconds;
+            if (span <= 0.0)
+                return b->rpm;
+            return a->rpm + (b->rpm - a->rpm) * (t - a->seconds) / span;
+        }
+    }
+    return profile[profileCount - 1].rpm;
+}
+
+// Next quadrature edge from `from`, at the rate there
+static void scheduleEdge(uint64_t from)
+{
+    double rpm = fabs(rpmAt(from));
+
+    if (rpm < 1.0) {
+        edgeTime = from + STIM_IDLE_POLL_CYCLES;
+        edgeIsPoll = true;
+        return;
+    }
+    edgeTime = from + (uint64_t)(60.0 * SIM_CPU_HZ / (rpm * STIM_EDGES_PER_REV));
+    edgeIsPoll = false;
+}
+
+static void start(void)
+{
+    // Pull-ups: both sensor lines and the button idle high
+    Sim_Port(GPIO_PORTP_BASE)->level |= 0x03;
+    Sim_Port(GPIO_PORTJ_BASE)->level |= 0x01;
+    quadIndex = 0;
+    scheduleEdge(0);
+    started = true;
+}
+
+uint64_t Stim_Next(void)
+{
+    uint64_t next;
+
+    if (!started)
+        start();
+    next = edgeTime;
+    if (buttonNext < buttonCount && button[buttonNext].time < next)
+        next = button[buttonNext].time;
+    return next;
+}
+
+void Stim_Run(uint64_t now)
+{
+    if (buttonNext < buttonCount && button[buttonNext].time <= now &&
+        button[buttonNext].time <= edgeTime) {
+        Sim_GpioInput(GPIO_PORTJ_BASE, 0, button[buttonNext].high);
+        buttonNext++;
+        return;
+    }
+
+    if (!edgeIsPoll) {
+        uint8_t old = quadStates[quadIndex];
+        uint8_t state;
+
+        quadIndex = (rpmAt(now) >= 0.0) ? (quadIndex + 1) & 3 : (quadIndex + 3) & 3;
+        state = quadStates[quadIndex];
+        // Exactly one line changes per quadrature step
+        if ((old ^ state) & 0x02)
+            Sim_GpioInput(GPIO_PORTP_BASE, 0, (state & 0x02) != 0);
+        else
+            Sim_GpioInput(GPIO_PORTP_BASE, 1, (state & 0x01) != 0);
+        edges++;
+    }
+    scheduleEdge(edgeTime);
+}
+
+#endif /* HOST_BUILD */
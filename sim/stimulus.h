@@ -0,0 +1,44 @@
+/**
+ * stimulus.h - Input waveforms for the simulated board
+ *
+ * KMZ60 quadrature on PP0/PP1 following a piecewise-linear RPM profile,
+ * and presses of the PJ0 button.
+ */
+
+#ifndef STIMULUS_H
+#define STIMULUS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define STIM_MAX_POINTS         32
+#define STIM_MAX_PRESSES        32
+#define STIM_EDGES_PER_REV      4       /* both edges of S1 and S2 */
+#define STIM_PRESS_SECONDS      0.2                 /* default hold */
+#define STIM_BOUNCES            3                   /* contact bounces per press or release */
+#define STIM_BOUNCE_CYCLES      (120000000 / 2000)  /* 0.5 ms apart */
+#define STIM_IDLE_POLL_CYCLES   (120000000 / 1000)  /* profile re-check at 0 RPM */
+
+/**
+ * Parse "t:rpm,t:rpm,..." (seconds, ascending). The rate is interpolated
+ * linearly between points and held after the last one; negative RPM
+ * turns the wheel backwards. Returns false on a malformed profile.
+ */
+bool Stim_ParseProfile(const char *text);
+
+/**
+ * Press PJ0 at `seconds` and release it `holdSeconds` later. Both
+ * transitions bounce STIM_BOUNCES times before settling.
+ */
+bool Stim_AddPress(double seconds, double holdSeconds);
+
+/**
+ * Edges generated so far (whether or not the firmware listened)
+ */
+uint32_t Stim_Edges(void);
+
+/* Runtime side: time of the next input change, and apply it */
+uint64_t Stim_Next(void);
+void Stim_Run(uint64_t now);
+
+#endif /* STIMULUS_H */
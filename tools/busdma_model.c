@@ -0,0 +1,275 @@
+/**
+ * busdma_model.c - Host model of the Timer3 + µDMA display bus engine
+ *
+ * Implements busdma_port.h on Linux: Timer3A/3B request events, the two
+ * ping-pong channels and the completion interrupt are simulated cycle by
+ * cycle, and every WR rising edge latches the Port M value into a log.
+ * display/busdma.c runs unmodified on top of it.
+ *
+ * For each workload the log is checked against the bytes the engine was
+ * asked to send, then the bus time and the CPU time spent by the engine
+ * (interrupts + setup) are compared with bit-banging the same bytes.
+ * A sweep over the completion interrupt latency shows how late the
+ * interrupt may be serviced before a chunk is lost.
+ *
+ * Build and run from the project root (host gcc, no TivaWare needed):
+ *
+ *     gcc -DHOST_BUILD -O2 -I. -Idisplay tools/busdma_model.c display/busdma.c -o busdma_model
+ *     ./busdma_model
+ *
+ * The exit status is non-zero if any workload is corrupted at the
+ * default latency.
+ */
+
+#ifdef HOST_BUILD
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+#include "busdma.h"
+#include "busdma_port.h"
+#include "profile/costmodel.h"
+
+/* CPU cost (cycles, profile/costmodel.h); the handler bodies are estimates */
+#define ISR_CYCLES              (COST_ISR_ENTRY + COST_ISR_EXIT + 128)  /* completion interrupt incl. re-arm */
+#define START_CYCLES            200                 /* BusDma_Fill/Write + port start */
+#define BITBANG_CYCLES_PER_BYTE COST_BITBANG_BYTE   /* write_data(): 3 stores + loop */
+
+#define MAX_LOG                 (800 * 480 * 3)
+
+typedef struct {
+    const uint8_t *src[2];
+    uint16_t count[2];
+    bool armed[2];
+    uint8_t active;
+    bool running;
+} Channel;
+
+static Channel dataCh, strobeCh;
+static uint16_t strobeIndex[2];
+static bool timerRunning;
+static uint64_t now, tickBase;
+static uint32_t tick;
+
+static uint32_t isrLatency;
+static uint64_t isrDue[4];
+static uint8_t isrPending;
+static uint32_t isrCount;
+
+static uint8_t portM, portL = 0x1F;
+static uint8_t *logBuf;
+static uint32_t logLen;
+
+// ============================================
+// busdma_port.h
+// ============================================
+
+void BusDmaPort_Init(uint32_t sysClock)
+{
+    (void)sysClock;
+}
+
+void BusDmaPort_Arm(uint8_t half, const uint8_t *src, uint16_t count)
+{
+    dataCh.src[half] = src;
+    dataCh.count[half] = count;
+    dataCh.armed[half] = true;
+    strobeCh.count[half] = count * 2;
+    strobeCh.armed[half] = true;
+    strobeIndex[half] = 0;
+}
+
+void BusDmaPort_Start(void)
+{
+    dataCh.active = strobeCh.active = 0;
+    dataCh.running = strobeCh.running = true;
+    timerRunning = true;
+    tickBase = now;
+    tick = 0;
+}
+
+void BusDmaPort_Stop(void)
+{
+    timerRunning = false;
+    dataCh.running = strobeCh.running = false;
+}
+
+// ============================================
+// Simulation
+// ============================================
+
+// One request on a channel. Returns false if the channel had nothing to
+// transfer; *done is set when the request finished its descriptor.
+static bool channelStep(Channel *ch, bool isStrobe, uint8_t *value, bool *done)
+{
+    uint8_t h = ch->active;
+
+    *done = false;
+    if (!ch->running || !ch->armed[h]) return false;
+
+    if (isStrobe)
+        *value = (strobeIndex[h]++ & 1) ? 0x1F : 0x15;
+    else
+        *value = *ch->src[h]++;
+
+    if (--ch->count[h] == 0) {
+        // Descriptor done: the controller flips to the other one, or stops
+        ch->armed[h] = false;
+        ch->active ^= 1;
+        if (!ch->armed[ch->active])
+            ch->running = false;
+        *done = true;
+    }
+    return true;
+}
+
+static void timerTick(void)
+{
+    uint8_t v;
+    bool done;
+
+    tick++;
+    // Timer3A times out every second Timer3B timeout and its channel has
+    // the higher priority, so the data byte lands before the strobe
+    if ((tick & 1) == 0 && channelStep(&dataCh, false, &v, &done))
+        portM = v;
+
+    if (channelStep(&strobeCh, true, &v, &done)) {
+        if (portL == 0x15 && v == 0x1F && logLen < MAX_LOG)
+            logBuf[logLen++] = portM;
+        portL = v;
+        if (done && isrPending < 4)
+            isrDue[isrPending++] = now + isrLatency;
+    }
+}
+
+// Advance simulated time until the engine reports the bus free.
+// Returns false if the bus went idle while the engine was still busy.
+static bool runUntilIdle(void)
+{
+    while (busDmaBusy) {
+        uint64_t nextTick = tickBase + (uint64_t)(tick + 1) * BUSDMA_STROBE_CYCLES;
+        bool channelsLive = dataCh.running || strobeCh.running;
+
+        if (isrPending && (!timerRunning || !channelsLive || isrDue[0] <= nextTick)) {
+            now = isrDue[0];
+            isrPending--;
+            memmove(isrDue, isrDue + 1, isrPending * sizeof(isrDue[0]));
+            isrCount++;
+            BusDma_ChunkDone();
+        } else if (timerRunning && channelsLive) {
+            now = nextTick;
+            timerTick();
+        } else {
+            BusDmaPort_Stop();
+            busDmaBusy = false;
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================
+// Workloads
+// ============================================
+
+typedef struct {
+    const char *name;
+    uint32_t pixels;        // fill: pixel count, stream: 0
+    uint32_t streamBytes;   // stream: byte count
+    uint32_t color;
+} Workload;
+
+static const Workload workloads[] = {
+    { "fill 64 px (min run)",      64,     0, 0x00FF7034 },
+    { "fill 36x36 shift light",    1296,   0, 0x00FF7034 },
+    { "fill 760 px strip row",     760,    0, 0x00662D15 },
+    { "fill 6x150 speed bar",      900,    0, 0x00000000 },
+    { "fill 800x480 screen",       384000, 0, 0x00662D15 },
+    { "stream 1021 bytes",         0,   1021, 0 },
+    { "stream 32x50 glyph rgb",    0,   4800, 0 },
+};
+
+#define WORKLOAD_COUNT (sizeof(workloads) / sizeof(workloads[0]))
+
+static uint8_t streamSrc[8192];
+
+// Run one workload; returns true if the latched bytes are exact
+static bool runWorkload(const Workload *w, uint64_t *busCycles, uint32_t *isrs, uint32_t *bytes)
+{
+    uint32_t i, expected;
+    bool ok;
+
+    logLen = 0;
+    isrCount = 0;
+    isrPending = 0;
+    now = 0;
+    memset(&dataCh, 0, sizeof(dataCh));
+    memset(&strobeCh, 0, sizeof(strobeCh));
+
+    if (w->pixels) {
+        BusDma_Fill(w->color >> 16, w->color >> 8, w->color, w->pixels);
+        expected = w->pixels * 3;
+    } else {
+        for (i = 0; i < w->streamBytes; i++)
+            streamSrc[i] = (uint8_t)(i * 7 + 3);
+        BusDma_Write(streamSrc, w->streamBytes);
+        expected = w->streamBytes;
+    }
+    ok = runUntilIdle() && logLen == expected;
+
+    for (i = 0; ok && i < expected; i++) {
+        uint8_t want = w->pixels ? (uint8_t)(w->color >> (16 - 8 * (i % 3))) : streamSrc[i];
+        if (logBuf[i] != want) ok = false;
+    }
+
+    *busCycles = now;
+    *isrs = isrCount;
+    *bytes = expected;
+    return ok;
+}
+
+int main(void)
+{
+    static const uint32_t latencies[] = { 0, 1000, 5000, 10000, 12000, 12500, 20000 };
+    uint64_t busCycles;
+    uint32_t isrs, bytes, i, j;
+    bool allOk = true;
+
+    logBuf = malloc(MAX_LOG);
+    BusDma_Init(120000000);
+
+    printf("strobe period %d cycles, chunk %d bytes, ISR latency 200 cycles\n\n",
+           BUSDMA_STROBE_CYCLES, BUSDMA_CHUNK_BYTES);
+    printf("%-26s %8s %10s %6s %12s %12s %s\n",
+           "workload", "bytes", "bus cyc", "ISRs", "engine CPU", "bitbang CPU", "check");
+
+    isrLatency = 200;
+    for (i = 0; i < WORKLOAD_COUNT; i++) {
+        bool ok = runWorkload(&workloads[i], &busCycles, &isrs, &bytes);
+        allOk &= ok;
+        printf("%-26s %8u %10llu %6u %12u %12u %s\n",
+               workloads[i].name, bytes, (unsigned long long)busCycles, isrs,
+               START_CYCLES + isrs * ISR_CYCLES, bytes * BITBANG_CYCLES_PER_BYTE,
+               ok ? "ok" : "CORRUPT");
+    }
+
+    printf("\nISR latency sweep (chunk time %d cycles):\n",
+           BUSDMA_CHUNK_BYTES * 2 * BUSDMA_STROBE_CYCLES);
+    for (j = 0; j < sizeof(latencies) / sizeof(latencies[0]); j++) {
+        uint32_t failures = 0;
+        isrLatency = latencies[j];
+        for (i = 0; i < WORKLOAD_COUNT; i++)
+            if (!runWorkload(&workloads[i], &busCycles, &isrs, &bytes))
+                failures++;
+        printf("  %6u cycles: %s\n", latencies[j],
+               failures ? "chunks lost" : "all workloads exact");
+    }
+
+    free(logBuf);
+    return allOk ? 0 : 1;
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,126 @@
+/**
+ * calib_bench.c - Check the edges-per-revolution calibration on traces
+ *
+ * Generates edge periods for rotors with 4 to 32 edges per revolution,
+ * each pole offset from its nominal angle, at steady, drifting and
+ * ramping speed with timestamp jitter, and runs them through
+ * Sensor/calib.c as the sensor does: one Calib_Edge() per edge, then
+ * Calib_Step() until the analysis is done. Also runs the traces it must
+ * not propose anything for: perfectly spaced poles, with and without
+ * timestamp jitter.
+ *
+ * Build and run from the project root (host gcc, no TivaWare needed):
+ *
+ *     gcc -DHOST_BUILD -O2 -I. tools/calib_bench.c Sensor/calib.c -lm -o calib_bench
+ *     ./calib_bench
+ *
+ * The exit status is non-zero if any trace gets the wrong answer.
+ */
+
+#ifdef HOST_BUILD
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include "Sensor/calib.h"
+
+#define TIMER_HZ                120000000.0
+#define STEP_US                 1.0     /* trace integration step */
+
+/* Cost model charge points in calib.c */
+void Sim_Charge(uint32_t cycles)
+{
+    (void)cycles;
+}
+
+typedef struct {
+    const char *name;
+    uint8_t edgesPerRev;
+    double fromRpm, toRpm;      // linear over the recording
+    double poleError;           // max relative pole offset
+    double jitterUs;            // timestamp jitter, uniform +-
+    uint8_t expect;             // edges per revolution, 0: must fail
+} Trace;
+
+static const Trace traces[] = {
+    { "4 steady",     4,  6000.0,  6000.0, 0.02, 1.0, 4 },
+    { "8 steady",     8,  3000.0,  3000.0, 0.02, 1.0, 8 },
+    { "12 drift",     12, 3000.0,  3300.0, 0.02, 1.0, 12 },
+    { "16 ramp",      16, 2000.0,  4000.0, 0.02, 1.0, 16 },
+    { "24 ramp",      24, 4000.0,  2000.0, 0.02, 1.0, 24 },
+    { "32 steady",    32, 1000.0,  1000.0, 0.01, 1.0, 32 },
+    { "8 small err",  8,  3000.0,  3000.0, 0.005, 1.0, 8 },
+    { "12 noisy",     12, 6000.0,  6000.0, 0.02, 10.0, 12 },
+    { "perfect",      8,  3000.0,  3000.0, 0.0,  0.0, 0 },
+    { "jitter only",  8,  3000.0,  3000.0, 0.0,  20.0, 0 },
+};
+
+static double uniform(void)
+{
+    return 2.0 * rand() / (double)RAND_MAX - 1.0;
+}
+
+// Edge n sits at (n + pole[n % edgesPerRev]) / edgesPerRev revolutions;
+// feed CALIB_EDGES periods (plus one to start from)
+static void run(const Trace *tr, Calib *c)
+{
+    double pole[CALIB_MAX_LAG];
+    double revs = 0.0, t = 0.0, dt = STEP_US * 1e-6, last = 0.0;
+    double seconds = (CALIB_EDGES + 1) * 60.0 / tr->edgesPerRev
+                   / (0.5 * (tr->fromRpm + tr->toRpm));
+    uint32_t n = 0;
+    int i;
+
+    for (i = 0; i < tr->edgesPerRev; i++)
+        pole[i] = tr->poleError * uniform();
+    pole[0] = 0.0;
+
+    Calib_Start(c);
+    while (c->state == CALIB_RECORDING) {
+        double rpm = tr->fromRpm + (tr->toRpm - tr->fromRpm) * t / seconds;
+        double step = rpm / 60.0 * dt;
+        double next = (n + pole[n % tr->edgesPerRev]) / tr->edgesPerRev;
+        if (revs + step >= next) {
+            double at = t + (next - revs) / step * dt + tr->jitterUs * 1e-6 * uniform();
+            if (n > 0)
+                Calib_Edge(c, (uint32_t)((at - last) * TIMER_HZ + 0.5));
+            last = at;
+            n++;
+            continue;
+        }
+        revs += step;
+        t += dt;
+    }
+    while (Calib_Step(c) == CALIB_ANALYSING) {}
+}
+
+int main(void)
+{
+    static Calib calib;
+    uint32_t s, wrong = 0;
+
+    printf("%-12s %6s %9s %9s %12s %8s\n", "trace", "edges", "expect", "proposed",
+           "correlation", "spread");
+    for (s = 0; s < sizeof(traces) / sizeof(traces[0]); s++) {
+        const Trace *tr = &traces[s];
+        uint8_t proposed;
+
+        srand(1 + s);
+        run(tr, &calib);
+        proposed = calib.state == CALIB_DONE ? calib.result.edgesPerRev : 0;
+
+        printf("%-12s %6u %9u %9u %12.2f %7.2f%%", tr->name, tr->edgesPerRev, tr->expect,
+               proposed, calib.result.correlation, calib.result.spread * 100.0);
+        if (proposed != tr->expect) {
+            printf("   WRONG");
+            wrong++;
+        }
+        printf("\n");
+    }
+
+    printf("\n%u of %u traces wrong\n", wrong, (unsigned)(sizeof(traces) / sizeof(traces[0])));
+    return wrong ? 1 : 0;
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,312 @@
+/**
+ * estimator_bench.c - Replay edge traces through the speed estimators
+ *
+ * Generates quadrature edge timestamps for a set of RPM profiles, with
+ * pole spacing errors and timestamp jitter, and replays them through
+ *
+ *   window   the counting window of Sensor_Process(): edges per 100 ms,
+ *            then the rate filter chain (Sensor/filter.c, the default
+ *            3-sample moving average)
+ *   tracker  the per-edge Kalman tracker (Sensor/tracker.c) with the
+ *            sensor's default tuning or -q / -m
+ *   edge     the last edge period with the learnt pole spacing divided
+ *            out (Sensor/poles.c)
+ *
+ * All are read every millisecond, as the sensor task runs, and compared
+ * with the true RPM at that instant:
+ *
+ *   step      3000 -> 9000 RPM: time to 90% of the step, overshoot
+ *   drop      9000 -> 3000 RPM: time to 90% of the step
+ *   ramp      2000 -> 12000 RPM in 2 s: mean lag behind the ramp
+ *   steady    6000 RPM, 2% pole errors: RMS error (jitter)
+ *   noisy     6000 RPM, 5% pole errors, 20 us timestamp jitter: RMS error
+ *
+ * The window mirrors Sensor_Process() rather than calling it, which needs
+ * the edge timer; keep the two in step.
+ *
+ * Build and run from the project root (host gcc, no TivaWare needed):
+ *
+ *     gcc -DHOST_BUILD -O2 -I. tools/estimator_bench.c Sensor/filter.c Sensor/tracker.c \
+ *         Sensor/poles.c -lm -o estimator_bench
+ *     ./estimator_bench [-q processNoise] [-m measurementNoise]
+ *
+ * The exit status is non-zero unless the tracker has both less latency
+ * (step, drop, ramp) and less jitter (steady, noisy) than the window,
+ * and overshoots a step by no more than MAX_OVERSHOOT: the readouts show
+ * the tracker, and an overshoot reads as a speed never reached.
+ * The edge column is for comparison: fastest of the three, but a single
+ * period carries all of its timestamp jitter.
+ */
+
+#ifdef HOST_BUILD
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include "Sensor/Sensor.h"
+#include "Sensor/filter.h"
+#include "Sensor/tracker.h"
+#include "Sensor/poles.h"
+
+#define TIMER_HZ                120000000.0
+#define EDGES_PER_REV           4
+#define STEP_US                 1.0     /* trace integration step */
+#define TICK_MS                 1       /* estimator readout, as the sensor task */
+#define WINDOW_MS               100     /* MIN_UPDATE_INTERVAL_US */
+#define STOPPED_MS              500     /* STOPPED_TIMEOUT_US */
+#define MIN_PERIOD_TICKS        1200    /* MIN_PERIOD_US at 120 MHz */
+#define MAX_EDGES               200000
+#define MAX_OVERSHOOT           0.02    /* of the step, tracker verdict */
+
+/* Cost model charge points in filter.c and tracker.c */
+void Sim_Charge(uint32_t cycles)
+{
+    (void)cycles;
+}
+
+typedef enum {
+    METRIC_RISE,                // ms to 90% of the step
+    METRIC_LAG,                 // ms behind the ramp
+    METRIC_RMS                  // RPM
+} Metric;
+
+typedef struct {
+    const char *name;
+    double (*rpm)(double t);
+    double seconds;
+    double poleError;           // max relative pole offset
+    double jitterUs;            // timestamp jitter, uniform +-
+    Metric metric;
+    double from, to;            // measured interval (s)
+} Scenario;
+
+typedef struct {
+    double value;
+    double overshoot;           // RISE: fraction of the step
+} Result;
+
+static double rpmStep(double t)   { return t < 1.0 ? 3000.0 : 9000.0; }
+static double rpmDrop(double t)   { return t < 1.0 ? 9000.0 : 3000.0; }
+static double rpmSteady(double t) { (void)t; return 6000.0; }
+static double rpmRamp(double t)
+{
+    if (t < 0.5)
+        return 2000.0;
+    if (t < 2.5)
+        return 2000.0 + (t - 0.5) * 5000.0;
+    return 12000.0;
+}
+
+static const Scenario scenarios[] = {
+    { "step",   rpmStep,   2.0, 0.02, 1.0,  METRIC_RISE, 1.0, 2.0 },
+    { "drop",   rpmDrop,   2.0, 0.02, 1.0,  METRIC_RISE, 1.0, 2.0 },
+    { "ramp",   rpmRamp,   3.0, 0.02, 1.0,  METRIC_LAG,  1.5, 2.5 },
+    { "steady", rpmSteady, 2.0, 0.02, 1.0,  METRIC_RMS,  0.5, 2.0 },
+    { "noisy",  rpmSteady, 2.0, 0.05, 20.0, METRIC_RMS,  0.5, 2.0 },
+};
+
+static double edgeTime[MAX_EDGES];     // seconds
+static uint32_t edgeTotal;
+
+static double uniform(void)
+{
+    return 2.0 * rand() / (double)RAND_MAX - 1.0;
+}
+
+// Edge n sits at (n + pole[n % 4]) / 4 revolutions
+static void generate(const Scenario *sc)
+{
+    double pole[EDGES_PER_REV];
+    double revs = 0.0, t = 0.0, dt = STEP_US * 1e-6;
+    uint32_t n = 0;
+    int i;
+
+    for (i = 0; i < EDGES_PER_REV; i++)
+        pole[i] = sc->poleError * uniform();
+    pole[0] = 0.0;
+
+    edgeTotal = 0;
+    while (t < sc->seconds && edgeTotal < MAX_EDGES) {
+        double step = sc->rpm(t) / 60.0 * dt;
+        double next = (n + pole[n % EDGES_PER_REV]) / EDGES_PER_REV;
+        if (revs + step >= next) {
+            double at = t + (next - revs) / step * dt;
+            edgeTime[edgeTotal++] = at + sc->jitterUs * 1e-6 * uniform();
+            n++;
+            continue;
+        }
+        revs += step;
+        t += dt;
+    }
+}
+
+static uint32_t ticksBetween(double from, double to)
+{
+    return (uint32_t)((to - from) * TIMER_HZ + 0.5);
+}
+
+// Readout every TICK_MS: window (which = 0), tracker (1) or single
+// compensated edges (2)
+static void replay(int which, const TrackerConfig *tuning,
+                   double *out, uint32_t ticks)
+{
+    static const FilterStageConfig chainConfig[] = {
+        { FILTER_AVERAGE, 3, 0.0f }
+    };
+    FilterChain chain;
+    Tracker tracker;
+    PoleTable poles;
+    double windowStart = 0.0, lastEdge = 0.0;
+    uint32_t windowEdges = 0, e = 0, k;
+    float rate = 0.0f;
+
+    Filter_Configure(&chain, chainConfig, 1);
+    Tracker_Init(&tracker, tuning, (float)TIMER_HZ, EDGES_PER_REV);
+    Poles_Init(&poles, (float)TIMER_HZ, EDGES_PER_REV);
+
+    for (k = 0; k < ticks; k++) {
+        double now = (k + 1) * TICK_MS * 1e-3;
+
+        // Edge interrupts up to now
+        for (; e < edgeTotal && edgeTime[e] <= now; e++) {
+            uint32_t period = ticksBetween(lastEdge, edgeTime[e]);
+            if (period <= MIN_PERIOD_TICKS)
+                continue;
+            lastEdge = edgeTime[e];
+            windowEdges++;
+            if (which == 1)
+                Tracker_Edge(&tracker, period);
+            else if (which == 2)
+                Poles_Edge(&poles, period);
+        }
+
+        if (which == 0) {
+            double elapsed = now - windowStart;
+            if (elapsed >= WINDOW_MS * 1e-3 && windowEdges > 0) {
+                rate = Filter_Apply(&chain, (float)(windowEdges / elapsed));
+                windowEdges = 0;
+                windowStart = now;
+            } else if (elapsed > STOPPED_MS * 1e-3) {
+                rate = 0.0f;
+                Filter_Reset(&chain);
+                windowEdges = 0;
+                windowStart = now;
+            }
+        } else if (which == 1) {
+            rate = Tracker_Rate(&tracker, ticksBetween(lastEdge, now));
+        } else {
+            rate = Poles_Rate(&poles, ticksBetween(lastEdge, now));
+        }
+        out[k] = rate * 60.0 / EDGES_PER_REV;
+    }
+}
+
+static Result measure(const Scenario *sc, const double *out, uint32_t ticks)
+{
+    Result r = { 0.0, 0.0 };
+    double sum = 0.0, sumSq = 0.0;
+    uint32_t n = 0, k;
+
+    for (k = 0; k < ticks; k++) {
+        double t = (k + 1) * TICK_MS * 1e-3;
+        double truth = sc->rpm(t);
+        if (t < sc->from || t >= sc->to)
+            continue;
+        sum += truth - out[k];
+        sumSq += (truth - out[k]) * (truth - out[k]);
+        n++;
+    }
+
+    switch (sc->metric) {
+    case METRIC_RISE: {
+        double before = sc->rpm(sc->from - 1e-3), after = sc->rpm(sc->from);
+        double span = after - before;
+        r.value = -1.0;
+        for (k = 0; k < ticks; k++) {
+            double t = (k + 1) * TICK_MS * 1e-3;
+            double moved = (out[k] - before) / span;
+            if (t < sc->from)
+                continue;
+            if (r.value < 0.0 && moved >= 0.9)
+                r.value = (t - sc->from) * 1e3;
+            if (moved - 1.0 > r.overshoot)
+                r.overshoot = moved - 1.0;
+        }
+        if (r.value < 0.0)
+            r.value = (sc->to - sc->from) * 1e3;
+        break;
+    }
+    case METRIC_LAG: {
+        double slope = (sc->rpm(sc->to) - sc->rpm(sc->from)) / (sc->to - sc->from);
+        r.value = sum / n / slope * 1e3;
+        break;
+    }
+    case METRIC_RMS:
+        r.value = sqrt(sumSq / n);
+        break;
+    }
+    return r;
+}
+
+static const char *unit(Metric m)
+{
+    return m == METRIC_RMS ? "RPM rms" : (m == METRIC_LAG ? "ms lag" : "ms to 90%");
+}
+
+int main(int argc, char **argv)
+{
+    static double out[3][4000];
+    TrackerConfig tuning = { SENSOR_TRACKER_PROCESS_NOISE, SENSOR_TRACKER_MEASUREMENT_NOISE };
+    uint32_t s, worse = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "q:m:")) != -1) {
+        if (opt == 'q') {
+            tuning.processNoise = strtof(optarg, NULL);
+        } else if (opt == 'm') {
+            tuning.measurementNoise = strtof(optarg, NULL);
+        } else {
+            fprintf(stderr, "usage: %s [-q processNoise] [-m measurementNoise]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("tracker: process noise %g, measurement noise %g\n\n",
+           tuning.processNoise, tuning.measurementNoise);
+    printf("%-8s %-10s %10s %10s %10s\n", "trace", "metric", "window", "tracker", "edge");
+
+    for (s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++) {
+        const Scenario *sc = &scenarios[s];
+        uint32_t ticks = (uint32_t)(sc->seconds * 1000.0 / TICK_MS);
+        Result r[3];
+        int which;
+
+        srand(1 + s);
+        generate(sc);
+        for (which = 0; which < 3; which++) {
+            replay(which, &tuning, out[which], ticks);
+            r[which] = measure(sc, out[which], ticks);
+        }
+
+        printf("%-8s %-10s %10.1f %10.1f %10.1f", sc->name, unit(sc->metric), r[0].value,
+               r[1].value, r[2].value);
+        if (sc->metric == METRIC_RISE)
+            printf("   overshoot %.1f%% / %.1f%% / %.1f%%", r[0].overshoot * 100.0,
+                   r[1].overshoot * 100.0, r[2].overshoot * 100.0);
+        if (fabs(r[1].value) >= fabs(r[0].value) || r[1].overshoot > MAX_OVERSHOOT) {
+            printf("   WORSE");
+            worse++;
+        }
+        printf("\n");
+    }
+
+    printf("\n%u of %u traces worse with the tracker\n", worse,
+           (unsigned)(sizeof(scenarios) / sizeof(scenarios[0])));
+    return worse ? 1 : 0;
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+"""
+gen_dashboard.py - Pre-render the static speedometer layer
+
+Renders every static ORANGE-on-BURNT_ORANGE element that
+InitSpeedometerDisplay() used to draw at boot (frame boxes, diagonal
+divider, labels, analog scale numbers, scale ring and tick marks) into
+display/assets/dashboard.pbm. img2rle.py then turns it into imgDashboard,
+which boot streams as one full-screen window.
+
+The geometry below replicates display.c exactly (MAP(), the sin_lut/
+cos_lut float scaling, writeLine()'s 2-pixel Bresenham, drawCircle()'s
+midpoint loop and drawBox()'s pixel count), so the pre-rendered layer is
+pixel-identical to the old incremental drawing. Edit the layout here,
+then run:
+
+    python3 tools/gen_dashboard.py && python3 tools/img2rle.py
+"""
+
+import os
+import re
+
+from img2rle import ASSET_DIR, ROOT, read_pbm
+
+MAX_X = 800
+MAX_Y = 480
+OUT = os.path.join(ASSET_DIR, "dashboard.pbm")
+
+
+def load_lut(name):
+    src = open(os.path.join(ROOT, "display", "display.c")).read()
+    body = re.search(r"\b%s\[\d+\]\s*=\s*\{(.*?)\};" % name, src, re.S).group(1)
+    return [int(v) for v in re.findall(r"-?\d+", body)]
+
+
+class Layer:
+    def __init__(self):
+        self.px = [[0] * MAX_X for _ in range(MAX_Y)]
+
+    def pixel(self, x, y, on=1):
+        if 0 <= x < MAX_X and 0 <= y < MAX_Y:
+            self.px[y][x] = on
+
+    def box(self, x_min, x_max, y_min, y_max):
+        # drawBox() opens an inclusive window but only writes
+        # (x_max - x_min) * (y_max - y_min) pixels into it
+        w = x_max - x_min + 1
+        for i in range((x_max - x_min) * (y_max - y_min)):
+            self.pixel(x_min + i % w, y_min + i // w)
+
+    def write_line(self, x0, y0, x1, y1):
+        steep = abs(y1 - y0) > abs(x1 - x0)
+        if steep:
+            x0, y0 = y0, x0
+            x1, y1 = y1, x1
+        if x0 > x1:
+            x0, x1 = x1, x0
+            y0, y1 = y1, y0
+        dx = x1 - x0
+        dy = abs(y1 - y0)
+        err = dx // 2
+        ystep = 1 if y0 < y1 else -1
+        while x0 <= x1:
+            if steep:
+                self.pixel(y0 + 1, x0)
+                self.pixel(y0, x0 + 1)
+            else:
+                self.pixel(x0 + 1, y0)
+                self.pixel(x0, y0 + 1)
+            err -= dy
+            if err < 0:
+                y0 += ystep
+                err += dx
+            x0 += 1
+
+    def circle(self, x0, y0, r):
+        f = 1 - r
+        ddf_x = 1
+        ddf_y = -2 * r
+        x = 0
+        y = r
+        for px, py in ((x0, y0 + r), (x0, y0 - r), (x0 + r, y0), (x0 - r, y0)):
+            self.pixel(px, py)
+        while x < y:
+            if f >= 0:
+                y -= 1
+                ddf_y += 2
+                f += ddf_y
+            x += 1
+            ddf_x += 2
+            f += ddf_x
+            for px, py in ((x0 + x, y0 + y), (x0 - x, y0 + y), (x0 + x, y0 - y), (x0 - x, y0 - y),
+                           (x0 + y, y0 + x), (x0 - y, y0 + x), (x0 + y, y0 - x), (x0 - y, y0 - x)):
+                self.pixel(px, py)
+
+    def image(self, x0, y0, rows, sx=0, width=None):
+        width = width if width is not None else len(rows[0])
+        for y, row in enumerate(rows):
+            for x in range(width):
+                self.pixel(x0 + x, y0 + y, row[sx + x])
+
+    def number16x24(self, x, y, number, digits):
+        for i, ch in enumerate(str(number)):
+            self.image(x + i * 13, y, digits, int(ch) * 16, 16)
+
+
+def cmap(v, in_min, in_max, out_min, out_max):
+    return (v - in_min) * (out_max - out_min) // (in_max - in_min) + out_min
+
+
+def trunc(v):
+    return int(v)
+
+
+def main():
+    sin_lut = load_lut("sin_lut")
+    cos_lut = load_lut("cos_lut")
+    _, _, digits = read_pbm(os.path.join(ASSET_DIR, "digits16x24.pbm"))
+    layer = Layer()
+
+    # Frame boxes
+    layer.box(210, 790, 195, 205)
+    layer.box(520, 530, 195, 479)
+    layer.box(270, 280, 195, 479)
+    layer.box(280, 520, 330, 333)
+
+    # Diagonal divider
+    for l in range(10):
+        layer.write_line(l, 425 + l, 210 + l, 195 + l)
+
+    # Labels
+    for name, x, y in (("kmh", 730, 445), ("odo", 295, 340), ("km", 460, 410),
+                       ("engspd", 290, 220), ("rpm", 455, 290)):
+        _, _, rows = read_pbm(os.path.join(ASSET_DIR, name + ".pbm"))
+        layer.image(x, y, rows)
+
+    # Analog speedometer scale
+    for j in range(8, -1, -1):
+        a = cmap(j, 0, 8, 90, 630)
+        layer.number16x24(trunc(645 + sin_lut[a] * 0.45 + cos_lut[a] * 0.028),
+                          trunc(328 + cos_lut[a] * 0.45 + sin_lut[a] * 0.012),
+                          (8 - j) * 50, digits)
+        layer.circle(660, 335, 65 - j)
+        for k in range(3):
+            layer.write_line(trunc(660 + sin_lut[a + k] * 0.25),
+                             trunc(335 + cos_lut[a + k] * 0.25),
+                             trunc(660 + sin_lut[a + k] * 0.28),
+                             trunc(335 + cos_lut[a + k] * 0.28))
+
+    # Raw P4: one bit per pixel, MSB first, rows padded to whole bytes
+    with open(OUT, "wb") as f:
+        f.write(b"P4\n# dashboard, generated by tools/gen_dashboard.py\n%d %d\n" % (MAX_X, MAX_Y))
+        for row in layer.px:
+            packed = bytearray((MAX_X + 7) // 8)
+            for x, bit in enumerate(row):
+                if bit:
+                    packed[x // 8] |= 0x80 >> (x & 7)
+            f.write(bytes(packed))
+    print("wrote %s" % os.path.relpath(OUT, ROOT))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,488 @@
+/**
+ * golden_check.c - Incremental rendering vs from-scratch render
+ *
+ * The widgets only repaint what changed (shadowArray/pictureArray for the
+ * bar graph, oldSevenSegDigitNum for the digits, oldDigitalKMH for the
+ * needle, oldErrorCode for the warning lights, lastDirection in main.c).
+ * This tool drives sequences of states through those incremental paths
+ * into a framebuffer model of the SSD1963 and compares the final picture
+ * with a from-scratch render of the last state: InitSpeedometerDisplay()
+ * plus one startup frame. Any differing pixel is a stale or missing
+ * repaint.
+ *
+ * Each run happens in its own forked process so every render starts from
+ * the firmware's power-on static state. The incremental runs use the
+ * started draw queue, drained by hand after each frame (or only every few
+ * frames, to force queue overflows and exercise the retry paths); the
+ * reference is drawn synchronously as at boot. The frame function
+ * mirrors the display part of the main loop in main.c.
+ *
+ * Build and run from the project root (host gcc, no TivaWare needed):
+ *
+ *     gcc -DHOST_BUILD -O2 -Isim -I. -Idisplay tools/golden_check.c display/display.c display/drawqueue.c display/fastlane.c display/tearsync.c display/bus_gpio.c display/assets_rle.c sim/sim.c sim/driverlib_mock.c sim/stimulus.c -lm -o golden_check
+ *     ./golden_check [-o dir]
+ *
+ *   -o  write <scenario>_ref.ppm, _inc.ppm and _diff.ppm for failures
+ *
+ * The exit status is non-zero if any scenario differs.
+ */
+
+#ifdef HOST_BUILD
+
+#undef main
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "sim.h"
+#include <driverlib/interrupt.h>
+#include "display.h"
+#include "drawqueue.h"
+#include "tearsync.h"
+#include "bus.h"
+
+#if DISPLAY_PIXEL_FORMAT == PIXEL_FORMAT_565
+#define PIXEL_BYTES             2
+#else
+#define PIXEL_BYTES             3
+#endif
+
+#define SETTLE_FRAMES           3       /* repeats of the last state */
+#define RANDOM_FRAMES           300
+
+typedef struct {
+    uint32_t rpm;
+    uint32_t kmh;                       // display units (km/h x 7), 0..399
+    uint64_t odo;                       // decimeters
+    uint8_t errorCode;
+    uint8_t forward;
+} State;
+
+typedef struct {
+    const char *name;
+    void (*generate)(State *seq, uint32_t *count);
+    uint8_t drainEvery;                 // frames between queue drains
+} Scenario;
+
+#define MAX_STEPS               512
+
+// ============================================
+// Framebuffer model (column/page address, RAMWR)
+// ============================================
+
+static uint32_t (*fb)[MAX_X];           // points into shared memory
+static uint8_t fbCommand;
+static uint8_t fbArgs[4], fbArgCount;
+static int xs, xe = MAX_X - 1, ys, ye = MAX_Y - 1, cx, cy;
+static uint32_t pixel;
+static uint8_t pixelByte;
+static uint64_t clock;                  // drives the scanline answers
+
+static void fbByte(uint8_t v)
+{
+    if (fbCommand == 0x2A || fbCommand == 0x2B) {
+        if (fbArgCount < 4)
+            fbArgs[fbArgCount++] = v;
+        if (fbArgCount == 4) {
+            int a = (fbArgs[0] << 8) | fbArgs[1], b = (fbArgs[2] << 8) | fbArgs[3];
+            if (fbCommand == 0x2A) { xs = a; xe = b; } else { ys = a; ye = b; }
+        }
+        return;
+    }
+    if (fbCommand != 0x2C && fbCommand != 0x3C)
+        return;
+    pixel = (pixel << 8) | v;
+    if (++pixelByte < PIXEL_BYTES)
+        return;
+    if (cx >= 0 && cx < MAX_X && cy >= 0 && cy < MAX_Y)
+        fb[cy][cx] = pixel;
+    pixel = 0;
+    pixelByte = 0;
+    if (++cx > xe) {
+        cx = xs;
+        if (++cy > ye)
+            cy = ys;
+    }
+}
+
+static void fbWriteCommand(uint8_t command)
+{
+    fbCommand = command;
+    fbArgCount = 0;
+    if (command == 0x2C) {
+        cx = xs;
+        cy = ys;
+        pixelByte = 0;
+    }
+    clock += 12;
+}
+
+static void fbWriteData(const uint8_t *data, uint32_t len)
+{
+    clock += 12 * (uint64_t)len;
+    while (len--)
+        fbByte(*data++);
+}
+
+static void fbReadData(uint8_t *data, uint32_t len)
+{
+    uint16_t line = (uint16_t)((clock / TEAR_LINE_CYCLES) % TEAR_VT);
+
+    memset(data, 0, len);
+    if (fbCommand == GET_SCANLINE && len == 2) {
+        data[0] = line >> 8;
+        data[1] = line & 0xFF;
+    }
+    clock += 200;
+}
+
+static void fbFill(const uint8_t *pattern, uint8_t patternLen, uint32_t repeats)
+{
+    uint8_t i;
+
+    clock += 12 * (uint64_t)patternLen * repeats;
+    while (repeats--)
+        for (i = 0; i < patternLen; i++)
+            fbByte(pattern[i]);
+}
+
+static void fbNop(void)
+{
+}
+
+static bool fbBusy(void)
+{
+    return false;
+}
+
+static const DisplayBus busFrame = {
+    fbWriteCommand,
+    fbWriteData,
+    fbReadData,
+    fbFill,
+    fbNop,
+    fbNop,
+    fbBusy
+};
+
+// ============================================
+// Main loop display frame (as in main.c)
+// ============================================
+
+static uint8_t shadowArray[110], pictureArray[110];
+static uint8_t startUp = 1;
+static uint8_t lastDirection = 1;
+
+static void frame(const State *s)
+{
+    UpdateSpeedBars(s->rpm, shadowArray, pictureArray, startUp);
+    startUp = 0;
+    UpdateRPMDisplay(s->rpm);
+    UpdateKMHDisplay(s->kmh);
+    UpdateODODisplay(s->odo);
+    if (s->forward != lastDirection && UpdateDirectionGear(s->forward))
+        lastDirection = s->forward;
+    UpdateWarningLights(s->errorCode);
+}
+
+static void drain(void)
+{
+    while (DrawQueue_Depth())
+        DrawQueue_Drain(DRAWQUEUE_BURST_PIXELS);
+}
+
+// ============================================
+// Renders (each in a fresh process)
+// ============================================
+
+static const State *runSeq;
+static uint32_t runCount;
+static uint8_t runDrainEvery;
+
+static void renderReference(void)
+{
+    IntMasterDisable();
+    Bus_Select(&busFrame);
+    InitSpeedometerDisplay();
+    frame(&runSeq[runCount - 1]);
+}
+
+static void renderIncremental(void)
+{
+    uint32_t i;
+
+    IntMasterDisable();
+    Bus_Select(&busFrame);
+    InitSpeedometerDisplay();
+    DrawQueue_Start(SIM_CPU_HZ);
+
+    for (i = 0; i < runCount; i++) {
+        frame(&runSeq[i]);
+        if ((i + 1) % runDrainEvery == 0)
+            drain();
+    }
+    for (i = 0; i < SETTLE_FRAMES; i++) {
+        drain();
+        frame(&runSeq[runCount - 1]);
+    }
+    drain();
+    printf("  overflows %u, sync holds %u\n", DrawQueue_Overflows(), DrawQueue_SyncHolds());
+    fflush(stdout);
+}
+
+static bool render(void (*entry)(void), uint32_t (*out)[MAX_X])
+{
+    pid_t pid = fork();
+    int status;
+
+    if (pid < 0) {
+        perror("fork");
+        return false;
+    }
+    if (pid == 0) {
+        fb = out;
+        memset(fb, 0, sizeof(uint32_t) * MAX_X * MAX_Y);
+        Sim_Run(UINT64_MAX / 2, entry);
+        _exit(0);
+    }
+    return waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+// ============================================
+// Scenarios
+// ============================================
+
+static State base(void)
+{
+    State s = { 0, 0, 0, 0x02, 1 };
+    return s;
+}
+
+static void genRpmRamp(State *seq, uint32_t *count)
+{
+    uint32_t n = 0;
+    int32_t rpm;
+
+    for (rpm = 0; rpm <= 21000; rpm += 650) {
+        seq[n] = base();
+        seq[n].rpm = rpm;
+        n++;
+    }
+    for (rpm = 21000; rpm >= 3000; rpm -= 1100) {
+        seq[n] = base();
+        seq[n].rpm = rpm;
+        n++;
+    }
+    *count = n;
+}
+
+static void genNeedle(State *seq, uint32_t *count)
+{
+    uint32_t n = 0;
+    int32_t kmh;
+
+    for (kmh = 0; kmh <= 399; kmh += 7) {
+        seq[n] = base();
+        seq[n].kmh = kmh;
+        n++;
+    }
+    for (kmh = 399; kmh >= 120; kmh -= 13) {
+        seq[n] = base();
+        seq[n].kmh = kmh;
+        n++;
+    }
+    *count = n;
+}
+
+static void genOdometer(State *seq, uint32_t *count)
+{
+    uint32_t n = 0;
+    uint64_t odo;
+
+    for (odo = 9985; odo <= 10015; odo++) {
+        seq[n] = base();
+        seq[n].odo = odo;
+        n++;
+    }
+    seq[n] = base();
+    seq[n].odo = 99999;
+    n++;
+    seq[n] = base();
+    seq[n].odo = 123;
+    n++;
+    *count = n;
+}
+
+static void genWarnings(State *seq, uint32_t *count)
+{
+    static const uint8_t codes[] = { 0x02, 0x0F, 0x0A, 0x0F, 0x0A, 0x08, 0x00, 0x05, 0x0B };
+    static const uint8_t directions[] = { 1, 0, 0, 1, 0, 1, 1, 0, 0 };
+    uint32_t n;
+
+    for (n = 0; n < sizeof(codes); n++) {
+        seq[n] = base();
+        seq[n].errorCode = codes[n];
+        seq[n].forward = directions[n];
+    }
+    *count = n;
+}
+
+static void genRandom(State *seq, uint32_t *count)
+{
+    uint32_t n;
+    State s = base();
+
+    srand(4711);
+    for (n = 0; n < RANDOM_FRAMES; n++) {
+        int32_t rpm = (int32_t)s.rpm + (rand() % 4001) - 2000;
+        int32_t kmh = (int32_t)s.kmh + (rand() % 61) - 30;
+        s.rpm = rpm < 0 ? 0 : (rpm > 24000 ? 24000 : rpm);
+        s.kmh = kmh < 0 ? 0 : (kmh > 399 ? 399 : kmh);
+        s.odo += rand() % 40;
+        if (rand() % 8 == 0)
+            s.errorCode = (uint8_t)(rand() & 0x0F);
+        if (rand() % 25 == 0)
+            s.forward = !s.forward;
+        seq[n] = s;
+    }
+    *count = n;
+}
+
+static const Scenario scenarios[] = {
+    { "rpm_ramp",        genRpmRamp,  1 },
+    { "needle_sweep",    genNeedle,   1 },
+    { "odometer_roll",   genOdometer, 1 },
+    { "warnings_gear",   genWarnings, 1 },
+    { "random_walk",     genRandom,   1 },
+    { "random_overflow", genRandom,   8 },  // queue overflows between drains
+    { "random_starved",  genRandom,   32 }, // mostly overflowing
+};
+
+// ============================================
+// Compare and report
+// ============================================
+
+static void rgb(uint32_t p, uint8_t out[3])
+{
+#if DISPLAY_PIXEL_FORMAT == PIXEL_FORMAT_565
+    out[0] = (uint8_t)(((p >> 11) & 0x1F) << 3);
+    out[1] = (uint8_t)(((p >> 5) & 0x3F) << 2);
+    out[2] = (uint8_t)((p & 0x1F) << 3);
+#else
+    out[0] = (uint8_t)(p >> 16);
+    out[1] = (uint8_t)(p >> 8);
+    out[2] = (uint8_t)p;
+#endif
+}
+
+static void writePpm(const char *dir, const char *name, const char *suffix,
+                     uint32_t (*a)[MAX_X], uint32_t (*b)[MAX_X])
+{
+    char path[256];
+    FILE *f;
+    int x, y;
+
+    snprintf(path, sizeof(path), "%s/%s_%s.ppm", dir, name, suffix);
+    f = fopen(path, "wb");
+    if (!f) {
+        perror(path);
+        return;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", MAX_X, MAX_Y);
+    for (y = 0; y < MAX_Y; y++) {
+        for (x = 0; x < MAX_X; x++) {
+            uint8_t c[3];
+            if (b) {
+                // Diff: differing pixels white on a dimmed reference
+                rgb(a[y][x], c);
+                if (a[y][x] != b[y][x])
+                    c[0] = c[1] = c[2] = 0xFF;
+                else
+                    c[0] >>= 2, c[1] >>= 2, c[2] >>= 2;
+            } else {
+                rgb(a[y][x], c);
+            }
+            fwrite(c, 1, 3, f);
+        }
+    }
+    fclose(f);
+}
+
+int main(int argc, char **argv)
+{
+    static State seq[MAX_STEPS];
+    const char *outDir = NULL;
+    uint32_t (*ref)[MAX_X], (*inc)[MAX_X];
+    size_t fbSize = sizeof(uint32_t) * MAX_X * MAX_Y;
+    uint32_t s, failures = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "o:")) != -1) {
+        if (opt == 'o') {
+            outDir = optarg;
+        } else {
+            fprintf(stderr, "usage: %s [-o dir]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    ref = mmap(NULL, 2 * fbSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (ref == MAP_FAILED) {
+        perror("mmap");
+        return 2;
+    }
+    inc = ref + MAX_Y;
+
+    for (s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++) {
+        const Scenario *sc = &scenarios[s];
+        uint32_t diff = 0;
+        int x, y, x0 = MAX_X, y0 = MAX_Y, x1 = -1, y1 = -1;
+
+        sc->generate(seq, &runCount);
+        runSeq = seq;
+        runDrainEvery = sc->drainEvery;
+
+        printf("%s: %u frames, drain every %u\n", sc->name, runCount, sc->drainEvery);
+        fflush(stdout);
+        if (!render(renderReference, ref) || !render(renderIncremental, inc)) {
+            printf("  render failed\n");
+            failures++;
+            continue;
+        }
+
+        for (y = 0; y < MAX_Y; y++) {
+            for (x = 0; x < MAX_X; x++) {
+                if (ref[y][x] == inc[y][x])
+                    continue;
+                diff++;
+                if (x < x0) x0 = x;
+                if (x > x1) x1 = x;
+                if (y < y0) y0 = y;
+                if (y > y1) y1 = y;
+            }
+        }
+
+        if (!diff) {
+            printf("  identical\n");
+            continue;
+        }
+        failures++;
+        printf("  %u pixels differ in (%d,%d)-(%d,%d)\n", diff, x0, y0, x1, y1);
+        if (outDir) {
+            writePpm(outDir, sc->name, "ref", ref, NULL);
+            writePpm(outDir, sc->name, "inc", inc, NULL);
+            writePpm(outDir, sc->name, "diff", ref, inc);
+        }
+    }
+
+    printf("\n%u of %u scenarios differ\n", failures,
+           (uint32_t)(sizeof(scenarios) / sizeof(scenarios[0])));
+    return failures ? 1 : 0;
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""
+img2rle.py - Convert 1bpp source images into run-length span tables
+
+Reads display/assets/manifest.txt, loads every PBM image listed there
+(plain P1 or raw P4) and writes display/assets_rle.h / display/assets_rle.c.
+
+Span format (consumed by drawImageRLE() in display.c):
+    The image is walked row-major, exactly the order the SSD1963 fills a
+    window after write_command(0x2C). The walk is stored as alternating
+    run lengths of background / foreground pixels, starting with
+    background. Each run is one byte; a run longer than 255 is emitted as
+    255, 0, <rest> so the colour toggles twice and continues.
+
+Manifest format (one asset per line, '#' starts a comment):
+    <C name>  <file.pbm>  [glyph count]
+A glyph count N slices the image into N equally wide glyphs laid out
+left to right and emits an array of N images (used for digit fonts).
+
+Usage (from the project root):
+    python3 tools/img2rle.py
+"""
+
+import os
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(__file__), ".."))
+ASSET_DIR = os.path.join(ROOT, "display", "assets")
+MANIFEST = os.path.join(ASSET_DIR, "manifest.txt")
+OUT_H = os.path.join(ROOT, "display", "assets_rle.h")
+OUT_C = os.path.join(ROOT, "display", "assets_rle.c")
+
+
+def read_pbm(path):
+    """Return (width, height, rows) where rows[y][x] is 0 or 1."""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    # Tokenize header, skipping comments
+    tokens = []
+    pos = 0
+    while len(tokens) < 3:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            while data[pos:pos + 1] not in (b"\n", b""):
+                pos += 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        tokens.append(data[start:pos].decode("ascii"))
+
+    magic, width, height = tokens[0], int(tokens[1]), int(tokens[2])
+    if magic == "P1":
+        bits = [int(c) for c in data[pos:].decode("ascii") if c in "01"]
+        if len(bits) < width * height:
+            raise ValueError("%s: truncated pixel data" % path)
+        rows = [bits[y * width:(y + 1) * width] for y in range(height)]
+    elif magic == "P4":
+        pos += 1  # single whitespace after header
+        stride = (width + 7) // 8
+        rows = []
+        for y in range(height):
+            line = data[pos + y * stride:pos + (y + 1) * stride]
+            rows.append([(line[x // 8] >> (7 - (x & 7))) & 1 for x in range(width)])
+    else:
+        raise ValueError("%s: unsupported PBM type %s" % (path, magic))
+    return width, height, rows
+
+
+def encode_spans(rows, x0, width):
+    """Row-major BG/FG run lengths of rows[*][x0:x0+width]."""
+    runs = []
+    current = 0
+    length = 0
+    for row in rows:
+        for bit in row[x0:x0 + width]:
+            if bit == current:
+                length += 1
+            else:
+                runs.append(length)
+                current = bit
+                length = 1
+    runs.append(length)
+
+    spans = []
+    for run in runs:
+        while run > 255:
+            spans.extend((255, 0))
+            run -= 255
+        spans.append(run)
+    return spans
+
+
+def c_bytes(values, indent="    ", per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join("%3d" % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def macro_name(name):
+    out = ""
+    for i, ch in enumerate(name):
+        if ch.isupper() and i and not name[i - 1].isupper():
+            out += "_"
+        out += ch.upper()
+    return out
+
+
+def parse_manifest():
+    assets = []
+    with open(MANIFEST) as f:
+        for raw in f:
+            line = raw.split("#", 1)[0].split()
+            if not line:
+                continue
+            name, filename = line[0], line[1]
+            glyphs = int(line[2]) if len(line) > 2 else 0
+            assets.append((name, filename, glyphs))
+    return assets
+
+
+def main():
+    header = []
+    source = []
+    raw_bytes = 0
+    span_bytes = 0
+
+    for name, filename, glyphs in parse_manifest():
+        width, height, rows = read_pbm(os.path.join(ASSET_DIR, filename))
+        macro = macro_name(name)
+        count = glyphs if glyphs else 1
+        if width % count:
+            sys.exit("%s: width %d not divisible into %d glyphs" % (filename, width, count))
+        gw = width // count
+
+        header.append("#define %s_W %d" % (macro, gw))
+        header.append("#define %s_H %d" % (macro, height))
+        if glyphs:
+            header.append("extern const RleImage %s[%d];" % (name, glyphs))
+        else:
+            header.append("extern const RleImage %s;" % name)
+        header.append("")
+
+        entries = []
+        for g in range(count):
+            spans = encode_spans(rows, g * gw, gw)
+            array = "%s_spans%s" % (name, g if glyphs else "")
+            source.append("/* %s, %dx%d px, %d span bytes */" % (
+                filename if not glyphs else "%s glyph %d" % (filename, g), gw, height, len(spans)))
+            source.append("static const uint8_t %s[%d] = {" % (array, len(spans)))
+            source.append(c_bytes(spans))
+            source.append("};")
+            source.append("")
+            entries.append("{ %d, %d, %d, %s }" % (gw, height, len(spans), array))
+            raw_bytes += (gw // 8) * height
+            span_bytes += len(spans)
+
+        if glyphs:
+            source.append("const RleImage %s[%d] = {" % (name, glyphs))
+            source.append(",\n".join("    " + e for e in entries))
+            source.append("};")
+        else:
+            source.append("const RleImage %s = %s;" % (name, entries[0]))
+        source.append("")
+
+    banner = ("/* Generated by tools/img2rle.py from display/assets/manifest.txt - do not edit.\n"
+              " * 1bpp equivalent: %d bytes, span encoding: %d bytes */\n" % (raw_bytes, span_bytes))
+
+    with open(OUT_H, "w", newline="\n") as f:
+        f.write(banner)
+        f.write("\n#ifndef ASSETS_RLE_H\n#define ASSETS_RLE_H\n\n")
+        f.write("#include \"display.h\"\n\n")
+        f.write("\n".join(header))
+        f.write("\n#endif  // ASSETS_RLE_H\n")
+
+    with open(OUT_C, "w", newline="\n") as f:
+        f.write(banner)
+        f.write("\n#include \"assets_rle.h\"\n\n")
+        f.write("\n".join(source))
+
+    print("wrote %s, %s (%d -> %d bytes)" % (
+        os.path.relpath(OUT_H, ROOT), os.path.relpath(OUT_C, ROOT), raw_bytes, span_bytes))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,430 @@
+/**
+ * render_bench.c - Rendering benchmark with a checked-in baseline
+ *
+ * Runs display/display.c unmodified for every primitive and widget update
+ * (full clear, bar boxes, bar graph steps, all digit transitions, needle
+ * sweep 0 -> 399, gear letters, warning light toggles and the whole
+ * InitSpeedometerDisplay) against a counting bus backend. Per case it
+ * reports
+ *
+ *   strobes   WR strobes (commands + data transfers)
+ *   pixels    pixels written after RAMWR (0x2C)
+ *   est us    target time projected with the cost model (profile/
+ *             costmodel.h): the GPIO stores the bit-banged backend
+ *             (bus_gpio.c) would execute, COST_GPIO_STORE each, plus
+ *             COST_BUS_CALL per bus call, plus the computation the
+ *             renderer charges with COST_CHARGE()
+ *
+ * Scanline polls of the tear-free updates depend on where the scan is,
+ * not on the renderer; they are counted in their own column and left out
+ * of the other three. The draw queue is not started, so queued commands
+ * run synchronously as at boot.
+ *
+ * The results are compared with tools/render_bench_baseline.txt: a case
+ * whose strobes or est us grow by more than the threshold fails.
+ *
+ * Build and run from the project root (host gcc, no TivaWare needed):
+ *
+ *     gcc -DHOST_BUILD -O2 -Isim -I. -Idisplay tools/render_bench.c display/display.c display/drawqueue.c display/fastlane.c display/tearsync.c display/bus_gpio.c display/assets_rle.c sim/sim.c sim/driverlib_mock.c sim/stimulus.c -lm -o render_bench
+ *     ./render_bench [-t percent] [-b baseline] [-w]
+ *
+ *   -t  regression threshold in percent (default 2)
+ *   -b  baseline file (default tools/render_bench_baseline.txt)
+ *   -w  write the current results as the new baseline
+ *
+ * The exit status is non-zero if a case regressed.
+ */
+
+#ifdef HOST_BUILD
+
+#undef main
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "sim.h"
+#include "display.h"
+#include "bus.h"
+#include "tearsync.h"
+#include "assets_rle.h"
+
+#define BENCH_MAX_CASES         64
+#define BENCH_DEFAULT_BASELINE  "tools/render_bench_baseline.txt"
+
+#if DISPLAY_PIXEL_FORMAT == PIXEL_FORMAT_565
+#define PIXEL_BYTES             2
+#else
+#define PIXEL_BYTES             3
+#endif
+
+typedef struct {
+    char name[40];
+    uint32_t strobes;
+    uint32_t pixels;
+    double us;
+    uint32_t polls;
+} BenchResult;
+
+static BenchResult results[BENCH_MAX_CASES];
+static uint32_t resultCount;
+
+/* Counters of the running case */
+static uint64_t stores, calls, pixelBytes, strobes;
+static uint64_t compute, computeStart;  // COST_CHARGE() cycles (sim clock)
+static uint32_t polls;
+static uint64_t clock;                  // all bus time, drives the scanline
+static uint8_t lastCommand;
+static bool counting = true;            // false while setting up a case
+
+// ============================================
+// Counting backend (store counts mirror bus_gpio.c)
+// ============================================
+
+static void charge(uint64_t n, bool render)
+{
+    clock += n * COST_GPIO_STORE + COST_BUS_CALL;
+    if (render && counting) {
+        stores += n;
+        calls++;
+    }
+}
+
+static void benchWriteCommand(uint8_t command)
+{
+    lastCommand = command;
+    if (command == GET_SCANLINE) {
+        polls += counting;
+        charge(3, false);
+        return;
+    }
+    strobes += counting;
+    charge(3, true);
+}
+
+static void benchWriteData(const uint8_t *data, uint32_t len)
+{
+    (void)data;
+    if (counting) {
+        strobes += len;
+        if (lastCommand == 0x2C)
+            pixelBytes += len;
+    }
+    charge(3 * (uint64_t)len, true);
+}
+
+static void benchReadData(uint8_t *data, uint32_t len)
+{
+    uint16_t line = (uint16_t)((clock / TEAR_LINE_CYCLES) % TEAR_VT);
+
+    if (lastCommand == GET_SCANLINE && len == 2) {
+        data[0] = line >> 8;
+        data[1] = line & 0xFF;
+    } else {
+        memset(data, 0, len);
+    }
+    charge(2 + 5 * (uint64_t)len, false);
+}
+
+static void benchFill(const uint8_t *pattern, uint8_t patternLen, uint32_t repeats)
+{
+    uint64_t bytes = (uint64_t)patternLen * repeats;
+    uint64_t transfers = bytes / BUS_TRANSFER_BYTES;
+
+    (void)pattern;
+    if (counting) {
+        strobes += transfers;
+        if (lastCommand == 0x2C)
+            pixelBytes += bytes;
+    }
+
+    if (patternLen == BUS_TRANSFER_BYTES)
+        charge(BUS_TRANSFER_BYTES + 2 * transfers, true);   // data lines set once
+    else if (BUS_TRANSFER_BYTES == 2)
+        charge(4 * transfers, true);                        // K, M, WR low, WR high
+    else
+        charge(3 * transfers, true);
+}
+
+static void benchNop(void)
+{
+}
+
+static bool benchBusy(void)
+{
+    return false;
+}
+
+static const DisplayBus busBench = {
+    benchWriteCommand,
+    benchWriteData,
+    benchReadData,
+    benchFill,
+    benchNop,
+    benchNop,
+    benchBusy
+};
+
+// ============================================
+// Cases
+// ============================================
+
+static void caseStart(void)
+{
+    stores = calls = pixelBytes = strobes = 0;
+    polls = 0;
+    compute = 0;
+    computeStart = Sim_Now();
+}
+
+static void setCounting(bool on)
+{
+    if (counting && !on)
+        compute += Sim_Now() - computeStart;
+    else if (!counting && on)
+        computeStart = Sim_Now();
+    counting = on;
+}
+
+static void caseEnd(const char *name)
+{
+    BenchResult *r;
+
+    if (resultCount >= BENCH_MAX_CASES) {
+        fprintf(stderr, "too many cases, raise BENCH_MAX_CASES\n");
+        exit(2);
+    }
+    compute += Sim_Now() - computeStart;
+    r = &results[resultCount++];
+    snprintf(r->name, sizeof(r->name), "%s", name);
+    r->strobes = (uint32_t)strobes;
+    r->pixels = (uint32_t)(pixelBytes / PIXEL_BYTES);
+    r->us = COST_US(stores * COST_GPIO_STORE + calls * COST_BUS_CALL + compute);
+    r->polls = polls;
+}
+
+static uint8_t shadow[110], picture[110];
+
+static void barsTo(uint32_t rpm, uint8_t startUp)
+{
+    UpdateSpeedBars(rpm, shadow, picture, startUp);
+}
+
+static void runCases(void)
+{
+    static const struct {
+        const char *name;
+        uint8_t bit;
+    } lights[4] = {
+        { "warning water temp", 0x01 },
+        { "warning ABS", 0x02 },
+        { "warning battery", 0x04 },
+        { "warning engine check", 0x08 },
+    };
+    char name[40];
+    int d, e, k;
+
+    Bus_Select(&busBench);
+
+    caseStart();
+    InitSpeedometerDisplay();
+    barsTo(0, 1);
+    caseEnd("InitSpeedometerDisplay");
+
+    caseStart();
+    drawBox(0, MAX_X, 0, MAX_Y, BLACK);
+    caseEnd("full clear");
+
+    // All bars are 5 x 150; the low ones only sit lower
+    caseStart();
+    drawBox(20, 25, 175, 325, ORANGE);
+    caseEnd("drawBox bar j<20 (5x150)");
+    caseStart();
+    drawBox(160, 165, 15, 165, ORANGE);
+    caseEnd("drawBox bar j>=20 (5x150)");
+
+    caseStart();
+    barsTo(5000, 0);
+    caseEnd("bars 0 -> 5000 rpm");
+    caseStart();
+    barsTo(5200, 0);
+    caseEnd("bars +1 segment");
+    caseStart();
+    barsTo(20000, 0);
+    caseEnd("bars 5200 -> 20000 rpm");
+    caseStart();
+    barsTo(0, 0);
+    caseEnd("bars 20000 -> 0 rpm");
+
+    // 32x50 digits: the cost depends on the target glyph only, so the
+    // nine transitions into each digit are one case
+    for (e = 0; e < 10; e++) {
+        caseStart();
+        for (d = 0; d < 10; d++) {
+            if (d == e)
+                continue;
+            setCounting(false);
+            drawNumber32x50(278, 270, d, 1, -1, 1, ORANGE, BURNT_ORANGE);
+            setCounting(true);
+            drawNumber32x50(278, 270, e, 1, -1, 1, ORANGE, BURNT_ORANGE);
+        }
+        snprintf(name, sizeof(name), "digit 32x50 x9 -> %d", e);
+        caseEnd(name);
+    }
+
+    for (e = 0; e < 10; e++) {
+        caseStart();
+        drawDigit16x24(20, 330, e, ORANGE, BURNT_ORANGE);
+        snprintf(name, sizeof(name), "digit 16x24 %d", e);
+        caseEnd(name);
+    }
+
+    caseStart();
+    for (k = 0; k <= 399; k++)
+        UpdateKMHDisplay((uint32_t)k);
+    caseEnd("needle sweep 0 -> 399");
+    caseStart();
+    for (k = 399; k >= 0; k--)
+        UpdateKMHDisplay((uint32_t)k);
+    caseEnd("needle sweep 399 -> 0");
+
+    caseStart();
+    UpdateDirectionGear(0);
+    caseEnd("gear R");
+    caseStart();
+    UpdateDirectionGear(1);
+    caseEnd("gear D");
+
+    UpdateWarningLights(0x00);
+    for (k = 0; k < 4; k++) {
+        caseStart();
+        UpdateWarningLights(lights[k].bit);
+        UpdateWarningLights(0x00);
+        snprintf(name, sizeof(name), "%s on+off", lights[k].name);
+        caseEnd(name);
+    }
+
+    Bus_Select(&busGpio);
+}
+
+// ============================================
+// Baseline
+// ============================================
+
+static bool writeBaseline(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    uint32_t i;
+
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    fprintf(f, "# tools/render_bench.c baseline: name|strobes|pixels|est_us\n");
+    for (i = 0; i < resultCount; i++)
+        fprintf(f, "%s|%u|%u|%.2f\n", results[i].name, results[i].strobes,
+                results[i].pixels, results[i].us);
+    fclose(f);
+    return true;
+}
+
+static const BenchResult *findBaseline(const BenchResult *base, uint32_t count, const char *name)
+{
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+        if (!strcmp(base[i].name, name))
+            return &base[i];
+    return NULL;
+}
+
+static uint32_t readBaseline(const char *path, BenchResult *base)
+{
+    FILE *f = fopen(path, "r");
+    char line[128];
+    uint32_t count = 0;
+
+    if (!f)
+        return 0;
+    while (count < BENCH_MAX_CASES && fgets(line, sizeof(line), f)) {
+        char *sep = strchr(line, '|');
+        if (line[0] == '#' || !sep)
+            continue;
+        *sep = '\0';
+        snprintf(base[count].name, sizeof(base[count].name), "%.39s", line);
+        if (sscanf(sep + 1, "%u|%u|%lf", &base[count].strobes, &base[count].pixels, &base[count].us) == 3)
+            count++;
+    }
+    fclose(f);
+    return count;
+}
+
+static double change(double now, double was)
+{
+    return was > 0.0 ? 100.0 * (now - was) / was : (now > 0.0 ? 100.0 : 0.0);
+}
+
+int main(int argc, char **argv)
+{
+    static BenchResult base[BENCH_MAX_CASES];
+    const char *baselinePath = BENCH_DEFAULT_BASELINE;
+    double threshold = 2.0;
+    bool write = false;
+    uint32_t baseCount, i, regressions = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:b:w")) != -1) {
+        switch (opt) {
+        case 't':
+            threshold = atof(optarg);
+            break;
+        case 'b':
+            baselinePath = optarg;
+            break;
+        case 'w':
+            write = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-t percent] [-b baseline] [-w]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // display.c may reach charge points (SysCtlDelay etc.); give it a clock
+    Sim_Run(UINT64_MAX / 2, runCases);
+
+    if (write)
+        return writeBaseline(baselinePath) ? 0 : 2;
+
+    baseCount = readBaseline(baselinePath, base);
+    if (!baseCount)
+        printf("no baseline in %s (write one with -w)\n\n", baselinePath);
+
+    printf("%-28s %9s %8s %10s %6s %8s %8s\n",
+           "case", "strobes", "pixels", "est us", "polls", "d strb", "d us");
+    for (i = 0; i < resultCount; i++) {
+        const BenchResult *r = &results[i];
+        const BenchResult *b = findBaseline(base, baseCount, r->name);
+        const char *verdict = "";
+
+        printf("%-28s %9u %8u %10.2f %6u", r->name, r->strobes, r->pixels, r->us, r->polls);
+        if (b) {
+            double ds = change(r->strobes, b->strobes), du = change(r->us, b->us);
+            if (ds > threshold || du > threshold) {
+                verdict = "  REGRESSION";
+                regressions++;
+            }
+            printf(" %+7.1f%% %+7.1f%%%s\n", ds, du, verdict);
+        } else {
+            printf(" %8s\n", "new");
+        }
+    }
+
+    if (baseCount)
+        printf("\n%u of %u cases regressed by more than %.1f%%\n", regressions, resultCount, threshold);
+    return regressions ? 1 : 0;
+}
+
+#endif /* HOST_BUILD */
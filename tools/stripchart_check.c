@@ -0,0 +1,308 @@
+/**
+ * stripchart_check.c - Scroll commands and ring wrap of the strip chart
+ *
+ * Runs display/stripchart.c against a model of the SSD1963 frame memory
+ * and vertical scroll, fed through the busRecord backend. The model takes
+ * SET_SCROLL_AREA (0x33) and SET_SCROLL_START (0x37) in frame-memory
+ * lines, as the datasheet defines them, and composes the picture the way
+ * the controller scans it out: line L of the scroll area shows memory
+ * row TFA + (VSP - TFA + L - TFA) mod VSA, and the vertical flip of
+ * SET_ADRESS_MODE (tearsync.h) is applied after that, on output only.
+ *
+ * For each band it checks:
+ *   - the scroll area covers exactly the chart rows (TFA + VSA + BFA =
+ *     MAX_Y) and the scroll start stays inside it
+ *   - every push writes the row at the ring head, then moves the scroll
+ *     start one row on, wrapping with the head after `height` pushes
+ *   - after every push the composed band shows the samples oldest at the
+ *     top, newest at the bottom, and rows outside the band do not move
+ *   - StripChart_Disable() restores a zero scroll area
+ * and prints the scanline the newest sample is refreshed on.
+ *
+ * Build and run from the project root (host gcc, no TivaWare needed):
+ *
+ *     gcc -DHOST_BUILD -O2 -I. -Idisplay tools/stripchart_check.c display/stripchart.c display/bus_record.c -o stripchart_check
+ *     ./stripchart_check
+ *
+ * The exit status is non-zero if any check fails.
+ */
+
+#ifdef HOST_BUILD
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "stripchart.h"
+#include "drawqueue.h"
+#include "tearsync.h"
+#include "bus.h"
+#include "bus_record.h"
+
+#define CHART_LEFT              20
+#define CHART_WIDTH             760
+
+typedef struct {
+    const char *name;
+    uint16_t top, height;
+    uint32_t fullScale, markValue;
+} Band;
+
+static const Band bands[] = {
+    { "main.c band", 0,   14,  20000, 14000 },
+    { "mid screen",  200, 37,  CHART_WIDTH, 0 },
+    { "bottom",      MAX_Y - 2, 2, CHART_WIDTH, 300 },
+};
+
+const DisplayBus *displayBus = &busRecord;
+
+// ============================================
+// Display primitives stripchart.c uses, on the bus
+// ============================================
+
+void write_command(unsigned char command)
+{
+    displayBus->writeCommand(command);
+}
+
+void write_data(unsigned char data)
+{
+    displayBus->writeData(&data, 1);
+}
+
+void window_set(int min_x, int min_y, int max_x, int max_y)
+{
+    uint8_t args[4];
+
+    args[0] = min_x >> 8; args[1] = min_x; args[2] = max_x >> 8; args[3] = max_x;
+    displayBus->writeCommand(0x2A);
+    displayBus->writeData(args, 4);
+    args[0] = min_y >> 8; args[1] = min_y; args[2] = max_y >> 8; args[3] = max_y;
+    displayBus->writeCommand(0x2B);
+    displayBus->writeData(args, 4);
+}
+
+void writePixelRun(enum colors col, uint32_t count)
+{
+    uint8_t rgb[3] = { (uint8_t)(col >> 16), (uint8_t)(col >> 8), (uint8_t)col };
+
+    if (count)
+        Bus_Fill(rgb, 3, count);
+}
+
+void drawVSpan(int x, int y, int len, enum colors col)
+{
+    Bus_Begin();
+    window_set(x, y, x, y + len - 1);
+    write_command(0x2C);
+    writePixelRun(col, len);
+    Bus_End();
+}
+
+// Before DrawQueue_Start() the queue runs every command at once
+bool DrawQueue_Call(DrawCallback fn, uint32_t arg)
+{
+    fn(arg);
+    return true;
+}
+
+// ============================================
+// Controller model: frame memory, window, scroll
+// ============================================
+
+static uint32_t mem[MAX_Y][MAX_X];
+static uint8_t command, args[6], argCount;
+static int xs, xe, ys, ye, cx, cy;
+static uint16_t tfa, vsa = MAX_Y, bfa, vsp;
+static uint32_t scrollStarts;           // SET_SCROLL_START commands
+
+static void modelCommand(uint8_t c)
+{
+    command = c;
+    argCount = 0;
+    if (c == 0x2C) {
+        cx = xs;
+        cy = ys;
+    }
+}
+
+static void modelData(const uint8_t *data, uint32_t len)
+{
+    while (len--) {
+        if (argCount < sizeof(args))
+            args[argCount++] = *data++;
+        else
+            data++;
+        if (command == 0x2A && argCount == 4) {
+            xs = (args[0] << 8) | args[1];
+            xe = (args[2] << 8) | args[3];
+        } else if (command == 0x2B && argCount == 4) {
+            ys = (args[0] << 8) | args[1];
+            ye = (args[2] << 8) | args[3];
+        } else if (command == SET_SCROLL_AREA && argCount == 6) {
+            tfa = (args[0] << 8) | args[1];
+            vsa = (args[2] << 8) | args[3];
+            bfa = (args[4] << 8) | args[5];
+        } else if (command == SET_SCROLL_START && argCount == 2) {
+            vsp = (args[0] << 8) | args[1];
+            scrollStarts++;
+        }
+    }
+}
+
+static void modelRead(uint8_t *data, uint32_t len)
+{
+    memset(data, 0, len);
+}
+
+static void modelFill(const uint8_t *pattern, uint8_t patternLen, uint32_t repeats)
+{
+    uint32_t col = ((uint32_t)pattern[0] << 16) | (pattern[1] << 8) | pattern[2];
+
+    if (command != 0x2C || patternLen != 3)
+        return;
+    while (repeats--) {
+        if (cx < MAX_X && cy < MAX_Y)
+            mem[cy][cx] = col;
+        if (++cx > xe) {
+            cx = xs;
+            if (++cy > ye)
+                cy = ys;
+        }
+    }
+}
+
+static void modelBegin(void) {}
+static void modelEnd(void) {}
+static bool modelBusy(void) { return false; }
+
+static const DisplayBus controller = {
+    modelCommand, modelData, modelRead, modelFill, modelBegin, modelEnd, modelBusy
+};
+
+// Memory row shown on display line `line`, before the flip
+static int shownRow(int line)
+{
+    if (line < tfa || line >= tfa + vsa)
+        return line;
+    return tfa + (vsp - tfa + line - tfa) % vsa;
+}
+
+static int rowScanline(int line)
+{
+#if TEAR_FLIPPED
+    return TEAR_VPS + (MAX_Y - 1 - line);
+#else
+    return TEAR_VPS + line;
+#endif
+}
+
+// Trace pixels at the left of a memory row
+static uint32_t traceLength(int row)
+{
+    uint32_t n = 0;
+
+    while (n < CHART_WIDTH && mem[row][CHART_LEFT + n] == ORANGE)
+        n++;
+    return n;
+}
+
+// ============================================
+// Checks
+// ============================================
+
+static uint32_t failures;
+
+static void fail(const Band *b, const char *what, uint32_t push)
+{
+    if (failures < 20)
+        printf("  %s: %s (push %u)\n", b->name, what, push);
+    failures++;
+}
+
+static uint32_t sample(uint32_t k, uint32_t fullScale)
+{
+    return (k * 7919u + 13u) % (fullScale + 1);
+}
+
+static void runBand(const Band *b)
+{
+    uint32_t pushes = 2 * b->height + 3, k, j;
+    uint32_t starts;
+    int line;
+
+    memset(mem, 0, sizeof(mem));
+    tfa = 0; vsa = MAX_Y; bfa = 0; vsp = 0;
+    scrollStarts = 0;
+    BusRecord_Start(NULL, 0, &controller);
+
+    // Outside the band: a marker per row that must stay put
+    for (line = 0; line < MAX_Y; line++)
+        mem[line][0] = 0x010000 + line;
+
+    StripChart_Init(b->top, b->height, CHART_LEFT, CHART_WIDTH, b->fullScale, b->markValue,
+                    ORANGE, BLACK, BURNT_ORANGE);
+    if (tfa != b->top || vsa != b->height || tfa + vsa + bfa != MAX_Y)
+        fail(b, "scroll area is not the band", 0);
+    if (vsp != b->top)
+        fail(b, "scroll start not at the band top", 0);
+
+    for (k = 0; k < pushes; k++) {
+        uint16_t head = k % b->height;
+        uint32_t value = sample(k, b->fullScale);
+
+        starts = scrollStarts;
+        StripChart_Push(value);
+        if (scrollStarts != starts + 1)
+            fail(b, "not one scroll start per push", k);
+        if (traceLength(b->top + head) != (uint32_t)((uint64_t)value * CHART_WIDTH / b->fullScale))
+            fail(b, "row not written at the ring head", k);
+        if (vsp != b->top + (head + 1) % b->height)
+            fail(b, "scroll start is not the row after the head", k);
+
+        // Composed band: newest at the bottom, older samples above it,
+        // rows not written yet still empty
+        for (j = 0; j < b->height; j++) {
+            int shown = shownRow(b->top + b->height - 1 - j);
+            uint32_t expect = 0;
+            if (j <= k)
+                expect = (uint32_t)((uint64_t)sample(k - j, b->fullScale) * CHART_WIDTH
+                                    / b->fullScale);
+            if (traceLength(shown) != expect) {
+                fail(b, "band shows the samples out of order", k);
+                break;
+            }
+        }
+        for (line = 0; line < MAX_Y; line++) {
+            if (line >= b->top && line < b->top + b->height)
+                continue;
+            if (shownRow(line) != line || mem[line][0] != (uint32_t)(0x010000 + line)) {
+                fail(b, "a row outside the band moved", k);
+                break;
+            }
+        }
+    }
+
+    printf("%-12s rows %3u-%3u  TFA %3u VSA %3u BFA %3u  newest on scanline %3d  %u pushes\n",
+           b->name, b->top, b->top + b->height - 1, tfa, vsa, bfa,
+           rowScanline(b->top + b->height - 1), pushes);
+
+    StripChart_Disable();
+    if (tfa != 0 || vsa != MAX_Y || bfa != 0 || vsp != 0)
+        fail(b, "disable left a scroll area", pushes);
+    if (BusRecord_Stats()->unbalanced)
+        fail(b, "unbalanced bus transactions", pushes);
+}
+
+int main(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < sizeof(bands) / sizeof(bands[0]); i++)
+        runBand(&bands[i]);
+
+    printf("\n%u failed checks\n", failures);
+    return failures ? 1 : 0;
+}
+
+#endif /* HOST_BUILD */
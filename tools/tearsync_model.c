@@ -0,0 +1,185 @@
+/**
+ * tearsync_model.c - Host model of tear-free region updates
+ *
+ * Runs display/tearsync.c against a virtual SSD1963 refresh scan: the
+ * busRecord backend answers GET_SCANLINE from a cycle clock, and every
+ * region write is replayed against the scan to see whether any frame
+ * showed the region half old, half new.
+ *
+ * Two policies are compared on the same random update stream:
+ *   naive   write at the first drain tick after the update is produced
+ *   sync    hold at drain ticks until TearSync_RegionSafe() (as the
+ *           CMD_SYNC handling in drawqueue.c does)
+ * for needle-sized and bar-graph-sized regions. The cost of sync is the
+ * time updates are held. Groups DrawQueue_Sync() does not synchronise
+ * (too long for one drain tick, or too tall) are drawn as is under both
+ * policies and counted separately.
+ *
+ * Build and run from the project root (host gcc, no TivaWare needed):
+ *
+ *     gcc -DHOST_BUILD -O2 -I. -Idisplay tools/tearsync_model.c display/tearsync.c display/bus_record.c -o tearsync_model
+ *     ./tearsync_model
+ *
+ * The exit status is non-zero if a synchronised update tears.
+ */
+
+#ifdef HOST_BUILD
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "tearsync.h"
+#include "drawqueue.h"
+#include "bus_record.h"
+
+#define CPU_HZ                  120000000
+#define TICK_CYCLES             (CPU_HZ / DRAWQUEUE_TICK_HZ)
+#define FRAME_CYCLES            ((uint64_t)TEAR_VT * TEAR_LINE_CYCLES)
+#define READ_CYCLES             200     /* GET_SCANLINE + 2 reads */
+#define UPDATES                 20000
+
+const DisplayBus *displayBus = &busRecord;
+
+static uint64_t now;                    // virtual CPU cycle clock
+
+void write_command(unsigned char command)
+{
+    displayBus->writeCommand(command);
+}
+
+// The virtual controller: GET_SCANLINE returns the line at `now`
+static void readHook(uint8_t command, uint8_t *data, uint32_t len)
+{
+    uint16_t line = (uint16_t)((now / TEAR_LINE_CYCLES) % TEAR_VT);
+
+    if (command == GET_SCANLINE && len == 2) {
+        data[0] = line >> 8;
+        data[1] = line & 0xFF;
+    }
+    now += READ_CYCLES;
+}
+
+static int rowScanline(int y)
+{
+#if TEAR_FLIPPED
+    return TEAR_VPS + (MAX_Y - 1 - y);
+#else
+    return TEAR_VPS + y;
+#endif
+}
+
+// Rows y_min..y_max written top to bottom from t0 over `cycles`. Torn if
+// some frame scanned part of the region before its rows were written
+// and part after.
+static bool torn(int y_min, int y_max, uint64_t t0, uint32_t cycles)
+{
+    int h = y_max - y_min + 1;
+    uint64_t frame;
+
+    for (frame = t0 / FRAME_CYCLES; frame <= (t0 + cycles) / FRAME_CYCLES + 1; frame++) {
+        bool sawOld = false, sawNew = false;
+        int y;
+        for (y = y_min; y <= y_max; y++) {
+            uint64_t scanned = (frame * TEAR_VT + rowScanline(y)) * TEAR_LINE_CYCLES;
+            uint64_t written = t0 + (uint64_t)cycles * (y - y_min + 1) / h;
+            if (scanned < written)
+                sawOld = true;
+            else
+                sawNew = true;
+        }
+        if (sawOld && sawNew)
+            return true;
+    }
+    return false;
+}
+
+typedef struct {
+    const char *name;
+    int minHeight, maxHeight;           // region rows
+    uint32_t minCycles, maxCycles;      // write time
+} Workload;
+
+static uint32_t randRange(uint32_t lo, uint32_t hi)
+{
+    return lo + (uint32_t)(rand() % (hi - lo + 1));
+}
+
+int main(void)
+{
+    static const Workload workloads[] = {
+        { "needle (8 lines)",    10, 40,  TEAR_PLOT_CYCLES(100), TEAR_PLOT_CYCLES(240) },
+        { "bars (1-3 changed)",  150, 310, TEAR_FILL_CYCLES(750), TEAR_FILL_CYCLES(3 * 750) },
+        { "bars (4-20 changed)", 150, 310, TEAR_FILL_CYCLES(4 * 750), TEAR_FILL_CYCLES(20 * 750) },
+    };
+    uint32_t w, i;
+    bool ok = true;
+
+    // Keep the bar workloads on either side of the one-tick limit
+    _Static_assert(TEAR_FILL_CYCLES(3 * 750) <= DRAWQUEUE_SYNC_MAX_CYCLES, "bars 1-3");
+    _Static_assert(TEAR_FILL_CYCLES(4 * 750) > DRAWQUEUE_SYNC_MAX_CYCLES, "bars 4-20");
+
+    BusRecord_Start(NULL, 0, NULL);
+    BusRecord_SetReadHook(readHook);
+
+    printf("scan %d lines x %d cycles (%.1f ms frame), drain tick %d cycles\n\n",
+           TEAR_VT, TEAR_LINE_CYCLES, FRAME_CYCLES * 1000.0 / CPU_HZ, TICK_CYCLES);
+    printf("%-22s %8s %8s %8s %10s %10s %8s\n",
+           "workload", "updates", "naive", "sync", "mean hold", "max hold", "unsynced");
+
+    for (w = 0; w < sizeof(workloads) / sizeof(workloads[0]); w++) {
+        const Workload *wl = &workloads[w];
+        uint32_t tornNaive = 0, tornSync = 0, unsynced = 0, maxHold = 0;
+        uint64_t holdTicks = 0;
+
+        srand(1234 + w);
+        now = 0;
+        for (i = 0; i < UPDATES; i++) {
+            int h = (int)randRange(wl->minHeight, wl->maxHeight);
+            int y_min = (int)randRange(0, MAX_Y - h);
+            int y_max = y_min + h - 1;
+            uint32_t cycles = randRange(wl->minCycles, wl->maxCycles);
+            uint64_t tick = (now / TICK_CYCLES + 1 + randRange(0, 50)) * TICK_CYCLES;
+            uint32_t held = 0;
+
+            bool naiveTorn = torn(y_min, y_max, tick, cycles);
+
+            if (naiveTorn)
+                tornNaive++;
+
+            // Same rule as DrawQueue_Sync(): not synchronised, drawn as is
+            if (cycles > DRAWQUEUE_SYNC_MAX_CYCLES || !TearSync_Fits(y_min, y_max, cycles)) {
+                unsynced++;
+                if (naiveTorn)
+                    tornSync++;
+                now = tick + cycles;
+                continue;
+            }
+
+            now = tick;
+            while (held < DRAWQUEUE_SYNC_MAX_HOLDS && !TearSync_RegionSafe(y_min, y_max, cycles)) {
+                held++;
+                now = tick + (uint64_t)held * TICK_CYCLES;
+            }
+            holdTicks += held;
+            if (held > maxHold)
+                maxHold = held;
+
+            if (torn(y_min, y_max, now, cycles)) {
+                tornSync++;
+                ok = false;
+            }
+            now += cycles;
+        }
+
+        printf("%-22s %8u %8u %8u %8.2fms %8.0fms %8u\n", wl->name, UPDATES, tornNaive, tornSync,
+               (UPDATES > unsynced) ? (double)holdTicks / (UPDATES - unsynced) * 1000.0 / DRAWQUEUE_TICK_HZ : 0.0,
+               maxHold * 1000.0 / DRAWQUEUE_TICK_HZ, unsynced);
+    }
+
+    printf("\nscanline reads %u bytes, checks %u, holds %u\n",
+           BusRecord_Stats()->readBytes, TearSync_Checks(), TearSync_Holds());
+    return ok ? 0 : 1;
+}
+
+#endif /* HOST_BUILD */
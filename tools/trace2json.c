@@ -0,0 +1,154 @@
+/**
+ * trace2json.c - Convert a trace ring dump to Chrome trace JSON
+ *
+ * Input is the raw TraceBuffer image (profile/trace.h): saved from the
+ * target's traceBuffer symbol with the debugger, or written by the host
+ * simulator with `tachosim -T trace.bin`. Output is the Trace Event
+ * Format read by chrome://tracing and ui.perfetto.dev, one thread per
+ * trace track (main loop, each ISR).
+ *
+ * Build and run from the project root (host gcc, no TivaWare needed):
+ *
+ *     gcc -DHOST_BUILD -O2 -I. tools/trace2json.c -o trace2json
+ *     ./trace2json trace.bin > trace.json
+ *
+ * Events older than the ring are gone; an end whose begin was overwritten
+ * is dropped, and begins still open at the end of the dump are closed at
+ * the last timestamp.
+ */
+
+#ifdef HOST_BUILD
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "profile/trace.h"
+
+#define TRACKS          5
+#define MAX_DEPTH       16
+
+#define TRACE_ID_NAME(symbol, name, track) name,
+static const char *const idNames[TRACE_ID_COUNT] = { TRACE_IDS(TRACE_ID_NAME) };
+#undef TRACE_ID_NAME
+
+#define TRACE_ID_TRACK(symbol, name, track) track,
+static const uint8_t idTracks[TRACE_ID_COUNT] = { TRACE_IDS(TRACE_ID_TRACK) };
+#undef TRACE_ID_TRACK
+
+static const char *const trackNames[TRACKS] = {
+    "main loop", "sensor ISR", "scheduler tick ISR", "button ISR", "drain ISR"
+};
+
+static TraceBuffer dump;
+
+/* Open begins per track, for matching ends */
+static uint8_t openIds[TRACKS][MAX_DEPTH];
+static uint8_t depth[TRACKS];
+
+static bool first = true;
+
+static void emit(const char *ph, uint8_t id, double us, uint32_t arg, bool hasArg)
+{
+    printf("%s\n  {\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%.3f,\"pid\":1,\"tid\":%u",
+           first ? "" : ",", idNames[id], ph, us, idTracks[id]);
+    if (ph[0] == 'i')
+        printf(",\"s\":\"t\"");
+    if (hasArg)
+        printf(",\"args\":{\"arg\":%u}", arg);
+    printf("}");
+    first = false;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *f;
+    uint32_t n, start, i, t;
+    uint32_t prev = 0;
+    uint64_t cycles = 0;
+    double usPerCycle, us = 0.0;
+    uint32_t dropped = 0;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s trace.bin > trace.json\n", argv[0]);
+        return 2;
+    }
+    f = fopen(argv[1], "rb");
+    if (!f) {
+        perror(argv[1]);
+        return 2;
+    }
+    if (fread(&dump, 1, sizeof(dump), f) != sizeof(dump) ||
+        dump.magic != TRACE_MAGIC || dump.capacity != TRACE_EVENTS || dump.cpuHz == 0) {
+        fprintf(stderr, "%s: not a trace dump of this firmware (TRACE_EVENTS %d)\n",
+                argv[1], TRACE_EVENTS);
+        fclose(f);
+        return 1;
+    }
+    fclose(f);
+
+    n = dump.count < TRACE_EVENTS ? dump.count : TRACE_EVENTS;
+    start = dump.count - n;
+    usPerCycle = 1e6 / dump.cpuHz;
+
+    printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    for (t = 0; t < TRACKS; t++) {
+        printf("%s\n  {\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+               "\"args\":{\"name\":\"%s\"}}", first ? "" : ",", t, trackNames[t]);
+        first = false;
+    }
+
+    for (i = 0; i < n; i++) {
+        const TraceEvent *e = &dump.events[(start + i) & (TRACE_EVENTS - 1)];
+        uint8_t kind = e->info & 0xFF;
+        uint8_t id = (e->info >> 8) & 0xFF;
+        uint32_t arg = e->info >> 16;
+        uint8_t track;
+
+        if (id >= TRACE_ID_COUNT) {
+            dropped++;
+            continue;
+        }
+        // Unwrap the 32-bit cycle counter (events are in time order)
+        if (i)
+            cycles += (uint32_t)(e->cycles - prev);
+        prev = e->cycles;
+        us = cycles * usPerCycle;
+        track = idTracks[id];
+
+        switch (kind) {
+        case TRACE_BEGIN:
+            if (depth[track] == MAX_DEPTH) {
+                dropped++;
+                break;
+            }
+            openIds[track][depth[track]++] = id;
+            emit("B", id, us, 0, false);
+            break;
+        case TRACE_END:
+            if (!depth[track] || openIds[track][depth[track] - 1] != id) {
+                dropped++;
+                break;
+            }
+            depth[track]--;
+            emit("E", id, us, arg, true);
+            break;
+        case TRACE_INSTANT:
+            emit("i", id, us, arg, true);
+            break;
+        default:
+            dropped++;
+        }
+    }
+
+    for (t = 0; t < TRACKS; t++)
+        while (depth[t])
+            emit("E", openIds[t][--depth[t]], us, 0, false);
+    printf("\n]}\n");
+
+    fprintf(stderr, "%u events over %.3f ms%s, %u dropped\n", n, us / 1000.0,
+            dump.frozen ? " (frozen)" : "", dropped);
+    return 0;
+}
+
+#endif /* HOST_BUILD */